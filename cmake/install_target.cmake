@@ -16,6 +16,11 @@ include_guard()
 
 function(write_config_file wcf_file)
     file(WRITE "${wcf_file}" "") # Erases it if it already exists
+    file(APPEND
+        "${wcf_file}"
+        "include(CMakeFindDependencyMacro)\n"
+        "find_dependency(Threads)\n"
+    )
     file(APPEND
         "${wcf_file}"
         "get_filename_component(_IL_CONFIG_DIR "
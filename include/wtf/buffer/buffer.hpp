@@ -15,12 +15,31 @@
  */
 
 #pragma once
+#include <wtf/buffer/buffer_pool.hpp>
 #include <wtf/buffer/buffer_view.hpp>
+#include <wtf/buffer/complex_kernels.hpp>
+#include <wtf/buffer/compressed_buffer.hpp>
+#include <wtf/buffer/copy_engine.hpp>
+#include <wtf/buffer/detail_/block_codec.hpp>
 #include <wtf/buffer/detail_/buffer_holder.hpp>
 #include <wtf/buffer/detail_/buffer_view_holder.hpp>
+#include <wtf/buffer/detail_/compressed_model.hpp>
 #include <wtf/buffer/detail_/contiguous_model.hpp>
 #include <wtf/buffer/detail_/contiguous_view_model.hpp>
+#include <wtf/buffer/detail_/indirect_view_model.hpp>
+#include <wtf/buffer/detail_/mapped_model.hpp>
+#include <wtf/buffer/detail_/paged_model.hpp>
+#include <wtf/buffer/factories.hpp>
 #include <wtf/buffer/float_buffer.hpp>
+#include <wtf/buffer/mapped_buffer.hpp>
+#include <wtf/buffer/page_allocation.hpp>
+#include <wtf/buffer/paged_buffer.hpp>
+#include <wtf/buffer/parallel_visit.hpp>
+#include <wtf/buffer/precision_selection.hpp>
+#include <wtf/buffer/random_fill.hpp>
+#include <wtf/buffer/reductions.hpp>
+#include <wtf/buffer/statistics.hpp>
+#include <wtf/buffer/validation.hpp>
 
 /** @brief Contains classes and functions for interacting with type-erased
  *         buffers
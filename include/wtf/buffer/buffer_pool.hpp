@@ -0,0 +1,266 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <typeindex>
+#include <typeinfo>
+#include <vector>
+#include <wtf/buffer/detail_/contiguous_model.hpp>
+#include <wtf/buffer/float_buffer.hpp>
+#include <wtf/concepts/floating_point.hpp>
+
+namespace wtf::buffer {
+namespace detail_ {
+class PoolState;
+}
+
+/// Options controlling what a BufferPool keeps
+struct BufferPoolOptions {
+    /// Buffers are freed, not kept, once this many bytes are retained
+    std::size_t max_retained_bytes = std::numeric_limits<std::size_t>::max();
+};
+
+/// Counters describing how well a BufferPool is working
+struct BufferPoolStats {
+    /// Calls to acquire() (for non-empty buffers)
+    std::size_t acquires = 0;
+
+    /// Calls to acquire() which reused a retained buffer
+    std::size_t hits = 0;
+
+    /// Calls to release() which retained the buffer
+    std::size_t releases = 0;
+
+    /// Buffers passed to release() or trim() which were freed instead
+    std::size_t discards = 0;
+
+    /// Number of buffers currently retained
+    std::size_t buffers_retained = 0;
+
+    /// Bytes of elements currently retained
+    std::size_t bytes_retained = 0;
+
+    /// Fraction of acquires which were hits (0 if there were none)
+    double hit_rate() const noexcept {
+        return acquires == 0 ? 0.0 :
+                               static_cast<double>(hits) /
+                                 static_cast<double>(acquires);
+    }
+};
+
+/** @brief Recycles the memory of temporary FloatBuffer objects.
+ *
+ *  Iterative algorithms often allocate, and then free, temporaries of the
+ *  same size every iteration, paying for malloc and for page faults each
+ *  time. A BufferPool keeps released buffers, whole, and hands them out
+ *  again. Once every size has been seen, acquire() performs no allocation.
+ *
+ *  Buffers are grouped by element type and size class. The size class of a
+ *  request for n elements is the smallest power of 2 not less than n. Buffers
+ *  made by the pool reserve that many elements, so any buffer in a class can
+ *  serve any request of that class without reallocating.
+ *
+ *  Released buffers are kept until retaining one would push the retained
+ *  bytes over BufferPoolOptions::max_retained_bytes, in which case it is
+ *  freed instead, or until trim() is called.
+ *
+ *  All member functions are thread-safe.
+ */
+class BufferPool {
+public:
+    /// Type used for sizes and counts
+    using size_type = std::size_t;
+
+    /// Type of the options
+    using options_type = BufferPoolOptions;
+
+    /// Type of the statistics
+    using stats_type = BufferPoolStats;
+
+    /** @brief Creates an empty pool.
+     *
+     *  @param[in] options What the pool may retain.
+     *
+     *  @throw std::bad_alloc if allocating the state fails. Strong throw
+     *                        guarantee.
+     */
+    explicit BufferPool(options_type options = {});
+
+    /** @brief Takes the retained buffers and statistics of @p other.
+     *
+     *  @p other is left as a pool which retains nothing: acquire() always
+     *  allocates, release() frees the buffer, and stats() is all zeros.
+     *
+     *  @param[in,out] other The pool to take the state of.
+     *
+     *  @throw None No throw guarantee.
+     */
+    BufferPool(BufferPool&& other) noexcept;
+
+    /** @brief Frees the buffers retained by *this, then takes the state of
+     *         @p other.
+     *
+     *  @p other is left as a pool which retains nothing (see the move ctor).
+     *
+     *  @param[in,out] other The pool to take the state of.
+     *
+     *  @return *this after taking the state of @p other.
+     *
+     *  @throw None No throw guarantee.
+     */
+    BufferPool& operator=(BufferPool&& other) noexcept;
+
+    /// Frees all retained buffers
+    ~BufferPool() noexcept;
+
+    /** @brief Returns a buffer of @p n elements of type @p T.
+     *
+     *  If a buffer of the same type and size class is retained, it is resized
+     *  to @p n (which never reallocates) and returned. Otherwise a new buffer
+     *  is allocated.
+     *
+     *  @tparam T The type of the elements.
+     *
+     *  @param[in] n The number of elements.
+     *  @param[in] zero_init Should reused elements be set to T{}? If false,
+     *                       reused elements hold whatever values they held
+     *                       when released. New elements are always
+     *                       value-initialized.
+     *
+     *  @return A buffer of @p n elements.
+     *
+     *  @throw std::bad_alloc if allocating a new buffer fails. Strong throw
+     *                        guarantee.
+     */
+    template<concepts::FloatingPoint T>
+    FloatBuffer acquire(size_type n, bool zero_init = true) {
+        if(n == 0) return FloatBuffer(std::vector<T>{});
+        const auto size_class = request_class(n);
+        auto buffer           = pop_(typeid(T), size_class);
+        if(buffer.size() == 0) {
+            std::vector<T> values;
+            values.reserve(size_type{1} << size_class);
+            values.resize(n);
+            return FloatBuffer(std::move(values));
+        }
+
+        auto& model = buffer.downcast_<T>();
+        model.resize(n);
+        if(zero_init) std::fill_n(model.data(), n, T{});
+        return buffer;
+    }
+
+    /** @brief Gives @p buffer to the pool for reuse.
+     *
+     *  Buffers which do not own their memory (e.g., views, memory maps, or
+     *  compressed buffers) can not be reused and are simply freed.
+     *
+     *  @tparam TupleType The types @p buffer may hold.
+     *
+     *  @param[in] buffer The buffer to recycle.
+     *
+     *  @throw std::runtime_error if @p buffer holds a type not in
+     *                            @p TupleType. Strong throw guarantee.
+     */
+    template<typename TupleType>
+    void release(FloatBuffer&& buffer) {
+        if(buffer.size() == 0 || !buffer.is_contiguous()) {
+            discard_(std::move(buffer));
+            return;
+        }
+
+        std::type_index type = typeid(void);
+        size_type capacity   = 0;
+        size_type nbytes     = 0;
+
+        auto lambda = [&](auto&& values) {
+            using value_type = std::remove_cvref_t<decltype(values[0])>;
+            using model_type = detail_::ContiguousModel<value_type>;
+            auto* pmodel = dynamic_cast<model_type*>(&buffer.holder_());
+            type         = typeid(value_type);
+            capacity     = pmodel->capacity();
+            nbytes       = capacity * sizeof(value_type);
+        };
+        visit_contiguous_buffer<TupleType>(lambda, buffer);
+
+        if(capacity == 0) {
+            discard_(std::move(buffer));
+        } else {
+            push_(type, capacity_class(capacity), nbytes, std::move(buffer));
+        }
+    }
+
+    /** @brief Frees retained buffers until at most @p max_bytes remain.
+     *
+     *  Buffers of the largest size classes are freed first.
+     *
+     *  @param[in] max_bytes The most bytes to keep retained.
+     *
+     *  @throw std::bad_alloc if allocating bookkeeping space fails. Strong
+     *                        throw guarantee.
+     */
+    void trim(size_type max_bytes = 0);
+
+    /** @brief Returns the pool's counters.
+     *
+     *  @return A snapshot of the counters.
+     *
+     *  @throw None No throw guarantee.
+     */
+    stats_type stats() const noexcept;
+
+    /** @brief The size class of a request for @p n elements.
+     *
+     *  @param[in] n The number of elements requested. Must be positive.
+     *
+     *  @return The base 2 logarithm of @p n, rounded up.
+     *
+     *  @throw None No throw guarantee.
+     */
+    static size_type request_class(size_type n) noexcept;
+
+    /** @brief The size class a buffer with @p capacity elements belongs to.
+     *
+     *  @param[in] capacity The buffer's capacity. Must be positive.
+     *
+     *  @return The base 2 logarithm of @p capacity, rounded down.
+     *
+     *  @throw None No throw guarantee.
+     */
+    static size_type capacity_class(size_type capacity) noexcept;
+
+private:
+    /// Removes a buffer of @p type and @p size_class (empty if there is none)
+    FloatBuffer pop_(std::type_index type, size_type size_class);
+
+    /// Retains @p buffer, of @p type, @p size_class and @p nbytes, if allowed
+    void push_(std::type_index type, size_type size_class, size_type nbytes,
+               FloatBuffer&& buffer);
+
+    /// Frees @p buffer and counts it as a discard
+    void discard_(FloatBuffer&& buffer) noexcept;
+
+    /// The retained buffers and the counters
+    std::unique_ptr<detail_::PoolState> m_pstate_;
+};
+
+} // namespace wtf::buffer
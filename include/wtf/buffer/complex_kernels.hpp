@@ -0,0 +1,244 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <complex>
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+#include <wtf/buffer/float_buffer.hpp>
+#include <wtf/buffer/reductions.hpp>
+#include <wtf/concepts/floating_point.hpp>
+#include <wtf/fp/complex.hpp>
+#include <wtf/fp/convert.hpp>
+#include <wtf/fp/float.hpp>
+#include <wtf/type_traits/is_complex.hpp>
+
+/** @file complex_kernels.hpp
+ *
+ *  Element-wise kernels which do the right thing for both real and complex
+ *  buffers. All of them go through visit_contiguous_buffer, so the buffers
+ *  must be contiguous and hold one of the types in the TupleType given by the
+ *  caller. TupleType may freely mix real and complex types (e.g., by
+ *  appending wtf::complex_fp_types to wtf::default_fp_types). The inner
+ *  product, dot, is a reduction and lives in reductions.hpp.
+ */
+
+namespace wtf::buffer {
+
+/** @brief Conjugates each element of @p buffer in place.
+ *
+ *  @tparam TupleType The floating-point types @p buffer may hold.
+ *
+ *  Real elements are left as is.
+ *
+ *  @param[in,out] buffer The buffer to conjugate.
+ *
+ *  @throw std::runtime_error if @p buffer does not hold one of the types in
+ *                            @p TupleType. Strong throw guarantee.
+ */
+template<typename TupleType>
+void conj(FloatBuffer& buffer) {
+    auto visitor = [](auto&& values) {
+        using value_type = std::remove_reference_t<decltype(values[0])>;
+        using clean_type = std::remove_const_t<value_type>;
+        if constexpr(!std::is_const_v<value_type> &&
+                     type_traits::is_complex_v<clean_type>) {
+            for(auto& x : values) x = std::conj(x);
+        }
+    };
+    visit_contiguous_buffer<TupleType>(visitor, buffer);
+}
+
+/** @brief Computes the absolute value of each element of @p buffer.
+ *
+ *  @tparam TupleType The floating-point types @p buffer may hold.
+ *
+ *  For a buffer of std::complex<T> the result holds T objects (the moduli).
+ *  For a buffer of real values the result has the same type as @p buffer.
+ *
+ *  @param[in] buffer The buffer to take the absolute value of.
+ *
+ *  @return A new buffer holding the absolute values.
+ *
+ *  @throw std::runtime_error if @p buffer does not hold one of the types in
+ *                            @p TupleType. Strong throw guarantee.
+ *  @throw std::bad_alloc if allocating the result fails. Strong throw
+ *                        guarantee.
+ */
+template<typename TupleType>
+FloatBuffer abs(const FloatBuffer& buffer) {
+    auto visitor = [](auto&& values) {
+        using value_type = std::remove_cvref_t<decltype(values[0])>;
+        std::vector<type_traits::real_type_t<value_type>> rv(values.size());
+        for(std::size_t i = 0; i < values.size(); ++i)
+            rv[i] = std::abs(values[i]);
+        return FloatBuffer(std::move(rv));
+    };
+    return visit_contiguous_buffer<TupleType>(visitor, buffer);
+}
+
+/** @brief Makes a copy of @p buffer whose elements are converted to @p To.
+ *
+ *  @tparam To The type of the elements in the result.
+ *  @tparam TupleType The floating-point types @p buffer may hold.
+ *
+ *  Conversions are done with static_cast, so this covers changing the
+ *  precision of real or complex values (in either direction) and promoting
+ *  real values to complex ones. Discarding the imaginary part is not
+ *  allowed; use abs or a visitor to get at the parts of complex values.
+ *
+ *  @param[in] buffer The buffer to convert.
+ *
+ *  @return A new buffer holding the converted elements.
+ *
+ *  @throw std::invalid_argument if the elements of @p buffer can not be
+ *                               converted to @p To. Strong throw guarantee.
+ *  @throw std::runtime_error if @p buffer does not hold one of the types in
+ *                            @p TupleType. Strong throw guarantee.
+ */
+template<concepts::UnmodifiedFloatingPoint To, typename TupleType>
+FloatBuffer convert_float_buffer(const FloatBuffer& buffer) {
+    auto visitor = [](auto&& values) -> FloatBuffer {
+        using from_type = std::remove_cvref_t<decltype(values[0])>;
+        if constexpr(!std::is_constructible_v<To, const from_type&>) {
+            throw std::invalid_argument(
+              "convert_float_buffer: elements can not be converted");
+        } else {
+            std::vector<To> rv;
+            rv.reserve(values.size());
+            for(const auto& x : values) rv.push_back(static_cast<To>(x));
+            return FloatBuffer(std::move(rv));
+        }
+    };
+    return visit_contiguous_buffer<TupleType>(visitor, buffer);
+}
+
+namespace detail_ {
+
+/// True if fp::convert has an overload taking ConvertOptions from From to To
+template<typename From, typename To>
+constexpr bool has_rounded_convert_v = requires(std::span<const From> in,
+                                                std::span<To> out,
+                                                fp::ConvertOptions options) {
+    fp::convert(in, out, options);
+};
+
+/** @brief True if every From value is exactly representable as a To.
+ *
+ *  This holds if the types are the same, if std::numeric_limits shows To to
+ *  have at least From's precision and range, or if From is a 16-bit type
+ *  which fp::convert only widens.
+ */
+template<typename From, typename To>
+constexpr bool is_exact_conversion_v = [] {
+    using from_limits = std::numeric_limits<From>;
+    using to_limits   = std::numeric_limits<To>;
+    if constexpr(std::is_same_v<From, To>) {
+        return true;
+    } else if constexpr(from_limits::is_specialized &&
+                        to_limits::is_specialized) {
+        return to_limits::digits >= from_limits::digits &&
+               to_limits::max_exponent >= from_limits::max_exponent &&
+               to_limits::min_exponent <= from_limits::min_exponent;
+    } else {
+        return requires(std::span<const From> in, std::span<To> out) {
+            fp::convert(in, out);
+        } && !has_rounded_convert_v<From, To>;
+    }
+}();
+
+} // namespace detail_
+
+/** @brief Makes a copy of @p buffer whose elements are converted to @p To,
+ *         rounding as set by @p options.
+ *
+ *  @tparam To The type of the elements in the result.
+ *  @tparam TupleType The floating-point types @p buffer may hold.
+ *
+ *  Narrowing real or complex values from double or float to float, Half, or
+ *  BFloat16 goes through the overloads of fp::convert taking
+ *  fp::ConvertOptions (complex values are converted part by part, with the
+ *  real and imaginary parts of element i using random numbers 2i and
+ *  2i + 1). Exact conversions, e.g., widening, ignore @p options. Otherwise
+ *  this is the same as convert_float_buffer(buffer) when @p options asks for
+ *  neither stochastic rounding nor saturation.
+ *
+ *  @param[in] buffer The buffer to convert.
+ *  @param[in] options How to round and what to do with out-of-range values.
+ *
+ *  @return A new buffer holding the converted elements.
+ *
+ *  @throw std::invalid_argument if the elements of @p buffer can not be
+ *                               converted to @p To, or if @p options asks
+ *                               for stochastic rounding or saturation of a
+ *                               conversion which does not support them.
+ *                               Strong throw guarantee.
+ *  @throw std::runtime_error if @p buffer does not hold one of the types in
+ *                            @p TupleType. Strong throw guarantee.
+ */
+template<concepts::UnmodifiedFloatingPoint To, typename TupleType>
+FloatBuffer convert_float_buffer(const FloatBuffer& buffer,
+                                 const fp::ConvertOptions& options) {
+    auto visitor = [&options](auto&& values) -> FloatBuffer {
+        using from_type = std::remove_cvref_t<decltype(values[0])>;
+        using from_part = type_traits::real_type_t<from_type>;
+        using to_part   = type_traits::real_type_t<To>;
+        constexpr bool from_complex = type_traits::is_complex_v<from_type>;
+        constexpr bool to_complex   = type_traits::is_complex_v<To>;
+        constexpr std::size_t parts = from_complex ? 2 : 1;
+
+        // std::complex<T> is only layout-compatible with T[2] for the
+        // standard floating-point types
+        constexpr bool by_parts = from_complex == to_complex &&
+                                  (!to_complex ||
+                                   std::is_floating_point_v<to_part>);
+        constexpr bool is_exact =
+          detail_::is_exact_conversion_v<from_part, to_part> &&
+          (!from_complex || to_complex);
+
+        if constexpr(!std::is_constructible_v<To, const from_type&>) {
+            throw std::invalid_argument(
+              "convert_float_buffer: elements can not be converted");
+        } else if constexpr(by_parts &&
+                            detail_::has_rounded_convert_v<from_part,
+                                                           to_part>) {
+            std::vector<To> rv(values.size());
+            const auto* pin = reinterpret_cast<const from_part*>(values.data());
+            auto* pout      = reinterpret_cast<to_part*>(rv.data());
+            const auto n    = values.size() * parts;
+            fp::convert(std::span<const from_part>(pin, n),
+                        std::span<to_part>(pout, n), options);
+            return FloatBuffer(std::move(rv));
+        } else {
+            if(!is_exact && (options.stochastic || options.saturate)) {
+                throw std::invalid_argument(
+                  "convert_float_buffer: rounding options are not supported "
+                  "for this conversion");
+            }
+            std::vector<To> rv;
+            rv.reserve(values.size());
+            for(const auto& x : values) rv.push_back(static_cast<To>(x));
+            return FloatBuffer(std::move(rv));
+        }
+    };
+    return visit_contiguous_buffer<TupleType>(visitor, buffer);
+}
+
+} // namespace wtf::buffer
@@ -0,0 +1,240 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <wtf/buffer/buffer_view.hpp>
+#include <wtf/buffer/detail_/compressed_model.hpp>
+#include <wtf/buffer/float_buffer.hpp>
+#include <wtf/fp/float.hpp>
+
+namespace wtf::buffer {
+
+/// Options controlling how compress_float_buffer compresses a buffer
+struct CompressionOptions {
+    /// Number of elements per independently compressed block
+    std::size_t block_size = 4096;
+
+    /// Maximum number of decompressed blocks to keep in memory
+    std::size_t cache_capacity = 4;
+};
+
+/** @brief Is @p buffer stored compressed?
+ *
+ *  @param[in] buffer The buffer to inspect.
+ *
+ *  @return True if @p buffer was created by compress_float_buffer (or is a
+ *          copy of such a buffer) and false otherwise.
+ *
+ *  @throw None No throw guarantee.
+ */
+bool is_compressed(const FloatBuffer& buffer) noexcept;
+
+/** @brief How many bytes do the compressed elements of @p buffer occupy?
+ *
+ *  Modified blocks are recompressed first, so the result is up to date. The
+ *  decompressed blocks in the cache are not counted.
+ *
+ *  @param[in] buffer A compressed buffer.
+ *
+ *  @return The total size, in bytes, of the compressed blocks.
+ *
+ *  @throw std::runtime_error if @p buffer is not compressed. Strong throw
+ *                            guarantee.
+ *  @throw std::bad_alloc if recompressing a block fails. Weak throw
+ *                        guarantee.
+ */
+std::size_t compressed_size(const FloatBuffer& buffer);
+
+namespace detail_ {
+
+/** @brief Calls @p fxn with @p holder downcast to a CompressedModel.
+ *
+ *  @tparam TupleType The types the elements of @p holder may have.
+ *
+ *  @param[in] fxn Called with a (const if @p holder is const) reference to
+ *                 the CompressedModel.
+ *  @param[in] holder The holder to downcast.
+ *
+ *  @return True if @p holder is a CompressedModel of one of the types in
+ *          @p TupleType (and @p fxn was called), false otherwise.
+ *
+ *  @throw ??? if @p fxn throws. Same throw guarantee.
+ */
+template<typename TupleType, typename FxnType, typename HolderType>
+bool with_compressed_model(FxnType&& fxn, HolderType& holder) {
+    constexpr bool is_const = std::is_const_v<HolderType>;
+    auto try_type           = [&]<typename T>(std::type_identity<T>) {
+        if constexpr(std::is_trivially_copyable_v<T>) {
+            using model_type = CompressedModel<T>;
+            using cast_type  = std::conditional_t<is_const, const model_type*,
+                                                  model_type*>;
+            if(auto* pmodel = dynamic_cast<cast_type>(&holder)) {
+                fxn(*pmodel);
+                return true;
+            }
+        }
+        return false;
+    };
+    return [&]<typename... Ts>(std::tuple<Ts...>*) {
+        return (try_type(std::type_identity<Ts>{}) || ...);
+    }(static_cast<TupleType*>(nullptr));
+}
+
+} // namespace detail_
+
+/** @brief Creates a compressed copy of @p buffer.
+ *
+ *  @tparam TupleType A std::tuple of the floating-point types @p buffer may
+ *                    hold. Must be explicitly provided by the caller.
+ *
+ *  The elements are losslessly compressed in independent blocks (see
+ *  detail_::compress_block for the scheme). The result is an ordinary
+ *  FloatBuffer: at(), size(), comparisons, copies, and views all work, with
+ *  blocks being decompressed on demand into a small cache. Copying the result
+ *  makes another compressed buffer; use decompress_float_buffer to get a
+ *  contiguous buffer back. Since the elements are not contiguous,
+ *  visit_contiguous_buffer does not work on compressed buffers, use
+ *  visit_buffer_chunks instead.
+ *
+ *  Views returned by at() alias the cache and are only valid until their
+ *  block is evicted (i.e., after cache_capacity other blocks are accessed).
+ *
+ *  @param[in] buffer The elements to compress.
+ *  @param[in] options How to compress them.
+ *
+ *  @return A buffer holding the compressed elements. Empty if @p buffer is.
+ *
+ *  @throw std::runtime_error if @p buffer does not hold one of the types in
+ *                            @p TupleType, is not contiguous, or holds a type
+ *                            which is not trivially copyable. Strong throw
+ *                            guarantee.
+ *  @throw std::invalid_argument if @p options has a zero block size or cache
+ *                               capacity. Strong throw guarantee.
+ */
+template<typename TupleType>
+FloatBuffer compress_float_buffer(BufferView<const fp::Float> buffer,
+                                  CompressionOptions options = {}) {
+    if(buffer.size() == 0) return FloatBuffer{};
+    auto lambda = [&](auto values) -> FloatBuffer {
+        using element_type = typename decltype(values)::element_type;
+        using float_type   = std::remove_const_t<element_type>;
+        if constexpr(!std::is_trivially_copyable_v<float_type>) {
+            throw std::runtime_error("Type can not be compressed");
+        } else {
+            using model_type = detail_::CompressedModel<float_type>;
+            return FloatBuffer(std::make_unique<model_type>(
+              values, options.block_size, options.cache_capacity));
+        }
+    };
+    return visit_contiguous_buffer_view<TupleType>(lambda, buffer);
+}
+
+/** @brief Returns a contiguous copy of @p buffer.
+ *
+ *  @tparam TupleType A std::tuple of the floating-point types @p buffer may
+ *                    hold. Must be explicitly provided by the caller.
+ *
+ *  @param[in] buffer The buffer to decompress. If it is not compressed it is
+ *                    simply copied.
+ *
+ *  @return An in-memory, contiguous buffer holding the elements of
+ *          @p buffer.
+ *
+ *  @throw std::runtime_error if @p buffer is compressed, but not with one of
+ *                            the types in @p TupleType. Strong throw
+ *                            guarantee.
+ *  @throw std::bad_alloc if allocating the result fails. Strong throw
+ *                        guarantee.
+ */
+template<typename TupleType>
+FloatBuffer decompress_float_buffer(const FloatBuffer& buffer) {
+    if(!is_compressed(buffer)) return buffer;
+    FloatBuffer rv;
+    auto lambda = [&](const auto& model) {
+        rv = FloatBuffer(model.decompress());
+    };
+    if(!detail_::with_compressed_model<TupleType>(lambda, buffer.holder_())) {
+        throw std::runtime_error("Compressed type is not in the tuple");
+    }
+    return rv;
+}
+
+/** @brief Calls @p visitor with the elements of @p buffer in chunks.
+ *
+ *  @tparam TupleType A std::tuple of the floating-point types @p buffer may
+ *                    hold. Must be explicitly provided by the caller.
+ *  @tparam Visitor The type of @p visitor. Must be callable with a
+ *                  std::span<T> (std::span<const T> if @p buffer is const) for
+ *                  each T in @p TupleType.
+ *  @tparam BufferType FloatBuffer, possibly const-qualified.
+ *
+ *  This is the chunked counterpart of visit_contiguous_buffer. It works for
+ *  both contiguous buffers, where @p visitor is called once with all of the
+ *  elements, and compressed buffers, where @p visitor is called once per
+ *  block, in order. When @p buffer is mutable, changes made through the spans
+ *  are kept. Since any block could have been changed, every block of a
+ *  mutable compressed buffer is then recompressed when it leaves the cache;
+ *  visitors which only read should use read_buffer_chunks (or pass a const
+ *  buffer) instead.
+ *
+ *  @param[in] visitor The function to call with each chunk.
+ *  @param[in] buffer The buffer to visit.
+ *
+ *  @throw std::runtime_error if @p buffer does not hold one of the types in
+ *                            @p TupleType or is neither contiguous nor
+ *                            compressed. Strong throw guarantee.
+ *  @throw ??? if @p visitor throws. Weak throw guarantee.
+ */
+template<typename TupleType, typename Visitor, typename BufferType>
+void visit_buffer_chunks(Visitor&& visitor, BufferType&& buffer) {
+    if(buffer.size() == 0) return;
+    auto lambda = [&](auto& model) { model.for_each_block(visitor); };
+    if(detail_::with_compressed_model<TupleType>(lambda, buffer.holder_()))
+        return;
+    visit_contiguous_buffer<TupleType>(std::forward<Visitor>(visitor),
+                                       std::forward<BufferType>(buffer));
+}
+
+/** @brief Calls @p visitor with read-only chunks of @p buffer.
+ *
+ *  @tparam TupleType A std::tuple of the floating-point types @p buffer may
+ *                    hold. Must be explicitly provided by the caller.
+ *  @tparam Visitor The type of @p visitor. Must be callable with a
+ *                  std::span<const T> for each T in @p TupleType.
+ *
+ *  Same as visit_buffer_chunks with a const buffer. Blocks of a compressed
+ *  buffer are not marked dirty, so reading a mutable buffer this way does not
+ *  cause them to be recompressed, nor does it evict cached blocks.
+ *
+ *  @param[in] visitor The function to call with each chunk.
+ *  @param[in] buffer The buffer to visit.
+ *
+ *  @throw std::runtime_error if @p buffer does not hold one of the types in
+ *                            @p TupleType or is neither contiguous nor
+ *                            compressed. Strong throw guarantee.
+ *  @throw ??? if @p visitor throws. Same throw guarantee.
+ */
+template<typename TupleType, typename Visitor>
+void read_buffer_chunks(Visitor&& visitor, const FloatBuffer& buffer) {
+    visit_buffer_chunks<TupleType>(std::forward<Visitor>(visitor), buffer);
+}
+
+} // namespace wtf::buffer
@@ -0,0 +1,178 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+
+namespace wtf::buffer {
+
+/** @brief The tunable parameters of the copy engine.
+ *
+ *  The member defaults suit a typical multi-core x86 machine. The right
+ *  values depend mostly on the size of the last level cache
+ *  (streaming_threshold) and on how many threads it takes to saturate memory
+ *  bandwidth (max_threads). See default_copy_options for the values the
+ *  engine starts with.
+ */
+struct CopyOptions {
+    /// Type used for sizes and counts
+    using size_type = std::size_t;
+
+    /// Copies of at least this many bytes are split over several threads
+    size_type parallel_threshold = size_type{1} << 23;
+
+    /// Copies of at least this many bytes use non-temporal stores
+    size_type streaming_threshold = size_type{1} << 25;
+
+    /// Each thread copies at least this many bytes
+    size_type min_bytes_per_thread = size_type{1} << 22;
+
+    /// The most threads a copy may use, 0 means parallel::max_threads()
+    size_type max_threads = 0;
+
+    /// Two sets of options are equal if all of their members are equal
+    bool operator==(const CopyOptions&) const = default;
+};
+
+/// The ways the copy engine can copy bytes
+enum class CopyStrategy {
+    /// A single call to std::memcpy on the calling thread
+    serial,
+    /// std::memcpy over static chunks, one chunk per thread
+    parallel,
+    /// Like parallel, but the stores bypass the cache
+    streaming
+};
+
+/** @brief The options the copy engine starts with.
+ *
+ *  These are CopyOptions{}, except that streaming_threshold is raised to the
+ *  size of the last level cache when the OS reports it. Copies which fit in
+ *  the cache are faster with ordinary stores.
+ *
+ *  @return The default copy options for this machine.
+ *
+ *  @throw None No throw guarantee.
+ */
+CopyOptions default_copy_options() noexcept;
+
+/** @brief The options currently used by the copy engine.
+ *
+ *  @return The process-wide copy options.
+ *
+ *  @throw None No throw guarantee.
+ */
+CopyOptions copy_options() noexcept;
+
+/** @brief Changes the options used by the copy engine.
+ *
+ *  The options are process-wide and take effect for copies started after
+ *  this call. Changing them while copies are running is safe.
+ *
+ *  @param[in] options The new options.
+ *
+ *  @throw None No throw guarantee.
+ */
+void set_copy_options(const CopyOptions& options) noexcept;
+
+/** @brief How many threads a parallel copy of @p n_bytes bytes uses.
+ *
+ *  Every thread gets at least CopyOptions::min_bytes_per_thread bytes and
+ *  there are at most CopyOptions::max_threads threads.
+ *
+ *  @param[in] n_bytes The size of the copy.
+ *
+ *  @return The number of threads (at least 1).
+ *
+ *  @throw None No throw guarantee.
+ */
+std::size_t copy_threads(std::size_t n_bytes) noexcept;
+
+/** @brief Which strategy copy_bytes uses for @p n_bytes bytes.
+ *
+ *  Small copies are done serially. Copies of at least
+ *  CopyOptions::parallel_threshold bytes are split over threads, since a
+ *  single core can not saturate memory bandwidth. Copies of at least
+ *  CopyOptions::streaming_threshold bytes, i.e., copies too big to stay in
+ *  cache anyway, additionally use non-temporal stores. These write straight
+ *  to memory, so the copy neither reads the destination lines first nor
+ *  evicts data the caller will use soon. Streaming is only available when
+ *  the target supports SSE2; otherwise such copies are parallel.
+ *
+ *  Copies which would get only one thread (see
+ *  CopyOptions::min_bytes_per_thread and CopyOptions::max_threads) are
+ *  serial. For large copies std::memcpy already picks the fastest
+ *  single-threaded method, which with glibc includes non-temporal stores.
+ *
+ *  @param[in] n_bytes The size of the copy.
+ *
+ *  @return The strategy used to copy @p n_bytes bytes.
+ *
+ *  @throw None No throw guarantee.
+ */
+CopyStrategy copy_strategy(std::size_t n_bytes) noexcept;
+
+/** @brief Copies @p n_bytes bytes from @p src to @p dst.
+ *
+ *  This is a drop-in replacement for std::memcpy which picks the strategy
+ *  returned by copy_strategy. If the parallel copy can not be started
+ *  (e.g., a thread can not be created or memory for it allocated), the copy
+ *  is finished serially.
+ *
+ *  @param[in] dst Where to copy the bytes to.
+ *  @param[in] src Where to copy the bytes from. Must not overlap with
+ *                 @p dst.
+ *  @param[in] n_bytes The number of bytes to copy.
+ *
+ *  @throw None No throw guarantee.
+ */
+void copy_bytes(void* dst, const void* src, std::size_t n_bytes) noexcept;
+
+/** @brief Copies the elements of @p in to @p out.
+ *
+ *  @tparam T The type of the elements.
+ *
+ *  Trivially copyable elements are copied with copy_bytes, other elements
+ *  with their copy assignment operator.
+ *
+ *  @param[in] in The elements to copy.
+ *  @param[out] out Where to copy the elements. Must be the same size as
+ *                  @p in and must not overlap with @p in.
+ *
+ *  @throw std::invalid_argument if @p in and @p out are different sizes.
+ *                               Strong throw guarantee.
+ *  @throw ??? if copying a non-trivially copyable element throws. Weak throw
+ *             guarantee.
+ */
+template<typename T>
+void copy_elements(std::span<const T> in, std::span<T> out) {
+    if(in.size() != out.size()) {
+        throw std::invalid_argument(
+          "copy_elements: input and output are different sizes");
+    }
+    if constexpr(std::is_trivially_copyable_v<T>) {
+        copy_bytes(out.data(), in.data(), in.size_bytes());
+    } else {
+        std::copy(in.begin(), in.end(), out.begin());
+    }
+}
+
+} // namespace wtf::buffer
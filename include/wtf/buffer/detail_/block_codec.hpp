@@ -0,0 +1,75 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace wtf::buffer::detail_ {
+
+/// Type used to hold a compressed block
+using byte_vector = std::vector<std::byte>;
+
+/** @brief Losslessly compresses a block of floating-point values.
+ *
+ *  The values are treated as opaque elements of @p element_size bytes, so
+ *  any trivially copyable floating-point type works. Compression is done in
+ *  three steps:
+ *
+ *  1. Delta: each element is XOR-ed with the element before it. For smooth
+ *     data neighboring values share their sign, exponent, and leading
+ *     mantissa bits, so those bits become zero.
+ *  2. Byte-shuffle: byte k of every element is grouped together, which lines
+ *     up the (mostly zero) high-order bytes into long runs.
+ *  3. Run-length encoding of the shuffled bytes (PackBits-style: a control
+ *     byte introduces either up to 128 literal bytes or a run of 3 to 130
+ *     copies of one byte).
+ *
+ *  If this does not make the block smaller, the bytes are stored as is, so a
+ *  block never grows by more than one byte.
+ *
+ *  @param[in] raw The bytes of the elements to compress.
+ *  @param[in] element_size The size of one element in bytes.
+ *
+ *  @return The compressed block.
+ *
+ *  @throw std::invalid_argument if @p element_size is 0 or does not divide
+ *                               raw.size(). Strong throw guarantee.
+ *  @throw std::bad_alloc if allocating the block fails. Strong throw
+ *                        guarantee.
+ */
+byte_vector compress_block(std::span<const std::byte> raw,
+                           std::size_t element_size);
+
+/** @brief Reverses compress_block.
+ *
+ *  @param[in] packed A block returned by compress_block.
+ *  @param[out] raw Where to put the elements. Must be the size of the raw
+ *                  bytes passed to compress_block.
+ *  @param[in] element_size The element size passed to compress_block.
+ *
+ *  @throw std::invalid_argument if @p element_size is 0 or does not divide
+ *                               raw.size(). Strong throw guarantee.
+ *  @throw std::runtime_error if @p packed is not a valid block of
+ *                            raw.size() bytes. No throw guarantee.
+ *  @throw std::bad_alloc if allocating scratch space fails. No throw
+ *                        guarantee.
+ */
+void decompress_block(std::span<const std::byte> packed,
+                      std::span<std::byte> raw, std::size_t element_size);
+
+} // namespace wtf::buffer::detail_
@@ -0,0 +1,507 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <list>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <wtf/buffer/detail_/block_codec.hpp>
+#include <wtf/buffer/detail_/buffer_holder.hpp>
+#include <wtf/buffer/detail_/indirect_view_model.hpp>
+#include <wtf/concepts/floating_point.hpp>
+#include <wtf/rtti/type_info.hpp>
+
+namespace wtf::buffer::detail_ {
+
+/** @brief Non-template part of CompressedModel.
+ *
+ *  Code which only needs to know that a buffer is compressed (e.g.,
+ *  buffer::is_compressed) cross-casts the holder to this class, which avoids
+ *  having to know the type of the elements.
+ */
+class CompressedStorage {
+public:
+    /// Type used for sizes
+    using size_type = std::size_t;
+
+    /// Default virtual dtor
+    virtual ~CompressedStorage() = default;
+
+    /// Bytes used by the compressed blocks (excludes the cache)
+    virtual size_type compressed_size() const = 0;
+
+    /// Recompresses modified blocks so compressed_size() is up to date
+    virtual void flush() const = 0;
+
+    /// The number of elements per block
+    virtual size_type block_size() const noexcept = 0;
+
+    /// The maximum number of decompressed blocks kept in the cache
+    virtual size_type cache_capacity() const noexcept = 0;
+};
+
+/** @brief Holds a buffer as independently compressed blocks.
+ *
+ *  @tparam FloatType The type of the elements. Must be trivially copyable and
+ *                    not const-qualified.
+ *
+ *  The elements are split into blocks of block_size() elements and each
+ *  block is compressed with compress_block. Accessing an element decompresses
+ *  its block into a small least-recently-used (LRU) cache of at most
+ *  cache_capacity() blocks, so repeated accesses to nearby elements are
+ *  cheap. Blocks which were accessed through a mutable API are marked dirty
+ *  and recompressed when they are evicted from the cache (or by flush()).
+ *
+ *  Because elements live in the cache, references and views to an element are
+ *  only valid until its block is evicted, i.e., until cache_capacity() other
+ *  blocks have been accessed. Since even read-only access updates the cache,
+ *  a CompressedModel must not be accessed from multiple threads at once.
+ */
+template<concepts::FloatingPoint FloatType>
+class CompressedModel : public CompressedStorage, public BufferHolder {
+public:
+    static_assert(std::is_trivially_copyable_v<FloatType>,
+                  "Only trivially copyable types can be compressed");
+    static_assert(!std::is_const_v<FloatType>,
+                  "CompressedModel can not hold const elements");
+
+    /// Type *this inherits from
+    using holder_type = BufferHolder;
+
+    /// Pull in types from the base class
+    ///@{
+    using size_type       = typename holder_type::size_type;
+    using view_type       = typename holder_type::view_type;
+    using const_view_type = typename holder_type::const_view_type;
+    ///@}
+
+    /// Type of a mutable reference to an element
+    using reference = FloatType&;
+
+    /// Type of a read-only reference to an element
+    using const_reference = const FloatType&;
+
+    /// Type of a mutable span of decompressed elements
+    using span_type = std::span<FloatType>;
+
+    /// Type of a read-only span of decompressed elements
+    using const_span_type = std::span<const FloatType>;
+
+    /// Type used to hold decompressed elements
+    using vector_type = std::vector<FloatType>;
+
+    /** @brief Compresses a copy of @p values.
+     *
+     *  @param[in] values The elements to hold.
+     *  @param[in] block_size The number of elements per block. Must be
+     *                        non-zero.
+     *  @param[in] cache_capacity The maximum number of decompressed blocks to
+     *                            cache. Must be non-zero.
+     *
+     *  @throw std::invalid_argument if @p block_size or @p cache_capacity is
+     *                               0. Strong throw guarantee.
+     *  @throw std::bad_alloc if allocating the blocks fails. Strong throw
+     *                        guarantee.
+     */
+    CompressedModel(const_span_type values, size_type block_size,
+                    size_type cache_capacity) :
+      holder_type(rtti::wtf_typeid<FloatType>()),
+      m_size_(values.size()),
+      m_block_size_(block_size),
+      m_cache_capacity_(cache_capacity) {
+        if(block_size == 0 || cache_capacity == 0) {
+            throw std::invalid_argument(
+              "Block size and cache capacity must be non-zero");
+        }
+        m_blocks_.reserve(n_blocks());
+        for(size_type b = 0; b < n_blocks(); ++b) {
+            auto block = values.subspan(b * block_size, n_in_block_(b));
+            m_blocks_.push_back(
+              compress_block(std::as_bytes(block), sizeof(FloatType)));
+        }
+    }
+
+    /** @brief Makes a deep copy of @p other.
+     *
+     *  Dirty blocks in @p other's cache are compressed into the copy, @p other
+     *  itself is not modified. The copy starts with an empty cache.
+     *
+     *  @param[in] other The model to copy.
+     *
+     *  @throw std::bad_alloc if allocating the copy fails. Strong throw
+     *                        guarantee.
+     */
+    CompressedModel(const CompressedModel& other) :
+      CompressedStorage(other),
+      holder_type(other),
+      m_size_(other.m_size_),
+      m_block_size_(other.m_block_size_),
+      m_cache_capacity_(other.m_cache_capacity_),
+      m_blocks_(other.m_blocks_) {
+        for(const auto& entry : other.m_cache_)
+            if(entry.dirty) m_blocks_[entry.index] = compress_(entry.values);
+    }
+
+    /// Copy-and-swap, strong throw guarantee
+    CompressedModel& operator=(const CompressedModel& other) {
+        if(this != &other) {
+            CompressedModel temp(other);
+            *this = std::move(temp);
+        }
+        return *this;
+    }
+
+    /** @brief Takes the state of @p other.
+     *
+     *  The cache does not hold pointers into *this, so it moves with the
+     *  blocks. @p other is left empty (it keeps its block size and cache
+     *  capacity).
+     *
+     *  @param[in,out] other The model to take the state of.
+     *
+     *  @throw None No throw guarantee.
+     */
+    CompressedModel(CompressedModel&& other) noexcept :
+      CompressedStorage(std::move(other)),
+      holder_type(std::move(other)),
+      m_size_(std::exchange(other.m_size_, 0)),
+      m_block_size_(other.m_block_size_),
+      m_cache_capacity_(other.m_cache_capacity_),
+      m_blocks_(std::move(other.m_blocks_)),
+      m_cache_(std::move(other.m_cache_)) {
+        other.m_blocks_.clear();
+        other.m_cache_.clear();
+    }
+
+    /** @brief Overrides the state of *this with the state of @p other.
+     *
+     *  @param[in,out] other The model to take the state of. Left empty.
+     *
+     *  @return *this after taking the state of @p other.
+     *
+     *  @throw None No throw guarantee.
+     */
+    CompressedModel& operator=(CompressedModel&& other) noexcept {
+        if(this != &other) {
+            holder_type::operator=(std::move(other));
+            m_size_           = std::exchange(other.m_size_, 0);
+            m_block_size_     = other.m_block_size_;
+            m_cache_capacity_ = other.m_cache_capacity_;
+            m_blocks_         = std::move(other.m_blocks_);
+            m_cache_          = std::move(other.m_cache_);
+            other.m_blocks_.clear();
+            other.m_cache_.clear();
+        }
+        return *this;
+    }
+
+    /** @brief Returns the element at index @p idx for reading and writing.
+     *
+     *  Marks the element's block dirty.
+     *
+     *  @param[in] idx The index of the element.
+     *
+     *  @return A reference to the cached element, valid until its block is
+     *          evicted.
+     *
+     *  @throw std::out_of_range if @p idx is out of range. Strong throw
+     *                           guarantee.
+     *  @throw std::bad_alloc if decompressing the block fails. Strong throw
+     *                        guarantee.
+     */
+    reference get_element(size_type idx) {
+        this->assert_in_range(idx);
+        auto& entry = fetch_(idx / m_block_size_);
+        entry.dirty = true;
+        return entry.values[idx % m_block_size_];
+    }
+
+    /** @brief Returns the element at index @p idx for reading.
+     *
+     *  @param[in] idx The index of the element.
+     *
+     *  @return A read-only reference to the cached element, valid until its
+     *          block is evicted.
+     *
+     *  @throw std::out_of_range if @p idx is out of range. Strong throw
+     *                           guarantee.
+     *  @throw std::bad_alloc if decompressing the block fails. Strong throw
+     *                        guarantee.
+     */
+    const_reference get_element(size_type idx) const {
+        this->assert_in_range(idx);
+        return fetch_(idx / m_block_size_).values[idx % m_block_size_];
+    }
+
+    /** @brief Calls @p fxn with each block, in order, for reading and writing.
+     *
+     *  @tparam FxnType The type of @p fxn. Must be callable with span_type.
+     *
+     *  Each block is decompressed into the cache, passed to @p fxn as a
+     *  span_type, and marked dirty.
+     *
+     *  @param[in] fxn The function to call.
+     *
+     *  @throw std::bad_alloc if decompressing a block fails. Weak throw
+     *                        guarantee.
+     *  @throw ??? if @p fxn throws. Weak throw guarantee.
+     */
+    template<typename FxnType>
+    void for_each_block(FxnType&& fxn) {
+        for(size_type b = 0; b < n_blocks(); ++b) {
+            auto& entry = fetch_(b);
+            entry.dirty = true;
+            fxn(span_type(entry.values));
+        }
+    }
+
+    /** @brief Calls @p fxn with each block, in order, for reading.
+     *
+     *  @tparam FxnType The type of @p fxn. Must be callable with
+     *                  const_span_type.
+     *
+     *  Cached blocks are passed straight from the cache, the others are
+     *  decompressed into a scratch buffer, so visiting does not evict blocks
+     *  other code may be using.
+     *
+     *  @param[in] fxn The function to call.
+     *
+     *  @throw std::bad_alloc if decompressing a block fails. Strong throw
+     *                        guarantee.
+     *  @throw ??? if @p fxn throws. Same throw guarantee.
+     */
+    template<typename FxnType>
+    void for_each_block(FxnType&& fxn) const {
+        vector_type scratch;
+        for(size_type b = 0; b < n_blocks(); ++b) fxn(read_block_(b, scratch));
+    }
+
+    /** @brief Decompresses every element.
+     *
+     *  @return The elements of *this, in order.
+     *
+     *  @throw std::bad_alloc if allocating the result fails. Strong throw
+     *                        guarantee.
+     */
+    vector_type decompress() const {
+        vector_type values;
+        values.reserve(m_size_);
+        for_each_block([&](const_span_type block) {
+            values.insert(values.end(), block.begin(), block.end());
+        });
+        return values;
+    }
+
+    /** @brief Recompresses the dirty blocks in the cache.
+     *
+     *  Blocks stay cached (now clean). The elements do not change, so this is
+     *  logically const.
+     *
+     *  @throw std::bad_alloc if compressing a block fails. Weak throw
+     *                        guarantee.
+     */
+    void flush() const override {
+        for(auto& entry : m_cache_) {
+            if(!entry.dirty) continue;
+            m_blocks_[entry.index] = compress_(entry.values);
+            entry.dirty            = false;
+        }
+    }
+
+    /// The number of blocks the elements are split into
+    size_type n_blocks() const noexcept {
+        return (m_size_ + m_block_size_ - 1) / m_block_size_;
+    }
+
+    /// Sums the size of the compressed blocks. Dirty blocks are not counted
+    /// at their new size until they are flushed.
+    size_type compressed_size() const override {
+        size_type n = 0;
+        for(const auto& block : m_blocks_) n += block.size();
+        return n;
+    }
+
+    /// The number of elements per block
+    size_type block_size() const noexcept override { return m_block_size_; }
+
+    /// The maximum number of cached blocks
+    size_type cache_capacity() const noexcept override {
+        return m_cache_capacity_;
+    }
+
+    /** @brief Compares the elements of *this and @p other.
+     *
+     *  @param[in] other The model to compare to.
+     *
+     *  @return True if *this and @p other hold the same elements in the same
+     *          order (block sizes may differ), false otherwise.
+     *
+     *  @throw std::bad_alloc if decompressing fails. Strong throw guarantee.
+     */
+    bool operator==(const CompressedModel& other) const {
+        if(m_size_ != other.m_size_) return false;
+        if(m_block_size_ != other.m_block_size_)
+            return decompress() == other.decompress();
+        vector_type scratch, other_scratch;
+        for(size_type b = 0; b < n_blocks(); ++b) {
+            auto lhs = read_block_(b, scratch);
+            auto rhs = other.read_block_(b, other_scratch);
+            if(!std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()))
+                return false;
+        }
+        return true;
+    }
+
+private:
+    /// A decompressed block
+    struct CacheEntry {
+        /// Which block this is
+        size_type index;
+
+        /// The decompressed elements
+        vector_type values;
+
+        /// Were the values possibly modified?
+        bool dirty = false;
+    };
+
+    /// Type of the cache, most recently used entry first
+    using cache_type = std::list<CacheEntry>;
+
+    /// Number of elements in block @p b (only the last may be short)
+    size_type n_in_block_(size_type b) const noexcept {
+        return std::min(m_block_size_, m_size_ - b * m_block_size_);
+    }
+
+    /// Compresses @p values
+    static byte_vector compress_(const vector_type& values) {
+        return compress_block(std::as_bytes(std::span(values)),
+                              sizeof(FloatType));
+    }
+
+    /// Decompresses block @p b into @p values
+    void decompress_(size_type b, vector_type& values) const {
+        values.resize(n_in_block_(b));
+        auto bytes = std::as_writable_bytes(span_type(values));
+        decompress_block(m_blocks_[b], bytes, sizeof(FloatType));
+    }
+
+    /// Returns block @p b from the cache, or decompressed into @p scratch
+    const_span_type read_block_(size_type b, vector_type& scratch) const {
+        for(const auto& entry : m_cache_)
+            if(entry.index == b) return entry.values;
+        decompress_(b, scratch);
+        return scratch;
+    }
+
+    /// Moves block @p b to the front of the cache, decompressing if needed
+    CacheEntry& fetch_(size_type b) const {
+        // The cache is small, so a linear search beats a hash map
+        auto itr = std::find_if(m_cache_.begin(), m_cache_.end(),
+                                [b](const auto& entry) {
+                                    return entry.index == b;
+                                });
+        if(itr != m_cache_.end()) {
+            m_cache_.splice(m_cache_.begin(), m_cache_, itr);
+            return m_cache_.front();
+        }
+
+        if(m_cache_.size() < m_cache_capacity_) {
+            CacheEntry entry{b, {}, false};
+            decompress_(b, entry.values);
+            m_cache_.push_front(std::move(entry));
+            return m_cache_.front();
+        }
+
+        // Evict the least recently used entry, reusing its memory
+        auto& victim = m_cache_.back();
+        if(victim.dirty) {
+            m_blocks_[victim.index] = compress_(victim.values);
+            victim.dirty            = false;
+        }
+        try {
+            decompress_(b, victim.values);
+        } catch(...) {
+            m_cache_.pop_back(); // Victim is clean, dropping it loses nothing
+            throw;
+        }
+        victim.index = b;
+        m_cache_.splice(m_cache_.begin(), m_cache_, std::prev(m_cache_.end()));
+        return m_cache_.front();
+    }
+
+    /// Clones *this polymorphically
+    holder_type* clone_() const override { return new CompressedModel(*this); }
+
+    /// Creates a mutable view which forwards to *this
+    buffer_view_holder* as_view_() override {
+        return new IndirectViewModel<fp::Float>(this);
+    }
+
+    /// Creates a read-only view which forwards to *this
+    const_buffer_view_holder* as_view_() const override {
+        return new IndirectViewModel<const fp::Float>(this);
+    }
+
+    /// Wraps get_element in a view
+    view_type at_(size_type index) override {
+        return view_type(get_element(index));
+    }
+
+    /// Wraps get_element in a read-only view
+    const_view_type at_(size_type index) const override {
+        return const_view_type(get_element(index));
+    }
+
+    /// The number of elements
+    size_type size_() const noexcept override { return m_size_; }
+
+    /// The elements are never read-only
+    bool is_const_() const noexcept override { return false; }
+
+    /// Elements are only contiguous within a block
+    bool is_contiguous_() const override { return false; }
+
+    /// Dispatches to operator==
+    bool are_equal_(const holder_type& other) const override {
+        if(auto pother = dynamic_cast<const CompressedModel*>(&other)) {
+            return *this == *pother;
+        }
+        return false;
+    }
+
+    /// The number of elements
+    size_type m_size_;
+
+    /// The number of elements per block
+    size_type m_block_size_;
+
+    /// The maximum number of cached blocks
+    size_type m_cache_capacity_;
+
+    /// The compressed blocks (mutable so evictions can write dirty blocks)
+    mutable std::vector<byte_vector> m_blocks_;
+
+    /// The decompressed blocks, most recently used first
+    mutable cache_type m_cache_;
+};
+
+} // namespace wtf::buffer::detail_
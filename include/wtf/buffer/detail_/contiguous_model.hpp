@@ -15,7 +15,14 @@
  */
 
 #pragma once
+#include <algorithm>
+#include <memory>
 #include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <wtf/buffer/copy_engine.hpp>
 #include <wtf/buffer/detail_/buffer_holder.hpp>
 #include <wtf/buffer/detail_/contiguous_view_model.hpp>
 #include <wtf/concepts/floating_point.hpp>
@@ -60,6 +67,9 @@ public:
     /// Type used to manage the floating-point buffer
     using vector_type = std::vector<std::decay_t<FloatType>>;
 
+    /// Type used to alias the elements, regardless of who owns them
+    using span_type = std::span<std::decay_t<FloatType>>;
+
     /** @brief Takes ownership of @p buffer.
      *
      *  Internally ContiguousModel stores the buffer as an object of type
@@ -73,7 +83,88 @@ public:
      */
     explicit ContiguousModel(vector_type buffer) :
       holder_type(rtti::wtf_typeid<unqualified_type>()),
-      m_buffer_(std::move(buffer)) {}
+      m_buffer_(std::move(buffer)),
+      m_span_(m_buffer_.data(), m_buffer_.size()) {}
+
+    /** @brief Makes a deep copy of @p other.
+     *
+     *  The copy always owns its elements via a vector_type, even if @p other
+     *  is a derived model which gets its memory from somewhere else (e.g., a
+     *  memory-mapped file). This is what allows derived models to rely on the
+     *  clone() implementation provided by this class. Large buffers of
+     *  trivially copyable elements are copied with the copy engine (see
+     *  copy_strategy).
+     *
+     *  @param[in] other The model to copy.
+     *
+     *  @throw std::bad_alloc if allocating the copy fails. Strong throw
+     *                        guarantee.
+     */
+    ContiguousModel(const ContiguousModel& other) : holder_type(other) {
+        copy_(other.m_span_);
+    }
+
+    /** @brief Overrides the state of *this with a deep copy of @p other.
+     *
+     *  If *this owns its elements, @p other has as many, and they are
+     *  trivially copyable, they are copied in place (no allocation).
+     *
+     *  @param[in] other The model to copy.
+     *
+     *  @return *this after overwriting its state with a copy of @p other.
+     *
+     *  @throw std::bad_alloc if allocating the copy fails. Strong throw
+     *                        guarantee.
+     */
+    ContiguousModel& operator=(const ContiguousModel& other) {
+        if(this != &other) {
+            if constexpr(std::is_trivially_copyable_v<unqualified_type>) {
+                if(owns_() && m_span_.size() == other.m_span_.size()) {
+                    copy_bytes(m_span_.data(), other.m_span_.data(),
+                               other.m_span_.size_bytes());
+                    return *this;
+                }
+            }
+            copy_(other.m_span_);
+        }
+        return *this;
+    }
+
+    /** @brief Takes the state of @p other.
+     *
+     *  Moving the owners does not invalidate the span. @p other is left
+     *  empty, so it no longer aliases the elements.
+     *
+     *  @param[in,out] other The model to take the state of.
+     *
+     *  @throw None No throw guarantee.
+     */
+    ContiguousModel(ContiguousModel&& other) noexcept :
+      holder_type(std::move(other)),
+      m_buffer_(std::move(other.m_buffer_)),
+      m_raw_(std::move(other.m_raw_)),
+      m_raw_capacity_(std::exchange(other.m_raw_capacity_, 0)),
+      m_span_(std::exchange(other.m_span_, span_type{})) {}
+
+    /** @brief Overrides the state of *this with the state of @p other.
+     *
+     *  @param[in,out] other The model to take the state of. Left empty.
+     *
+     *  @return *this after taking the state of @p other.
+     *
+     *  @throw None No throw guarantee.
+     */
+    ContiguousModel& operator=(ContiguousModel&& other) noexcept {
+        if(this != &other) {
+            holder_type::operator=(std::move(other));
+            m_buffer_ = std::move(other.m_buffer_);
+            other.m_buffer_.clear();
+            m_raw_          = std::move(other.m_raw_);
+            m_raw_capacity_ = std::exchange(other.m_raw_capacity_, 0);
+            m_span_         = std::exchange(other.m_span_, span_type{});
+        }
+        return *this;
+    }
 
     /** @brief Returns the typed element at index @p idx.
      *
@@ -89,7 +180,7 @@ public:
      */
     reference get_element(size_type idx) {
         assert_in_range(idx);
-        return m_buffer_[idx];
+        return m_span_[idx];
     }
 
     /** @brief Provides read-only access to an element.
@@ -106,7 +197,7 @@ public:
      */
     const_reference get_element(size_type idx) const {
         assert_in_range(idx);
-        return m_buffer_[idx];
+        return m_span_[idx];
     }
 
     /** @brief Returns a mutable pointer to the underlying buffer.
@@ -115,7 +206,7 @@ public:
      *
      *  @throw None No-throw guarantee.
      */
-    pointer data() { return m_buffer_.data(); }
+    pointer data() { return m_span_.data(); }
 
     /** @brief Returns a read-only pointer to the underlying buffer.
      *
@@ -123,7 +214,7 @@ public:
      *
      *  @throw None No-throw guarantee.
      */
-    const_pointer data() const { return m_buffer_.data(); }
+    const_pointer data() const { return m_span_.data(); }
 
     /** @brief Returns the wrapped data as a std::span.
      *
@@ -147,6 +238,56 @@ public:
      */
     auto span() const { return std::span<const FloatType>(data(), size()); }
 
+    /** @brief Returns how many elements *this can hold without reallocating.
+     *
+     *  Only memory owned by *this counts. Models aliasing memory they do not
+     *  own (e.g., memory maps) have a capacity of 0.
+     *
+     *  @return The number of elements the owned memory can hold.
+     *
+     *  @throw None No-throw guarantee.
+     */
+    size_type capacity() const noexcept {
+        return m_raw_ ? m_raw_capacity_ : m_buffer_.capacity();
+    }
+
+    /** @brief Changes the number of elements to @p n.
+     *
+     *  No memory is allocated if @p n is not larger than capacity(). Elements
+     *  which were already present keep their values, new elements are
+     *  value-initialized.
+     *
+     *  @param[in] n The new number of elements.
+     *
+     *  @throw std::logic_error if *this does not own its elements. Strong
+     *                          throw guarantee.
+     *  @throw std::bad_alloc if reallocating fails. Strong throw guarantee.
+     */
+    void resize(size_type n) {
+        if(!owns_()) {
+            throw std::logic_error(
+              "ContiguousModel: can not resize memory it does not own");
+        }
+        if(m_raw_) {
+            auto* p = m_raw_.get();
+            if(n <= m_raw_capacity_) {
+                if(n > m_span_.size())
+                    std::fill(p + m_span_.size(), p + n, unqualified_type{});
+                m_span_ = span_type(p, n);
+                return;
+            }
+            vector_type temp;
+            temp.reserve(n);
+            temp.assign(m_span_.begin(), m_span_.end());
+            temp.resize(n);
+            m_buffer_.swap(temp);
+            m_raw_.reset();
+        } else {
+            m_buffer_.resize(n);
+        }
+        m_span_ = span_type(m_buffer_.data(), m_buffer_.size());
+    }
+
     /** @brief Compares the elements in the buffer for exact equality.
      *
      *  Value equal is defined as having the same elements in the same order.
@@ -160,37 +301,93 @@ public:
      *  @throw None No-throw guarantee.
      */
     bool operator==(const ContiguousModel& other) const {
-        return m_buffer_ == other.m_buffer_;
+        return std::equal(m_span_.begin(), m_span_.end(),
+                          other.m_span_.begin(), other.m_span_.end());
     }
 
+protected:
+    /** @brief Aliases @p buffer, whose memory is managed by the derived class.
+     *
+     *  This ctor is used by derived models which obtain their memory from
+     *  somewhere other than a vector_type (e.g., a memory-mapped file). The
+     *  derived class is responsible for keeping the memory alive for as long
+     *  as *this exists.
+     *
+     *  @param[in] buffer The memory *this should expose.
+     *
+     *  @throw std::bad_alloc if creating the RTTI information fails. Strong
+     *                        throw guarantee.
+     */
+    explicit ContiguousModel(span_type buffer) :
+      holder_type(rtti::wtf_typeid<unqualified_type>()), m_span_(buffer) {}
+
 private:
+    /// Does *this own the memory m_span_ aliases?
+    bool owns_() const noexcept {
+        const auto* p = m_span_.data();
+        return p == m_buffer_.data() || p == m_raw_.get();
+    }
+
+    /** @brief Replaces the elements of *this with copies of @p values.
+     *
+     *  Large copies of trivially copyable elements go through the copy
+     *  engine into memory which is not initialized first (a vector_type
+     *  would value-initialize, i.e., write, every element before the copy
+     *  overwrites it). Since the copy engine runs in parallel, the pages of
+     *  the new memory are also faulted in in parallel.
+     *
+     *  @param[in] values The elements to copy.
+     *
+     *  @throw std::bad_alloc if allocating the copy fails. Strong throw
+     *                        guarantee.
+     */
+    void copy_(span_type values) {
+        const auto n = values.size();
+        if constexpr(std::is_trivially_copyable_v<unqualified_type>) {
+            if(copy_strategy(values.size_bytes()) != CopyStrategy::serial) {
+                using raw_type = unqualified_type[];
+                auto raw       = std::make_unique_for_overwrite<raw_type>(n);
+                copy_bytes(raw.get(), values.data(), values.size_bytes());
+                vector_type().swap(m_buffer_);
+                m_raw_          = std::move(raw);
+                m_raw_capacity_ = n;
+                m_span_         = span_type(m_raw_.get(), n);
+                return;
+            }
+        }
+        vector_type temp(values.begin(), values.end());
+        m_buffer_.swap(temp);
+        m_raw_.reset();
+        m_span_ = span_type(m_buffer_.data(), m_buffer_.size());
+    }
+
     /// Clones *this polymorphically
     holder_type* clone_() const override { return new ContiguousModel(*this); }
 
     /// Creates a mutable view_holder to *this
     buffer_view_holder* as_view_() override {
         using view_model = ContiguousViewModel<FloatType>;
-        return new view_model(m_buffer_.data(), this->size());
+        return new view_model(m_span_.data(), this->size());
     }
 
     /// Creates an immutable view_holder to *this
     const_buffer_view_holder* as_view_() const override {
         using const_view_model = ContiguousViewModel<const FloatType>;
-        return new const_view_model(m_buffer_.data(), this->size());
+        return new const_view_model(m_span_.data(), this->size());
     }
 
-    /// Calls vector_type's operator[]
+    /// Calls span_type's operator[]
     view_type at_(size_type index) override {
-        return view_type(m_buffer_[index]);
+        return view_type(m_span_[index]);
     }
 
-    /// Calls vector_type's operator[]const
+    /// Calls span_type's operator[], but returns a read-only view
     const_view_type at_(size_type index) const override {
-        return const_view_type(m_buffer_[index]);
+        return const_view_type(std::as_const(m_span_[index]));
     }
 
-    /// Calls vector_type's size()
-    size_type size_() const noexcept override { return m_buffer_.size(); }
+    /// Calls span_type's size()
+    size_type size_() const noexcept override { return m_span_.size(); }
 
     /// Checks FloatType for "const"
     bool is_const_() const noexcept override {
@@ -208,8 +405,17 @@ private:
         return false;
     }
 
-    /// The held buffer
+    /// The held buffer (empty if a derived class manages the memory)
     vector_type m_buffer_;
+
+    /// Holds the elements instead of m_buffer_ after a large copy
+    std::unique_ptr<unqualified_type[]> m_raw_;
+
+    /// How many elements m_raw_ can hold
+    size_type m_raw_capacity_ = 0;
+
+    /// The elements of *this
+    span_type m_span_;
 };
 
 /** @brief Wraps the process of calling a visitor with zero or more
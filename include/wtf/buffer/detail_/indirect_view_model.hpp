@@ -0,0 +1,125 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <type_traits>
+#include <wtf/buffer/detail_/buffer_holder.hpp>
+#include <wtf/buffer/detail_/buffer_view_holder.hpp>
+#include <wtf/fp/float.hpp>
+
+namespace wtf::buffer::detail_ {
+
+/** @brief Aliases a buffer which does not store its elements contiguously.
+ *
+ *  @tparam FloatType Either fp::Float or const fp::Float depending on whether
+ *                    the view is mutable or read-only.
+ *
+ *  ContiguousViewModel aliases memory directly, which is not possible for
+ *  buffers whose elements only exist on demand (e.g., CompressedModel). This
+ *  model instead holds a pointer to the aliased BufferHolder and forwards
+ *  element access to it, so any BufferHolder can be viewed. The aliased holder
+ *  must outlive *this.
+ */
+template<concepts::WTFFloat FloatType>
+class IndirectViewModel : public BufferViewHolder<FloatType> {
+private:
+    /// Is *this a read-only view?
+    static constexpr bool m_is_const = std::is_const_v<FloatType>;
+
+    /// Type of a model which is a read-only view
+    using const_model_type = IndirectViewModel<const FloatType>;
+
+public:
+    /// Type *this inherits from
+    using holder_type = BufferViewHolder<FloatType>;
+
+    /// Pull in types from the base class
+    ///@{
+    using const_holder_type = typename holder_type::const_holder_type;
+    using size_type         = typename holder_type::size_type;
+    using view_type         = typename holder_type::view_type;
+    using const_view_type   = typename holder_type::const_view_type;
+    ///@}
+
+    /// Type of a pointer to the aliased buffer
+    using buffer_pointer =
+      std::conditional_t<m_is_const, const BufferHolder*, BufferHolder*>;
+
+    /** @brief Aliases the buffer held by @p pbuffer.
+     *
+     *  @param[in] pbuffer The buffer to alias. Must be non-null.
+     *
+     *  @throw std::bad_alloc if copying the RTTI fails. Strong throw
+     *                        guarantee.
+     */
+    explicit IndirectViewModel(buffer_pointer pbuffer) :
+      holder_type(pbuffer->type()), m_pbuffer_(pbuffer) {}
+
+    /** @brief Compares the elements of *this and @p other.
+     *
+     *  @param[in] other The view to compare to.
+     *
+     *  @return True if *this and @p other have the same size and compare
+     *          equal element by element, false otherwise.
+     *
+     *  @throw std::bad_alloc if accessing an element needs to allocate and
+     *                        that fails. Strong throw guarantee.
+     */
+    bool operator==(const holder_type& other) const {
+        if(this->size() != other.size()) return false;
+        for(size_type i = 0; i < this->size(); ++i)
+            if(this->at(i) != other.at(i)) return false;
+        return true;
+    }
+
+private:
+    /// Copies the pointer to the aliased buffer
+    holder_type* clone_() const override {
+        return new IndirectViewModel(*this);
+    }
+
+    /// Makes a read-only alias of the same buffer
+    const_holder_type* const_clone_() const override {
+        return new const_model_type(m_pbuffer_);
+    }
+
+    /// Forwards to the aliased buffer
+    view_type at_(size_type index) override { return m_pbuffer_->at(index); }
+
+    /// Forwards to the aliased buffer, read-only
+    const_view_type at_(size_type index) const override {
+        return std::as_const(*m_pbuffer_).at(index);
+    }
+
+    /// Forwards to the aliased buffer
+    size_type size_() const noexcept override { return m_pbuffer_->size(); }
+
+    /// Read-only iff FloatType is const
+    bool is_const_() const noexcept override { return m_is_const; }
+
+    /// The aliased buffer is never contiguous (else use ContiguousViewModel)
+    bool is_contiguous_() const override { return false; }
+
+    /// Element-wise comparison with any other view of the same type
+    bool are_equal_(const holder_type& other) const override {
+        return *this == other;
+    }
+
+    /// The aliased buffer
+    buffer_pointer m_pbuffer_;
+};
+
+} // namespace wtf::buffer::detail_
@@ -0,0 +1,134 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <type_traits>
+#include <wtf/buffer/detail_/contiguous_model.hpp>
+#include <wtf/io/memory_map.hpp>
+
+namespace wtf::buffer::detail_ {
+
+/** @brief Owns the memory map of a MappedModel.
+ *
+ *  This class is the non-template part of MappedModel. It serves two
+ *  purposes. First, because it is the first base class of MappedModel, the
+ *  memory map is created before the ContiguousModel base class, which aliases
+ *  the mapped memory. Second, it allows code which does not know the type of
+ *  the elements (e.g., flush(FloatBuffer&)) to get at the memory map by
+ *  cross-casting a BufferHolder to a MappedStorage.
+ */
+class MappedStorage {
+public:
+    /// Type of the object managing the mapped memory
+    using memory_map_type = io::MemoryMap;
+
+    /** @brief Takes ownership of @p map.
+     *
+     *  @param[in] map The memory map *this will own.
+     *
+     *  @throw None No throw guarantee.
+     */
+    explicit MappedStorage(memory_map_type map) noexcept :
+      m_map_(std::move(map)) {}
+
+    /// Default virtual dtor, unmaps the memory
+    virtual ~MappedStorage() = default;
+
+    /** @brief Provides access to the memory map.
+     *
+     *  @return A reference to the memory map owned by *this.
+     *
+     *  @throw None No throw guarantee.
+     */
+    memory_map_type& memory_map() noexcept { return m_map_; }
+
+    /** @brief Provides read-only access to the memory map.
+     *
+     *  @return A read-only reference to the memory map owned by *this.
+     *
+     *  @throw None No throw guarantee.
+     */
+    const memory_map_type& memory_map() const noexcept { return m_map_; }
+
+private:
+    /// The memory map holding the elements
+    memory_map_type m_map_;
+};
+
+/** @brief Models a contiguous buffer whose elements live in a mapped file.
+ *
+ *  @tparam FloatType The type of the elements. Must satisfy the
+ *                    concepts::FloatingPoint concept and be trivially
+ *                    copyable (the bytes in the file ARE the elements).
+ *
+ *  This class derives from ContiguousModel so that everything which works
+ *  with a ContiguousModel (dispatch, visit_contiguous_buffer,
+ *  FloatBuffer::value, etc.) also works with memory-mapped buffers. Copying
+ *  a MappedModel (e.g., by copying the FloatBuffer holding it) produces an
+ *  in-memory ContiguousModel holding a copy of the elements; the file is
+ *  only ever aliased by the original MappedModel.
+ */
+template<concepts::FloatingPoint FloatType>
+class MappedModel : public MappedStorage, public ContiguousModel<FloatType> {
+private:
+    /// Type of the base class which implements the buffer
+    using base_type = ContiguousModel<FloatType>;
+
+public:
+    static_assert(std::is_trivially_copyable_v<FloatType>,
+                  "Only trivially copyable types can be memory mapped");
+
+    /// Pull in types from the base classes
+    ///@{
+    using typename MappedStorage::memory_map_type;
+    using typename base_type::span_type;
+    using typename base_type::unqualified_type;
+    ///@}
+
+    /** @brief Exposes the memory mapped by @p map as a buffer.
+     *
+     *  @param[in] map A memory map whose first byte is the first element of
+     *                 the buffer. The size of the mapping must be a multiple
+     *                 of sizeof(FloatType).
+     *
+     *  @throw std::invalid_argument if the size of @p map is not a multiple
+     *                               of sizeof(FloatType). Strong throw
+     *                               guarantee.
+     *  @throw std::bad_alloc if creating the RTTI information fails. Strong
+     *                        throw guarantee.
+     */
+    explicit MappedModel(memory_map_type map) :
+      MappedStorage(std::move(map)), base_type(make_span_(memory_map())) {}
+
+    /// Not copyable, FloatBuffer copies go through clone()
+    ///@{
+    MappedModel(const MappedModel&)            = delete;
+    MappedModel& operator=(const MappedModel&) = delete;
+    ///@}
+
+private:
+    /// Reinterprets the mapped bytes as elements
+    static span_type make_span_(memory_map_type& map) {
+        if(map.size() % sizeof(FloatType) != 0) {
+            throw std::invalid_argument(
+              "Mapped region is not a whole number of elements");
+        }
+        auto* p = reinterpret_cast<unqualified_type*>(map.data());
+        return span_type(p, map.size() / sizeof(FloatType));
+    }
+};
+
+} // namespace wtf::buffer::detail_
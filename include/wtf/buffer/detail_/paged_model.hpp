@@ -0,0 +1,127 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+#include <type_traits>
+#include <wtf/buffer/detail_/contiguous_model.hpp>
+#include <wtf/buffer/page_allocation.hpp>
+
+namespace wtf::buffer::detail_ {
+
+/** @brief Owns the memory of a PagedModel.
+ *
+ *  This is the non-template part of PagedModel. It plays the same role for
+ *  PagedModel that MappedStorage plays for MappedModel. It is the first base
+ *  class, so the memory exists before the ContiguousModel base aliases it.
+ *  Code which does not know the element type can reach the allocation by
+ *  cross-casting a BufferHolder to a PagedStorage.
+ */
+class PagedStorage {
+public:
+    /// Type of the object managing the memory
+    using allocation_type = PageAllocation;
+
+    /** @brief Takes ownership of @p pages.
+     *
+     *  @param[in] pages The memory *this will own.
+     *
+     *  @throw None No throw guarantee.
+     */
+    explicit PagedStorage(allocation_type pages) noexcept :
+      m_pages_(std::move(pages)) {}
+
+    /// Default virtual dtor, frees the memory
+    virtual ~PagedStorage() = default;
+
+    /** @brief Provides access to the allocation.
+     *
+     *  @return A reference to the allocation owned by *this.
+     *
+     *  @throw None No throw guarantee.
+     */
+    allocation_type& page_allocation() noexcept { return m_pages_; }
+
+    /** @brief Provides read-only access to the allocation.
+     *
+     *  @return A read-only reference to the allocation owned by *this.
+     *
+     *  @throw None No throw guarantee.
+     */
+    const allocation_type& page_allocation() const noexcept { return m_pages_; }
+
+private:
+    /// The memory holding the elements
+    allocation_type m_pages_;
+};
+
+/** @brief Models a contiguous buffer whose elements live in a PageAllocation.
+ *
+ *  @tparam FloatType The type of the elements. Must satisfy the
+ *                    concepts::FloatingPoint concept and be trivially
+ *                    copyable (the elements start out as zeroed bytes).
+ *
+ *  Like MappedModel, this class derives from ContiguousModel so that
+ *  dispatch, visit_contiguous_buffer, FloatBuffer::value, etc. all work.
+ *  Copying a PagedModel produces an ordinary in-memory ContiguousModel.
+ */
+template<concepts::FloatingPoint FloatType>
+class PagedModel : public PagedStorage, public ContiguousModel<FloatType> {
+private:
+    /// Type of the base class which implements the buffer
+    using base_type = ContiguousModel<FloatType>;
+
+public:
+    static_assert(std::is_trivially_copyable_v<FloatType>,
+                  "Only trivially copyable types can live in raw pages");
+
+    /// Pull in types from the base classes
+    ///@{
+    using typename PagedStorage::allocation_type;
+    using typename base_type::span_type;
+    using typename base_type::unqualified_type;
+    using size_type = typename base_type::size_type;
+    ///@}
+
+    /** @brief Allocates @p n zeroed elements.
+     *
+     *  @param[in] n The number of elements.
+     *  @param[in] options How to allocate the memory.
+     *
+     *  @throw std::system_error if the memory can not be allocated. Strong
+     *                           throw guarantee.
+     *  @throw std::bad_alloc if creating the RTTI information fails. Strong
+     *                        throw guarantee.
+     */
+    PagedModel(size_type n, allocation_type::Options options) :
+      PagedStorage(allocation_type(n * sizeof(FloatType), options)),
+      base_type(make_span_(page_allocation(), n)) {}
+
+    /// Not copyable, FloatBuffer copies go through clone()
+    ///@{
+    PagedModel(const PagedModel&)            = delete;
+    PagedModel& operator=(const PagedModel&) = delete;
+    ///@}
+
+private:
+    /// Reinterprets the allocated bytes as @p n elements
+    static span_type make_span_(allocation_type& pages, size_type n) {
+        auto* p = reinterpret_cast<unqualified_type*>(pages.data());
+        return span_type(p, n);
+    }
+};
+
+} // namespace wtf::buffer::detail_
@@ -0,0 +1,352 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include <wtf/buffer/detail_/paged_model.hpp>
+#include <wtf/buffer/float_buffer.hpp>
+#include <wtf/detail_/parallel_for.hpp>
+#include <wtf/detail_/visit_type_name.hpp>
+#include <wtf/fp/float.hpp>
+#include <wtf/parallel/executor.hpp>
+#include <wtf/rtti/type_info.hpp>
+
+namespace wtf::buffer {
+namespace detail_ {
+
+/// Buffers of at least this many bytes are allocated directly from the OS
+inline constexpr std::size_t min_paged_factory_bytes = std::size_t{1} << 20;
+
+/// Each thread filling a paged buffer gets at least this many bytes
+inline constexpr std::size_t min_fill_bytes_per_thread = std::size_t{1} << 22;
+
+/// Should a buffer of @p n elements of type @p T be allocated in pages?
+template<typename T>
+bool use_pages(std::size_t n) noexcept {
+    return n * sizeof(T) >= min_paged_factory_bytes;
+}
+
+/// Creates a PagedModel<T> holding @p n untouched, zeroed elements
+template<typename T>
+auto make_paged_model(std::size_t n) {
+    PageAllocation::Options options{};
+    return std::make_unique<PagedModel<T>>(n, options);
+}
+
+/// Number of threads used to fill @p n_bytes bytes
+inline std::size_t fill_threads(std::size_t n_bytes) noexcept {
+    const auto max_threads = std::max<std::size_t>(parallel::max_threads(), 1);
+    const auto n_threads   = n_bytes / min_fill_bytes_per_thread;
+    return std::clamp<std::size_t>(n_threads, 1, max_threads);
+}
+
+/** @brief Creates a buffer of @p n elements and sets them with @p fxn.
+ *
+ *  @tparam T The type of the elements.
+ *  @tparam FxnType Callable as `fxn(T* p, begin, end)`, it must set elements
+ *                  [begin, end) of @p p.
+ *
+ *  Large buffers of trivially copyable types live in pages obtained straight
+ *  from the OS. Those pages are already zero and are not touched until
+ *  @p fxn writes them, which it does in parallel using the static chunking of
+ *  wtf::detail_::parallel_for (so the pages also land on the NUMA node of
+ *  the thread which writes them). Other buffers are std::vector backed.
+ *
+ *  @param[in] n The number of elements.
+ *  @param[in] fxn The callable setting the elements.
+ *
+ *  @return The newly created buffer.
+ *
+ *  @throw std::system_error if the memory can not be allocated or a thread
+ *                           can not be started. Strong throw guarantee.
+ *  @throw ??? if @p fxn throws. Same throw guarantee.
+ */
+template<typename T, typename FxnType>
+FloatBuffer make_filled(std::size_t n, FxnType&& fxn) {
+    if constexpr(std::is_trivially_copyable_v<T>) {
+        if(use_pages<T>(n)) {
+            auto pmodel = make_paged_model<T>(n);
+            auto* p     = pmodel->data();
+            auto chunk  = [&](std::size_t begin, std::size_t end) {
+                fxn(p, begin, end);
+            };
+            wtf::detail_::parallel_for(n, fill_threads(n * sizeof(T)), chunk);
+            return FloatBuffer(std::move(pmodel));
+        }
+    }
+    std::vector<T> buffer(n);
+    fxn(buffer.data(), 0, n);
+    return FloatBuffer(std::move(buffer));
+}
+
+/// The type arithmetic on @p T produces (e.g., float for Half)
+template<typename T>
+using ramp_type_t =
+  std::decay_t<decltype(std::declval<const T&>() + std::declval<const T&>())>;
+
+/// Can iota and linspace compute values of type @p T?
+template<typename T>
+concept Rampable = requires(const T& a, std::size_t i, ramp_type_t<T> c) {
+    static_cast<ramp_type_t<T>>(a);
+    static_cast<ramp_type_t<T>>(i);
+    static_cast<T>(c);
+    c + c;
+    c - c;
+    c * c;
+    c / c;
+};
+
+/// Throws because iota/linspace were called for a type without arithmetic
+template<typename T>
+[[noreturn]] void throw_not_rampable(const char* fxn) {
+    throw std::runtime_error(std::string(fxn) + ": type " +
+                             type_traits::type_name_v<T> +
+                             " does not support arithmetic");
+}
+
+/// Calls @p visitor with std::type_identity<T> for the T held by @p type
+template<typename TupleType, typename Visitor>
+decltype(auto) visit_type_info(const rtti::TypeInfo& type, Visitor&& visitor) {
+    return wtf::detail_::visit_type_name<TupleType>(
+      type.name(), std::forward<Visitor>(visitor));
+}
+
+} // namespace detail_
+
+/** @brief Creates a buffer of @p n zeros of a type chosen at runtime.
+ *
+ *  @tparam TupleType A std::tuple of the types @p type may be. Must be
+ *                    explicitly provided by the caller.
+ *
+ *  Large buffers of trivially copyable types are backed by fresh pages from
+ *  the OS, which are zero without being written (like calloc). Creating such
+ *  a buffer is thus nearly free; the pages are faulted in when first used.
+ *  Otherwise, each element is value-initialized.
+ *
+ *  @param[in] type The type of the elements.
+ *  @param[in] prototype A Float whose type is used for the elements.
+ *  @param[in] n The number of elements.
+ *
+ *  @return A FloatBuffer holding @p n zeros.
+ *
+ *  @throw std::runtime_error if the type is not in @p TupleType. Strong throw
+ *                            guarantee.
+ *  @throw std::system_error if the memory can not be allocated. Strong throw
+ *                           guarantee.
+ */
+///@{
+template<typename TupleType>
+FloatBuffer zeros(const rtti::TypeInfo& type, std::size_t n) {
+    auto visitor = [n](auto id) {
+        using T = typename decltype(id)::type;
+        if constexpr(std::is_trivially_copyable_v<T>) {
+            if(detail_::use_pages<T>(n))
+                return FloatBuffer(detail_::make_paged_model<T>(n));
+        }
+        return FloatBuffer(std::vector<T>(n));
+    };
+    return detail_::visit_type_info<TupleType>(type, visitor);
+}
+
+template<typename TupleType>
+FloatBuffer zeros(const fp::Float& prototype, std::size_t n) {
+    return zeros<TupleType>(prototype.type_info(), n);
+}
+///@}
+
+/** @brief Creates a buffer of @p n elements whose values do not matter.
+ *
+ *  @tparam TupleType A std::tuple of the types @p type may be. Must be
+ *                    explicitly provided by the caller.
+ *
+ *  Use this for buffers which are about to be completely overwritten. Large
+ *  buffers of trivially copyable types are backed by untouched pages, so no
+ *  time is spent initializing them, and the pages end up on the NUMA node of
+ *  whichever thread first writes them. The values of the elements are
+ *  unspecified (in practice they are zero or default-constructed).
+ *
+ *  @param[in] type The type of the elements.
+ *  @param[in] prototype A Float whose type is used for the elements.
+ *  @param[in] n The number of elements.
+ *
+ *  @return A FloatBuffer holding @p n elements.
+ *
+ *  @throw std::runtime_error if the type is not in @p TupleType. Strong throw
+ *                            guarantee.
+ *  @throw std::system_error if the memory can not be allocated. Strong throw
+ *                           guarantee.
+ */
+///@{
+template<typename TupleType>
+FloatBuffer uninitialized(const rtti::TypeInfo& type, std::size_t n) {
+    // Fresh pages are zero, so zeros already skips the initialization
+    return zeros<TupleType>(type, n);
+}
+
+template<typename TupleType>
+FloatBuffer uninitialized(const fp::Float& prototype, std::size_t n) {
+    return uninitialized<TupleType>(prototype.type_info(), n);
+}
+///@}
+
+/** @brief Creates a buffer holding @p n copies of @p value.
+ *
+ *  @tparam TupleType A std::tuple of the types @p value may be. Must be
+ *                    explicitly provided by the caller.
+ *
+ *  The elements have the type of @p value. Large buffers are filled in
+ *  parallel, directly into untouched pages (see zeros).
+ *
+ *  @param[in] value The value of every element.
+ *  @param[in] n The number of elements.
+ *
+ *  @return A FloatBuffer holding @p n copies of @p value.
+ *
+ *  @throw std::runtime_error if the type of @p value is not in @p TupleType.
+ *                            Strong throw guarantee.
+ *  @throw std::system_error if the memory can not be allocated or a thread
+ *                           can not be started. Strong throw guarantee.
+ */
+template<typename TupleType>
+FloatBuffer fill(const fp::Float& value, std::size_t n) {
+    auto visitor = [n](const auto& v) {
+        using T  = std::decay_t<decltype(v)>;
+        auto fxn = [&v](T* p, std::size_t begin, std::size_t end) {
+            std::fill(p + begin, p + end, v);
+        };
+        return detail_::make_filled<T>(n, fxn);
+    };
+    return fp::visit_float<TupleType>(visitor, value);
+}
+
+/** @brief Creates the buffer @p start, @p start + 1, ..., @p start + n - 1.
+ *
+ *  @tparam TupleType A std::tuple of the types @p start may be. Must be
+ *                    explicitly provided by the caller.
+ *
+ *  The elements have the type of @p start (or @p type, in which case the
+ *  sequence starts at 0). Element i is computed directly as start + i, so
+ *  there is no accumulated round-off, and large buffers are filled in
+ *  parallel. Types without arithmetic of their own, like Half, are computed
+ *  in the type their arithmetic promotes to and then rounded.
+ *
+ *  @param[in] start The first element.
+ *  @param[in] type The type of the elements.
+ *  @param[in] n The number of elements.
+ *
+ *  @return A FloatBuffer holding the sequence.
+ *
+ *  @throw std::runtime_error if the type is not in @p TupleType or does not
+ *                            support arithmetic. Strong throw guarantee.
+ *  @throw std::system_error if the memory can not be allocated or a thread
+ *                           can not be started. Strong throw guarantee.
+ */
+///@{
+template<typename TupleType>
+FloatBuffer iota(const fp::Float& start, std::size_t n) {
+    auto visitor = [n](const auto& s) -> FloatBuffer {
+        using T = std::decay_t<decltype(s)>;
+        if constexpr(detail_::Rampable<T>) {
+            using C      = detail_::ramp_type_t<T>;
+            const auto c = static_cast<C>(s);
+            auto fxn     = [c](T* p, std::size_t begin, std::size_t end) {
+                for(auto i = begin; i < end; ++i)
+                    p[i] = static_cast<T>(c + static_cast<C>(i));
+            };
+            return detail_::make_filled<T>(n, fxn);
+        } else {
+            detail_::throw_not_rampable<T>("iota");
+        }
+    };
+    return fp::visit_float<TupleType>(visitor, start);
+}
+
+template<typename TupleType>
+FloatBuffer iota(const rtti::TypeInfo& type, std::size_t n) {
+    auto visitor = [n](auto id) {
+        using T = typename decltype(id)::type;
+        return iota<TupleType>(fp::Float(T{}), n);
+    };
+    return detail_::visit_type_info<TupleType>(type, visitor);
+}
+///@}
+
+/** @brief Creates a buffer of @p n evenly spaced values from @p start to
+ *         @p stop.
+ *
+ *  @tparam TupleType A std::tuple of the types @p start and @p stop may be.
+ *                    Must be explicitly provided by the caller.
+ *
+ *  Both end points are included. The step h = (stop - start) / (n - 1) is
+ *  computed once and element i is start + i * h, except for the last element,
+ *  which is set to exactly @p stop (start + (n - 1) * h may differ from it by
+ *  round-off). Each element is computed directly from its index, so there is
+ *  no accumulated round-off, and large buffers are filled in parallel. If @p n
+ *  is 1 the only element is @p start.
+ *
+ *  @param[in] start The first element.
+ *  @param[in] stop The last element. Must have the same type as @p start.
+ *  @param[in] n The number of elements.
+ *
+ *  @return A FloatBuffer holding the sequence.
+ *
+ *  @throw std::invalid_argument if @p start and @p stop have different types.
+ *                               Strong throw guarantee.
+ *  @throw std::runtime_error if the type is not in @p TupleType or does not
+ *                            support arithmetic. Strong throw guarantee.
+ *  @throw std::system_error if the memory can not be allocated or a thread
+ *                           can not be started. Strong throw guarantee.
+ */
+template<typename TupleType>
+FloatBuffer linspace(const fp::Float& start, const fp::Float& stop,
+                     std::size_t n) {
+    if(start.type_info() != stop.type_info()) {
+        throw std::invalid_argument("linspace: start and stop must have the "
+                                    "same type");
+    }
+    auto visitor = [n](const auto& a, const auto& b) -> FloatBuffer {
+        using T = std::decay_t<decltype(a)>;
+        using U = std::decay_t<decltype(b)>;
+        if constexpr(!std::is_same_v<T, U>) {
+            throw std::invalid_argument("linspace: types do not match");
+        } else if constexpr(detail_::Rampable<T>) {
+            using C      = detail_::ramp_type_t<T>;
+            const auto c = static_cast<C>(a);
+            const auto d = n > 1 ? static_cast<C>(n - 1) : static_cast<C>(1);
+            const auto h = (static_cast<C>(b) - c) / d;
+
+            auto fxn = [c, h, n, &b](T* p, std::size_t begin,
+                                     std::size_t end) {
+                for(auto i = begin; i < end; ++i)
+                    p[i] = static_cast<T>(c + static_cast<C>(i) * h);
+                if(n > 1 && end == n) p[n - 1] = b;
+            };
+            return detail_::make_filled<T>(n, fxn);
+        } else {
+            detail_::throw_not_rampable<T>("linspace");
+        }
+    };
+    return fp::visit_float<TupleType>(visitor, start, stop);
+}
+
+} // namespace wtf::buffer
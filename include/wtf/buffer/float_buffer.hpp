@@ -18,7 +18,9 @@
 #include <span>
 #include <wtf/buffer/buffer_view.hpp>
 #include <wtf/buffer/detail_/contiguous_model.hpp>
+#include <wtf/buffer/page_allocation.hpp>
 #include <wtf/concepts/iterator.hpp>
+#include <wtf/io/memory_map.hpp>
 
 namespace wtf::buffer {
 
@@ -117,6 +119,21 @@ public:
     template<concepts::FPIterator BeginItr, concepts::FPIterator EndItr>
     FloatBuffer(BeginItr&& begin, EndItr&& end);
 
+    /** @brief Creates a FloatBuffer which wraps an already created holder.
+     *
+     *  The other ctors create the holder and then dispatch to this ctor. This
+     *  ctor is public so that buffers backed by models other than
+     *  ContiguousModel (e.g., memory-mapped files) can be created. Most users
+     *  will want to use one of the other ctors.
+     *
+     *  @param[in] pholder The holder *this will own. May be null, in which
+     *                     case *this is an empty buffer.
+     *
+     *  @throw None No throw guarantee.
+     */
+    explicit FloatBuffer(holder_pointer pholder) noexcept :
+      m_pholder_(std::move(pholder)) {}
+
     /** @brief Creates a new FloatBuffer as a copy of @p other.
      *
      *  This ctor will initialize *this to hold a deep copy of @p other.
@@ -328,6 +345,32 @@ private:
     template<typename TupleType, typename Visitor, typename... Args>
     friend auto visit_contiguous_buffer(Visitor&& visitor, Args&&... args);
 
+    /// These need to inspect the holder to see if it is memory mapped
+    ///@{
+    friend bool is_mapped(const FloatBuffer& buffer) noexcept;
+    friend void flush(FloatBuffer& buffer);
+    friend void advise(FloatBuffer& buffer, io::MemoryMap::Advice advice);
+    ///@}
+
+    /// These need to inspect the holder to see if it is paged
+    ///@{
+    friend bool is_paged(const FloatBuffer& buffer) noexcept;
+    friend const PageAllocation& page_allocation(const FloatBuffer& buffer);
+    ///@}
+
+    /// These need to inspect the holder to see if it is compressed
+    ///@{
+    friend bool is_compressed(const FloatBuffer& buffer) noexcept;
+    friend std::size_t compressed_size(const FloatBuffer& buffer);
+    template<typename TupleType>
+    friend FloatBuffer decompress_float_buffer(const FloatBuffer& buffer);
+    template<typename TupleType, typename Visitor, typename BufferType>
+    friend void visit_buffer_chunks(Visitor&& visitor, BufferType&& buffer);
+    ///@}
+
+    /// Needs to recycle the held model
+    friend class BufferPool;
+
     holder_type& holder_() { return *m_pholder_; }
 
     const holder_type& holder_() const { return *m_pholder_; }
@@ -352,9 +395,6 @@ private:
     /// True if *this is actively type-erasing a buffer and false otherwise
     bool is_holding_() const noexcept { return m_pholder_ != nullptr; }
 
-    /// Other ctors create the holder and then dispatch to this ctor.
-    FloatBuffer(holder_pointer pholder) : m_pholder_(std::move(pholder)) {}
-
     /// The held type-erased buffer
     holder_pointer m_pholder_;
 };
@@ -0,0 +1,181 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <algorithm>
+#include <filesystem>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <wtf/buffer/detail_/mapped_model.hpp>
+#include <wtf/buffer/float_buffer.hpp>
+#include <wtf/detail_/visit_type_name.hpp>
+#include <wtf/io/file_header.hpp>
+#include <wtf/io/memory_map.hpp>
+
+namespace wtf::buffer {
+
+/// Passed as the count to map_float_buffer to map through the end of the file
+inline constexpr std::size_t all_elements =
+  std::numeric_limits<std::size_t>::max();
+
+/** @brief Creates a FloatBuffer whose elements live in a WTF buffer file.
+ *
+ *  @tparam TupleType A std::tuple of the floating-point types the file may
+ *                    hold. Must be explicitly provided by the caller.
+ *
+ *  The type of the elements is read from the file's header (see
+ *  io::FileHeader) and must be one of the types in @p TupleType. Elements are
+ *  paged in by the OS as they are accessed, so mapping a large file is cheap
+ *  and only the touched parts of it occupy memory. The returned buffer works
+ *  with visit_contiguous_buffer, FloatBuffer::value, etc. like any other
+ *  FloatBuffer. Copying it produces an ordinary in-memory FloatBuffer.
+ *
+ *  @param[in] path The file to map.
+ *  @param[in] mode Whether writes to the buffer should be written back to the
+ *                  file (read_write) or kept private (read_only). Default is
+ *                  read_only.
+ *  @param[in] first The index of the first element to map. Default is 0.
+ *  @param[in] count The maximum number of elements to map. Default is all
+ *                   elements from @p first to the end of the file.
+ *
+ *  @return A FloatBuffer aliasing the requested elements of the file.
+ *
+ *  @throw std::system_error if the file can not be read or mapped. Strong
+ *                           throw guarantee.
+ *  @throw std::runtime_error if the header is invalid, the elements are not
+ *                            one of the types in @p TupleType, or were
+ *                            written on a machine with a different byte
+ *                            order or element size, or if the sizes in the
+ *                            header overflow std::size_t. Strong throw
+ *                            guarantee.
+ *  @throw std::out_of_range if @p first is larger than the number of elements
+ *                           in the file. Strong throw guarantee.
+ */
+template<typename TupleType>
+FloatBuffer map_float_buffer(
+  const std::filesystem::path& path,
+  io::MemoryMap::Mode mode = io::MemoryMap::Mode::read_only,
+  std::size_t first = 0, std::size_t count = all_elements) {
+    const auto header = io::FileHeader::read(path);
+    if(header.endianness != io::FileHeader::native_endianness()) {
+        throw std::runtime_error(
+          "Can not map a buffer written with a different byte order");
+    }
+    if(first > header.size) {
+        throw std::out_of_range("First element is past the end of the file");
+    }
+    count = std::min(count, header.size - first);
+
+    auto lambda = [&](auto type_id) -> FloatBuffer {
+        using float_type = typename decltype(type_id)::type;
+        if constexpr(!std::is_trivially_copyable_v<float_type>) {
+            throw std::runtime_error("Type can not be memory mapped");
+        } else {
+            if(header.element_size != sizeof(float_type)) {
+                throw std::runtime_error("Element size does not match type");
+            }
+            using model_type = detail_::MappedModel<float_type>;
+            const auto n     = sizeof(float_type);
+            // A corrupt header must not wrap around the file size check
+            const auto max = std::numeric_limits<std::size_t>::max();
+            if(header.size > (max - header.data_offset()) / n) {
+                throw std::runtime_error("Header sizes overflow std::size_t");
+            }
+            io::MemoryMap map(path, mode, header.data_offset() + first * n,
+                              count * n);
+            return FloatBuffer(std::make_unique<model_type>(std::move(map)));
+        }
+    };
+    return wtf::detail_::visit_type_name<TupleType>(header.type_name, lambda);
+}
+
+/** @brief Creates a WTF buffer file and maps it for reading and writing.
+ *
+ *  @tparam T The type of the elements. Must be trivially copyable.
+ *
+ *  The file at @p path is created (or overwritten), given a header describing
+ *  @p n elements of type @p T, and sized to hold the elements, which are
+ *  initially zero. The elements are then mapped in read_write mode so that
+ *  values written to the returned buffer end up in the file. Call flush to
+ *  force the values to be written.
+ *
+ *  @param[in] path The file to create.
+ *  @param[in] n The number of elements the file should hold.
+ *
+ *  @return A FloatBuffer aliasing the elements of the new file.
+ *
+ *  @throw std::system_error if creating or mapping the file fails. Weak
+ *                           throw guarantee, the file may have been created.
+ */
+template<concepts::FloatingPoint T>
+FloatBuffer create_mapped_float_buffer(const std::filesystem::path& path,
+                                       std::size_t n) {
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "Only trivially copyable types can be memory mapped");
+    using model_type  = detail_::MappedModel<T>;
+    const auto header = io::FileHeader::make<T>(n);
+    header.create_file(path);
+    io::MemoryMap map(path, io::MemoryMap::Mode::read_write,
+                      header.data_offset(), header.data_size());
+    return FloatBuffer(std::make_unique<model_type>(std::move(map)));
+}
+
+/** @brief Is @p buffer backed by a memory-mapped file?
+ *
+ *  @param[in] buffer The buffer to inspect.
+ *
+ *  @return True if @p buffer was created by map_float_buffer or
+ *          create_mapped_float_buffer and false otherwise.
+ *
+ *  @throw None No throw guarantee.
+ */
+bool is_mapped(const FloatBuffer& buffer) noexcept;
+
+/** @brief Writes modified elements of a mapped buffer back to its file.
+ *
+ *  The OS will eventually write modified elements back on its own. This
+ *  function blocks until they are written, which is needed to guarantee the
+ *  file is up to date (e.g., before another process reads it). Flushing a
+ *  buffer mapped in read_only mode does nothing.
+ *
+ *  @param[in] buffer A buffer backed by a memory-mapped file.
+ *
+ *  @throw std::runtime_error if @p buffer is not memory mapped. Strong throw
+ *                            guarantee.
+ *  @throw std::system_error if writing the elements fails. Strong throw
+ *                           guarantee.
+ */
+void flush(FloatBuffer& buffer);
+
+/** @brief Tells the OS how the elements of a mapped buffer will be accessed.
+ *
+ *  For example, passing Advice::sequential before streaming through a buffer
+ *  lets the OS read ahead aggressively, and Advice::will_need asks the OS to
+ *  start paging the elements in now.
+ *
+ *  @param[in] buffer A buffer backed by a memory-mapped file.
+ *  @param[in] advice The expected access pattern.
+ *
+ *  @throw std::runtime_error if @p buffer is not memory mapped. Strong throw
+ *                            guarantee.
+ *  @throw std::system_error if the OS rejects the advice. Strong throw
+ *                           guarantee.
+ */
+void advise(FloatBuffer& buffer, io::MemoryMap::Advice advice);
+
+} // namespace wtf::buffer
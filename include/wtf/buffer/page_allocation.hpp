@@ -0,0 +1,202 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+#include <cstddef>
+
+namespace wtf::buffer {
+
+/** @brief RAII wrapper around anonymous memory obtained directly from the OS.
+ *
+ *  Random access into multi-GB buffers spends much of its time on TLB misses
+ *  when the memory is backed by 4 KiB pages. A PageAllocation maps its memory
+ *  with mmap so that it can ask for larger pages. In order of preference it
+ *  tries:
+ *
+ *  - huge_1gb / huge_2mb: explicit huge pages (MAP_HUGETLB). These must have
+ *    been reserved by the administrator (e.g., via /proc/sys/vm/nr_hugepages).
+ *  - transparent_huge: ordinary pages, 2 MiB aligned, with MADV_HUGEPAGE so
+ *    the kernel backs them with huge pages when it can. Only used for sizes
+ *    of at least 2 MiB.
+ *  - normal: ordinary pages.
+ *
+ *  Requesting a page size that is not available falls back to the next one
+ *  in the list. page_size() reports what was actually obtained. The memory
+ *  is zero-initialized by the OS.
+ */
+class PageAllocation {
+public:
+    /// Type used for sizes (in bytes)
+    using size_type = std::size_t;
+
+    /// Type of a pointer to the allocated bytes
+    using pointer = std::byte*;
+
+    /// Type of a read-only pointer to the allocated bytes
+    using const_pointer = const std::byte*;
+
+    /// The kinds of pages, from least to most preferred
+    enum class PageSize { normal, transparent_huge, huge_2mb, huge_1gb };
+
+    /// Options controlling how the memory is obtained
+    struct Options {
+        /// The preferred kind of page
+        PageSize page_size = PageSize::transparent_huge;
+
+        /// Fault every page in up front (after interleaving, if requested)?
+        bool populate = false;
+
+        /// mlock the memory, so it is never swapped out? Implies populate.
+        bool lock = false;
+
+        /// Spread the pages round-robin over all NUMA nodes (via mbind)?
+        bool interleave = false;
+    };
+
+    /** @brief Creates an object which does not allocate anything.
+     *
+     *  @throw None No throw guarantee.
+     */
+    PageAllocation() noexcept = default;
+
+    /** @brief Allocates @p size bytes.
+     *
+     *  Failing to lock the memory (e.g., because RLIMIT_MEMLOCK is too small)
+     *  or to interleave it (e.g., because the OS does not support NUMA) is
+     *  not an error; check is_locked() and is_interleaved().
+     *
+     *  @param[in] size The number of bytes to allocate. May be zero, in which
+     *                  case nothing is allocated.
+     *  @param[in] options How to allocate the memory.
+     *
+     *  @throw std::system_error if even ordinary pages can not be mapped.
+     *                           Strong throw guarantee.
+     */
+    explicit PageAllocation(size_type size, Options options);
+
+    /// Move-only
+    ///@{
+    PageAllocation(const PageAllocation&)            = delete;
+    PageAllocation& operator=(const PageAllocation&) = delete;
+    ///@}
+
+    /** @brief Takes ownership of the memory in @p other.
+     *
+     *  @param[in,out] other The object to take the memory from. After the
+     *                       call @p other does not own anything.
+     *
+     *  @throw None No throw guarantee.
+     */
+    PageAllocation(PageAllocation&& other) noexcept;
+
+    /** @brief Frees the memory in *this and takes the memory in @p other.
+     *
+     *  @param[in,out] other The object to take the memory from. After the
+     *                       call @p other does not own anything.
+     *
+     *  @return *this after taking the memory from @p other.
+     *
+     *  @throw None No throw guarantee.
+     */
+    PageAllocation& operator=(PageAllocation&& other) noexcept;
+
+    /// Unmaps the memory (if any)
+    ~PageAllocation() noexcept;
+
+    /** @brief The address of the first byte.
+     *
+     *  @return A pointer to the first byte, or nullptr if nothing is
+     *          allocated.
+     *
+     *  @throw None No throw guarantee.
+     */
+    pointer data() noexcept { return m_pdata_; }
+
+    /// Read-only version of data()
+    const_pointer data() const noexcept { return m_pdata_; }
+
+    /** @brief The number of requested bytes.
+     *
+     *  @return The number of bytes which may be accessed starting at data().
+     *
+     *  @throw None No throw guarantee.
+     */
+    size_type size() const noexcept { return m_size_; }
+
+    /** @brief The kind of pages that were obtained.
+     *
+     *  For transparent_huge this means the kernel accepted the MADV_HUGEPAGE
+     *  hint. Whether a given page is actually huge is up to the kernel.
+     *
+     *  @return The kind of pages backing the memory.
+     *
+     *  @throw None No throw guarantee.
+     */
+    PageSize page_size() const noexcept { return m_page_size_; }
+
+    /** @brief Was the memory successfully locked?
+     *
+     *  @return True if the memory is locked in RAM and false otherwise.
+     *
+     *  @throw None No throw guarantee.
+     */
+    bool is_locked() const noexcept { return m_is_locked_; }
+
+    /** @brief Was the memory successfully interleaved over the NUMA nodes?
+     *
+     *  @return True if the pages are placed round-robin over the NUMA nodes
+     *          and false otherwise.
+     *
+     *  @throw None No throw guarantee.
+     */
+    bool is_interleaved() const noexcept { return m_is_interleaved_; }
+
+    /** @brief Locks the memory in RAM, faulting it in if needed.
+     *
+     *  This is for memory which should be placed (e.g., by first touch)
+     *  before it is locked. Otherwise use Options::lock.
+     *
+     *  @return True if the memory is now locked and false otherwise.
+     *
+     *  @throw None No throw guarantee.
+     */
+    bool lock() noexcept;
+
+private:
+    /// Releases the memory (if any)
+    void unmap_() noexcept;
+
+    /// The first byte of the allocation
+    pointer m_pdata_ = nullptr;
+
+    /// Number of requested bytes
+    size_type m_size_ = 0;
+
+    /// Number of mapped bytes (size rounded up to whole pages)
+    size_type m_length_ = 0;
+
+    /// The kind of pages obtained
+    PageSize m_page_size_ = PageSize::normal;
+
+    /// Is the memory locked?
+    bool m_is_locked_ = false;
+
+    /// Is the memory interleaved over the NUMA nodes?
+    bool m_is_interleaved_ = false;
+};
+
+} // namespace wtf::buffer
@@ -0,0 +1,130 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <wtf/buffer/detail_/paged_model.hpp>
+#include <wtf/buffer/float_buffer.hpp>
+#include <wtf/buffer/page_allocation.hpp>
+#include <wtf/detail_/parallel_for.hpp>
+
+namespace wtf::buffer {
+
+/** @brief Creates a FloatBuffer whose elements live in large OS pages.
+ *
+ *  @tparam T The type of the elements. Must be trivially copyable.
+ *
+ *  The elements are allocated with a PageAllocation, so, if available, they
+ *  are backed by huge pages (see PageAllocation for the fallback order), can
+ *  be faulted in up front, and can be locked in RAM. Use this for large
+ *  buffers which are accessed randomly, or for latency-critical buffers. The
+ *  returned buffer works with visit_contiguous_buffer, FloatBuffer::value,
+ *  etc. like any other FloatBuffer. Copying it produces an ordinary
+ *  in-memory FloatBuffer.
+ *
+ *  @param[in] n The number of elements. They start out as zero.
+ *  @param[in] options How to allocate the memory.
+ *
+ *  @return A FloatBuffer holding @p n elements.
+ *
+ *  @throw std::system_error if the memory can not be allocated. Strong throw
+ *                           guarantee.
+ */
+template<concepts::FloatingPoint T>
+FloatBuffer make_paged_float_buffer(std::size_t n,
+                                    PageAllocation::Options options = {}) {
+    using model_type = detail_::PagedModel<T>;
+    return FloatBuffer(std::make_unique<model_type>(n, options));
+}
+
+/** @brief Creates a paged buffer whose pages are first touched in parallel.
+ *
+ *  @tparam T The type of the elements. Must be trivially copyable.
+ *
+ *  Linux places a page on the NUMA node of the thread which first writes to
+ *  it. Filling a buffer from one thread therefore puts all of it on one node,
+ *  and parallel kernels run on the other nodes are starved for bandwidth.
+ *  Here @p n_threads threads each write @p value to their own chunk of the
+ *  buffer. They use the same static chunking as WTF's parallel kernels (see
+ *  wtf::detail_::parallel_for). Each chunk's pages thus usually end up on the
+ *  node of the thread which later processes it, provided threads are pinned
+ *  to cores. The placement is best-effort: a chunk stolen by another thread
+ *  (e.g., because its worker was busy) lands on that thread's node.
+ *
+ *  Set options.interleave to instead spread the pages round-robin over all
+ *  nodes, e.g., for buffers accessed by every thread. options.populate is
+ *  ignored, because it would touch every page from the calling thread.
+ *  options.lock is applied after the pages have been touched.
+ *
+ *  @param[in] n The number of elements.
+ *  @param[in] n_threads The number of threads the buffer will be used with.
+ *  @param[in] value The initial value of every element. Default is T{}.
+ *  @param[in] options How to allocate the memory.
+ *
+ *  @return A FloatBuffer holding @p n copies of @p value.
+ *
+ *  @throw std::system_error if the memory can not be allocated or a thread
+ *                           can not be started. Strong throw guarantee.
+ */
+template<concepts::FloatingPoint T>
+FloatBuffer make_first_touch_float_buffer(
+  std::size_t n, std::size_t n_threads, T value = T{},
+  PageAllocation::Options options = {}) {
+    using model_type = detail_::PagedModel<T>;
+    const bool lock  = options.lock;
+    options.populate = false;
+    options.lock     = false;
+    auto pmodel      = std::make_unique<model_type>(n, options);
+    auto* p          = pmodel->data();
+
+    auto first_touch = [p, &value](std::size_t begin, std::size_t end) {
+        std::fill(p + begin, p + end, value);
+    };
+    wtf::detail_::parallel_for(n, n_threads, first_touch);
+    if(lock) pmodel->page_allocation().lock();
+    return FloatBuffer(std::move(pmodel));
+}
+
+/** @brief Is @p buffer backed by a PageAllocation?
+ *
+ *  @param[in] buffer The buffer to inspect.
+ *
+ *  @return True if @p buffer was created by make_paged_float_buffer and false
+ *          otherwise.
+ *
+ *  @throw None No throw guarantee.
+ */
+bool is_paged(const FloatBuffer& buffer) noexcept;
+
+/** @brief Returns the memory backing a paged buffer.
+ *
+ *  This is how callers find out which kind of pages they got and whether the
+ *  memory is locked.
+ *
+ *  @param[in] buffer A buffer created by make_paged_float_buffer.
+ *
+ *  @return A read-only reference to the allocation holding the elements.
+ *
+ *  @throw std::runtime_error if @p buffer is not paged. Strong throw
+ *                            guarantee.
+ */
+const PageAllocation& page_allocation(const FloatBuffer& buffer);
+
+} // namespace wtf::buffer
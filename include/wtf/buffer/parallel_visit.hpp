@@ -0,0 +1,318 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+#include <wtf/buffer/buffer_view.hpp>
+#include <wtf/buffer/float_buffer.hpp>
+#include <wtf/detail_/parallel_for.hpp>
+#include <wtf/fp/float_env.hpp>
+#include <wtf/parallel/async.hpp>
+#include <wtf/parallel/executor.hpp>
+
+namespace wtf::buffer {
+
+/** @brief How the parallel visitation functions run the visitor.
+ *
+ *  The elements are split into chunks of grain_size elements, and the
+ *  chunks are split over n_threads threads, each getting a contiguous run of
+ *  chunks (the static chunking of wtf::detail_::parallel_for). A thread
+ *  count converts implicitly, so `4` may be passed wherever an
+ *  ExecutionPolicy is expected. See also execution::seq and execution::par.
+ *
+ *  If float_env is set, every thread runs its chunks under a
+ *  fp::FloatEnvGuard for it (e.g., fp::FloatEnv::flush_denormals() for
+ *  kernels whose data underflows), and gets its own environment back
+ *  afterwards.
+ */
+struct ExecutionPolicy {
+    /// Type used for counts
+    using size_type = std::size_t;
+
+    /** @brief Creates a policy using @p n_threads threads and chunks of
+     *         @p grain_size elements.
+     *
+     *  @param[in] n_threads The most threads to use. 0 means
+     *                       wtf::parallel::max_threads(). Default is 0.
+     *  @param[in] grain_size The number of elements per chunk. 0 means the
+     *                        chunks are sized to fit in the L2 cache.
+     *                        Default is 0.
+     *  @param[in] float_env The floating-point environment to run the
+     *                       chunks in. Empty means that of each thread.
+     *                       Default is empty.
+     *
+     *  @throw None No throw guarantee.
+     */
+    constexpr ExecutionPolicy(
+      size_type n_threads                   = 0,
+      size_type grain_size                  = 0,
+      std::optional<fp::FloatEnv> float_env = std::nullopt) noexcept :
+      n_threads(n_threads), grain_size(grain_size), float_env(float_env) {}
+
+    /// The most threads to use, 0 means wtf::parallel::max_threads()
+    size_type n_threads;
+
+    /// The number of elements per chunk, 0 means cache-sized chunks
+    size_type grain_size;
+
+    /// The floating-point environment of the chunks, if not the threads' own
+    std::optional<fp::FloatEnv> float_env;
+};
+
+/// Predefined execution policies, named after those in std::execution
+namespace execution {
+
+/// Runs every chunk on the calling thread, in order
+inline constexpr ExecutionPolicy seq{1};
+
+/// Runs the chunks on every thread of the current executor
+inline constexpr ExecutionPolicy par{0};
+
+} // namespace execution
+
+namespace detail_ {
+
+/// Default chunks hold about this many bytes (summed over all buffers)
+inline constexpr std::size_t default_chunk_bytes = std::size_t{1} << 18;
+
+/// Default chunk sizes are a multiple of this many elements
+inline constexpr std::size_t chunk_alignment = 64;
+
+/** @brief Works out the chunk size for visiting spans of types @p Spans.
+ *
+ *  Unless @p policy sets it, chunks are sized so that the chunks of all the
+ *  spans together are about default_chunk_bytes bytes. The size is
+ *  rounded up to a multiple of chunk_alignment elements, so every
+ *  chunk starts a whole number of cache lines into each span.
+ */
+template<typename... Spans>
+std::size_t grain_size(const ExecutionPolicy& policy) noexcept {
+    if(policy.grain_size != 0) return policy.grain_size;
+    constexpr auto bytes = (sizeof(typename Spans::element_type) + ... + 0);
+    constexpr auto align = chunk_alignment;
+    constexpr auto n     = default_chunk_bytes / (bytes == 0 ? 1 : bytes);
+    return std::max((n + align - 1) / align * align, align);
+}
+
+/** @brief Calls @p visitor on each chunk of @p spans.
+ *
+ *  This is the implementation of parallel_visit_contiguous_buffer and
+ *  parallel_visit_contiguous_buffer_view, after the types have been
+ *  restored.
+ *
+ *  @return Nothing if @p visitor returns void, otherwise a std::vector with
+ *          the result for each chunk, in order.
+ *
+ *  @throw std::invalid_argument if the spans are different sizes. Strong
+ *                               throw guarantee.
+ *  @throw ??? the first exception thrown by @p visitor. Once a chunk throws
+ *             no new chunks are started. Weak throw guarantee.
+ */
+template<typename Visitor, typename Span0, typename... Spans>
+auto parallel_visit_spans(const ExecutionPolicy& policy, Visitor& visitor,
+                          Span0 span0, Spans... spans) {
+    const auto n = span0.size();
+    if(((spans.size() != n) || ...)) {
+        throw std::invalid_argument(
+          "parallel_visit: buffers must have the same size");
+    }
+
+    const auto grain = grain_size<Span0, Spans...>(policy);
+    auto call        = [&](std::size_t chunk) {
+        const auto begin = chunk * grain;
+        const auto size  = std::min(grain, n - begin);
+        if constexpr(std::is_invocable_v<Visitor&, Span0, Spans...>) {
+            return visitor(span0.subspan(begin, size),
+                           spans.subspan(begin, size)...);
+        } else {
+            return visitor(begin, span0.subspan(begin, size),
+                           spans.subspan(begin, size)...);
+        }
+    };
+    using result_type      = decltype(call(0));
+    constexpr bool is_void = std::is_void_v<result_type>;
+    using storage_type =
+      std::conditional_t<is_void, int, std::optional<result_type>>;
+
+    const auto n_chunks = (n + grain - 1) / grain;
+    std::vector<storage_type> results(is_void ? 0 : n_chunks);
+    std::atomic<bool> failed{false};
+    std::exception_ptr error;
+    std::mutex error_mutex;
+
+    auto run_chunks = [&](std::size_t first, std::size_t last) {
+        fp::FloatEnvGuard guard(policy.float_env);
+        for(auto chunk = first; chunk < last; ++chunk) {
+            if(failed.load(std::memory_order_relaxed)) return;
+            try {
+                if constexpr(is_void) {
+                    call(chunk);
+                } else {
+                    results[chunk].emplace(call(chunk));
+                }
+            } catch(...) {
+                std::scoped_lock lock(error_mutex);
+                if(!error) error = std::current_exception();
+                failed = true;
+            }
+        }
+    };
+
+    auto n_threads = policy.n_threads;
+    if(n_threads == 0) n_threads = parallel::max_threads();
+    wtf::detail_::parallel_for(n_chunks, n_threads, run_chunks);
+    if(error) std::rethrow_exception(error);
+
+    if constexpr(!is_void) {
+        std::vector<result_type> rv;
+        rv.reserve(n_chunks);
+        for(auto& result : results) rv.push_back(std::move(*result));
+        return rv;
+    }
+}
+
+} // namespace detail_
+
+/** @brief Calls a visitor on chunks of one or more FloatBuffer objects, in
+ *         parallel.
+ *
+ *  @relates FloatBuffer
+ *
+ *  @tparam TupleType A std::tuple of floating-point types to try. Must be
+ *                    explicitly provided by the user.
+ *  @tparam Visitor The type of the visitor. Must be callable either with
+ *                  `std::span<T>` objects (one per buffer), or with the
+ *                  offset of the chunk followed by the spans, for each
+ *                  possible T in @p TupleType. Will be inferred by the
+ *                  compiler.
+ *  @tparam Args The types of the buffers. Will be inferred by the compiler.
+ *
+ *  This is the parallel counterpart of visit_contiguous_buffer. The types of
+ *  the buffers are restored once. The index range is then split into
+ *  chunks (see ExecutionPolicy) and @p visitor is called with the
+ *  corresponding sub-spans of every buffer, concurrently on up to
+ *  policy.n_threads threads. The visitor must therefore be safe to call
+ *  concurrently on disjoint chunks. Kernels which accumulate should return
+ *  their partial result, the partial results are returned in chunk order.
+ *
+ *  @param[in] policy How to run the visitor. May be a thread count.
+ *  @param[in] visitor The visitor to call with each chunk.
+ *  @param[in] args The buffers to visit. Must all be the same size.
+ *
+ *  @return Nothing if @p visitor returns void, otherwise a std::vector
+ *          holding the result for each chunk, in order.
+ *
+ *  @throw std::runtime_error if any of the @p args does not hold one of the
+ *                            types in @p TupleType contiguously. Strong
+ *                            throw guarantee.
+ *  @throw std::invalid_argument if the buffers are different sizes. Strong
+ *                               throw guarantee.
+ *  @throw std::system_error if the default thread pool has to be created
+ *                           and can not be. Strong throw guarantee.
+ *  @throw ??? the first exception thrown by @p visitor. Weak throw
+ *             guarantee.
+ */
+template<typename TupleType, typename Visitor, typename... Args>
+auto parallel_visit_contiguous_buffer(ExecutionPolicy policy,
+                                      Visitor&& visitor, Args&&... args) {
+    static_assert(sizeof...(Args) > 0, "Must visit at least one buffer");
+    auto lambda = [&](auto... spans) {
+        return detail_::parallel_visit_spans(policy, visitor, spans...);
+    };
+    return visit_contiguous_buffer<TupleType>(lambda,
+                                              std::forward<Args>(args)...);
+}
+
+/** @brief Starts parallel_visit_contiguous_buffer without waiting for it.
+ *
+ *  @relates FloatBuffer
+ *
+ *  The visit runs as a task of the current executor, so independent visits
+ *  (e.g., reductions over different buffers) overlap. Their chunks share the
+ *  executor's threads rather than each visit starting threads of its own.
+ *
+ *  @param[in] policy How to run the visitor. May be a thread count.
+ *  @param[in] visitor The visitor to call with each chunk. Copied into the
+ *                     task.
+ *  @param[in] args The buffers to visit. Must all be the same size, and must
+ *                  stay alive (and unmodified by others) until the returned
+ *                  future is ready.
+ *
+ *  @return A future holding what parallel_visit_contiguous_buffer returns,
+ *          or the exception it threw.
+ *
+ *  @throw std::system_error if the default thread pool has to be created
+ *                           and can not be. Strong throw guarantee.
+ *  @throw std::bad_alloc if the task can not be queued. Strong throw
+ *                        guarantee.
+ */
+template<typename TupleType, typename Visitor, typename... Args>
+auto parallel_visit_contiguous_buffer_async(ExecutionPolicy policy,
+                                            Visitor visitor, Args&... args) {
+    static_assert(sizeof...(Args) > 0, "Must visit at least one buffer");
+    return parallel::async([policy, visitor = std::move(visitor),
+                            &args...]() mutable {
+        return parallel_visit_contiguous_buffer<TupleType>(policy, visitor,
+                                                           args...);
+    });
+}
+
+/** @brief Calls a visitor on chunks of one or more BufferView objects, in
+ *         parallel.
+ *
+ *  @relates BufferView
+ *
+ *  This is the BufferView counterpart of parallel_visit_contiguous_buffer,
+ *  see there for details.
+ *
+ *  @param[in] policy How to run the visitor. May be a thread count.
+ *  @param[in] visitor The visitor to call with each chunk.
+ *  @param[in] args The views to visit. Must all be the same size.
+ *
+ *  @return Nothing if @p visitor returns void, otherwise a std::vector
+ *          holding the result for each chunk, in order.
+ *
+ *  @throw std::runtime_error if any of the @p args does not alias one of the
+ *                            types in @p TupleType contiguously. Strong
+ *                            throw guarantee.
+ *  @throw std::invalid_argument if the views are different sizes. Strong
+ *                               throw guarantee.
+ *  @throw std::system_error if the default thread pool has to be created
+ *                           and can not be. Strong throw guarantee.
+ *  @throw ??? the first exception thrown by @p visitor. Weak throw
+ *             guarantee.
+ */
+template<typename TupleType, typename Visitor, typename... Args>
+auto parallel_visit_contiguous_buffer_view(ExecutionPolicy policy,
+                                           Visitor&& visitor, Args&&... args) {
+    static_assert(sizeof...(Args) > 0, "Must visit at least one view");
+    auto lambda = [&](auto... spans) {
+        return detail_::parallel_visit_spans(policy, visitor, spans...);
+    };
+    return visit_contiguous_buffer_view<TupleType>(
+      lambda, std::forward<Args>(args)...);
+}
+
+} // namespace wtf::buffer
@@ -0,0 +1,388 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <wtf/buffer/buffer_view.hpp>
+#include <wtf/buffer/float_buffer.hpp>
+#include <wtf/buffer/parallel_visit.hpp>
+#include <wtf/buffer/validation.hpp>
+#include <wtf/fp/convert.hpp>
+#include <wtf/rtti/type_info.hpp>
+#include <wtf/type_traits/is_complex.hpp>
+#include <wtf/type_traits/type_name.hpp>
+
+/** @file precision_selection.hpp
+ *
+ *  Works out which of a set of floating-point types a buffer could be stored
+ *  as without losing more than a given tolerance, and converts it to the
+ *  narrowest such type. Each candidate is judged by round-tripping every
+ *  element through it (source -> candidate -> source) and measuring the
+ *  error, which covers both precision and range (a value which overflows or
+ *  flushes to zero in the candidate shows up as a large error).
+ */
+
+namespace wtf::buffer {
+
+/// How far a value may move when round-tripped through a narrower type
+struct PrecisionTolerance {
+    /// The largest error allowed, relative to the magnitude of the value
+    double relative = 0.0;
+
+    /// Errors up to this are allowed whatever the magnitude of the value
+    double absolute = 0.0;
+
+    /** @brief Is an @p error in a value of magnitude @p magnitude allowed?
+     *
+     *  @param[in] error The absolute error of the value.
+     *  @param[in] magnitude The magnitude of the value.
+     *
+     *  @return True if @p error is at most absolute + relative * magnitude.
+     *
+     *  @throw None No throw guarantee.
+     */
+    bool accepts(double error, double magnitude) const noexcept {
+        return error <= absolute + relative * magnitude;
+    }
+};
+
+/// How well one candidate type represents the elements of a buffer
+struct PrecisionCandidate {
+    /// The candidate type
+    rtti::TypeInfo type;
+
+    /// The size of one element of the candidate type, in bytes
+    std::size_t element_size;
+
+    /// The largest absolute round-trip error of a finite element
+    double max_abs_error;
+
+    /// The largest round-trip error of a finite element, relative to the
+    /// element's magnitude (infinite if a non-zero error hits a zero)
+    double max_rel_error;
+
+    /// Does every element meet the tolerance?
+    bool meets_tolerance;
+};
+
+/// The result of analyze_precision
+struct PrecisionAnalysis {
+    /// The smallest magnitude of a finite, non-zero element (infinity if
+    /// there is none)
+    double min_magnitude;
+
+    /// The largest magnitude of a finite element (0 if there is none)
+    double max_magnitude;
+
+    /// The candidate types, in the order of the TupleType analyzed with
+    std::vector<PrecisionCandidate> candidates;
+
+    /// The narrowest candidate which meets the tolerance
+    rtti::TypeInfo selected;
+};
+
+namespace detail_ {
+
+/// Can elements of @p From be round-tripped through @p To?
+template<typename From, typename To>
+inline constexpr bool is_precision_candidate_v =
+  std::is_constructible_v<To, const From&> &&
+  std::is_constructible_v<From, const To&> &&
+  type_traits::is_complex_v<From> == type_traits::is_complex_v<To>;
+
+/// Can the round-trip error of @p T be measured?
+template<typename T>
+concept MeasurableError = requires(const T& a) {
+    static_cast<double>(std::abs(+(a - a)));
+};
+
+/// |@p x| as a double. The unary plus promotes storage-only types (e.g.,
+/// fp::Half) to the type they do arithmetic in.
+template<typename T>
+double magnitude(const T& x) noexcept {
+    return static_cast<double>(std::abs(+x));
+}
+
+/// Round-trip statistics of one candidate over part of a buffer
+struct RoundTripStats {
+    /// See PrecisionCandidate::max_abs_error
+    double max_abs_error = 0.0;
+
+    /// See PrecisionCandidate::max_rel_error
+    double max_rel_error = 0.0;
+
+    /// See PrecisionCandidate::meets_tolerance
+    bool meets_tolerance = true;
+
+    /// Combines the statistics of two parts
+    RoundTripStats operator+(const RoundTripStats& other) const noexcept {
+        return {std::max(max_abs_error, other.max_abs_error),
+                std::max(max_rel_error, other.max_rel_error),
+                meets_tolerance && other.meets_tolerance};
+    }
+};
+
+/** @brief Round-trips @p values through @p To and measures the error.
+ *
+ *  Non-finite elements have no error as long as they stay non-finite.
+ */
+template<typename To, typename From>
+RoundTripStats round_trip(std::span<const From> values,
+                          const PrecisionTolerance& tolerance) noexcept {
+    constexpr auto inf = std::numeric_limits<double>::infinity();
+    RoundTripStats rv;
+    for(const auto& x : values) {
+        const auto back = static_cast<From>(static_cast<To>(x));
+        if(is_nonfinite(x)) {
+            if(!is_nonfinite(back)) rv.meets_tolerance = false;
+            continue;
+        }
+        const auto error = magnitude(x - back);
+        const auto size  = magnitude(x);
+        auto relative    = error > 0.0 ? inf : 0.0;
+        if(size > 0.0) relative = error / size;
+        rv.max_abs_error   = std::max(rv.max_abs_error, error);
+        rv.max_rel_error   = std::max(rv.max_rel_error, relative);
+        rv.meets_tolerance = rv.meets_tolerance &&
+                             tolerance.accepts(error, size);
+    }
+    return rv;
+}
+
+/// Statistics of part of a buffer for every type of @p N candidates
+template<std::size_t N>
+struct PrecisionStats {
+    /// See PrecisionAnalysis::min_magnitude
+    double min_magnitude = std::numeric_limits<double>::infinity();
+
+    /// See PrecisionAnalysis::max_magnitude
+    double max_magnitude = 0.0;
+
+    /// The statistics of each candidate
+    std::array<RoundTripStats, N> candidates{};
+
+    /// Combines the statistics of two parts
+    PrecisionStats operator+(const PrecisionStats& other) const noexcept {
+        PrecisionStats rv;
+        rv.min_magnitude = std::min(min_magnitude, other.min_magnitude);
+        rv.max_magnitude = std::max(max_magnitude, other.max_magnitude);
+        for(std::size_t i = 0; i < N; ++i)
+            rv.candidates[i] = candidates[i] + other.candidates[i];
+        return rv;
+    }
+};
+
+/// Measures the candidates of @p TupleType over @p values
+template<typename TupleType, typename From>
+PrecisionStats<std::tuple_size_v<TupleType>> precision_stats(
+  std::span<const From> values, const PrecisionTolerance& tolerance) {
+    PrecisionStats<std::tuple_size_v<TupleType>> rv;
+    for(const auto& x : values) {
+        if(is_nonfinite(x)) continue;
+        const auto size = magnitude(x);
+        if(size > 0.0) rv.min_magnitude = std::min(rv.min_magnitude, size);
+        rv.max_magnitude = std::max(rv.max_magnitude, size);
+    }
+    [&]<std::size_t... I>(std::index_sequence<I...>) {
+        auto measure = [&]<std::size_t J>() {
+            using to_type = std::tuple_element_t<J, TupleType>;
+            if constexpr(is_precision_candidate_v<From, to_type>)
+                rv.candidates[J] = round_trip<to_type>(values, tolerance);
+        };
+        (measure.template operator()<I>(), ...);
+    }(std::make_index_sequence<std::tuple_size_v<TupleType>>{});
+    return rv;
+}
+
+/// Calls @p fxn with std::type_identity<T> for each T in @p TupleType
+template<typename TupleType, typename Fxn>
+void for_each_type(Fxn&& fxn) {
+    [&]<std::size_t... I>(std::index_sequence<I...>) {
+        (fxn(std::integral_constant<std::size_t, I>{},
+             std::type_identity<std::tuple_element_t<I, TupleType>>{}),
+         ...);
+    }(std::make_index_sequence<std::tuple_size_v<TupleType>>{});
+}
+
+} // namespace detail_
+
+/** @brief Measures how well each type in @p TupleType represents @p view.
+ *
+ *  @relates BufferView
+ *
+ *  @tparam TupleType The floating-point types @p view may alias, which are
+ *                    also the candidate types. Include fp::Half and
+ *                    fp::BFloat16 (e.g., via wtf::narrow_fp_types) to have
+ *                    them considered.
+ *
+ *  Candidates are the types of @p TupleType the elements can be converted to
+ *  and back from (complex elements only have complex candidates). The
+ *  element type of @p view is always a candidate and always meets the
+ *  tolerance. The selected type is the candidate meeting the tolerance with
+ *  the smallest elements; ties go to the smaller max_rel_error and then to
+ *  the type listed first. The elements are measured in one parallel pass.
+ *
+ *  @param[in] view The elements to analyze. Must be contiguous. FloatBuffer
+ *                  objects convert implicitly.
+ *  @param[in] tolerance How far round-tripped elements may move.
+ *  @param[in] policy How to split the pass. Defaults to execution::par.
+ *
+ *  @return The range of the elements and the statistics of each candidate.
+ *
+ *  @throw std::runtime_error if @p view does not alias one of the types in
+ *                            @p TupleType contiguously, or if its type does
+ *                            not support the arithmetic needed to measure
+ *                            errors. Strong throw guarantee.
+ *  @throw std::bad_alloc if allocating the result fails. Strong throw
+ *                        guarantee.
+ *  @throw std::system_error if the default thread pool has to be created
+ *                           and can not be. Strong throw guarantee.
+ */
+template<typename TupleType>
+PrecisionAnalysis analyze_precision(BufferView<const fp::Float> view,
+                                    PrecisionTolerance tolerance,
+                                    ExecutionPolicy policy = execution::par) {
+    auto visitor = [&](auto values) -> PrecisionAnalysis {
+        using from_type = std::remove_const_t<
+          typename decltype(values)::element_type>;
+        if constexpr(!detail_::MeasurableError<from_type>) {
+            throw std::runtime_error(
+              std::string("analyze_precision: type ") +
+              type_traits::type_name_v<from_type> +
+              " does not support arithmetic");
+        } else {
+            using stats_type =
+              detail_::PrecisionStats<std::tuple_size_v<TupleType>>;
+            auto kernel = [&](auto chunk) {
+                std::span<const from_type> cchunk(chunk);
+                return detail_::precision_stats<TupleType>(cchunk, tolerance);
+            };
+            stats_type stats;
+            for(const auto& partial :
+                detail_::parallel_visit_spans(policy, kernel, values))
+                stats = stats + partial;
+
+            PrecisionAnalysis rv{stats.min_magnitude, stats.max_magnitude,
+                                 {}, rtti::wtf_typeid<from_type>()};
+            std::optional<std::size_t> best;
+            detail_::for_each_type<TupleType>([&](auto i, auto id) {
+                using to_type = typename decltype(id)::type;
+                if constexpr(detail_::is_precision_candidate_v<from_type,
+                                                               to_type>) {
+                    const auto& s = stats.candidates[i];
+                    rv.candidates.push_back(
+                      {rtti::wtf_typeid<to_type>(), sizeof(to_type),
+                       s.max_abs_error, s.max_rel_error, s.meets_tolerance});
+                    if(!s.meets_tolerance) return;
+                    const auto& c = rv.candidates.back();
+                    if(best) {
+                        const auto& b = rv.candidates[*best];
+                        if(b.element_size < c.element_size) return;
+                        if(b.element_size == c.element_size &&
+                           b.max_rel_error <= c.max_rel_error)
+                            return;
+                    }
+                    best = rv.candidates.size() - 1;
+                }
+            });
+            rv.selected = rv.candidates[*best].type;
+            return rv;
+        }
+    };
+    return visit_contiguous_buffer_view<TupleType>(visitor, view);
+}
+
+/** @brief Converts @p buffer to the narrowest type in @p TupleType which
+ *         holds its elements within @p tolerance.
+ *
+ *  @relates FloatBuffer
+ *
+ *  The type is chosen by analyze_precision. If it differs from the type
+ *  @p buffer holds, the elements are converted (with the vectorized
+ *  fp::convert where one exists, otherwise element-wise in parallel) into a
+ *  new, contiguous buffer which then replaces the contents of @p buffer.
+ *  Views of @p buffer are invalidated in that case.
+ *
+ *  @tparam TupleType The floating-point types @p buffer may hold, which are
+ *                    also the candidate types.
+ *
+ *  @param[in,out] buffer The buffer to compact. Must be contiguous.
+ *  @param[in] tolerance How far the elements may move.
+ *  @param[in] policy How to split the analysis and the conversion. Defaults
+ *                    to execution::par.
+ *
+ *  @return The type @p buffer holds afterwards.
+ *
+ *  @throw std::runtime_error if @p buffer does not hold one of the types in
+ *                            @p TupleType contiguously, or if its type does
+ *                            not support the arithmetic needed to measure
+ *                            errors. Strong throw guarantee.
+ *  @throw std::bad_alloc if allocating the converted buffer fails. Strong
+ *                        throw guarantee.
+ *  @throw std::system_error if the default thread pool has to be created
+ *                           and can not be. Strong throw guarantee.
+ */
+template<typename TupleType>
+rtti::TypeInfo compact(FloatBuffer& buffer, PrecisionTolerance tolerance,
+                       ExecutionPolicy policy = execution::par) {
+    auto analysis = analyze_precision<TupleType>(buffer, tolerance, policy);
+    auto visitor  = [&](auto values) {
+        using from_type = std::remove_const_t<
+          typename decltype(values)::element_type>;
+        std::optional<FloatBuffer> rv;
+        detail_::for_each_type<TupleType>([&](auto, auto id) {
+            using to_type = typename decltype(id)::type;
+            if constexpr(!std::is_same_v<from_type, to_type> &&
+                         detail_::is_precision_candidate_v<from_type,
+                                                           to_type>) {
+                if(rv || analysis.selected != rtti::wtf_typeid<to_type>())
+                    return;
+                std::vector<to_type> out(values.size());
+                std::span<to_type> pout(out);
+                if constexpr(requires { fp::convert(values, pout); }) {
+                    fp::convert(values, pout);
+                } else {
+                    auto kernel = [](auto in, auto chunk) {
+                        for(std::size_t i = 0; i < in.size(); ++i)
+                            chunk[i] = static_cast<to_type>(in[i]);
+                    };
+                    detail_::parallel_visit_spans(policy, kernel, values,
+                                                  pout);
+                }
+                rv.emplace(std::move(out));
+            }
+        });
+        return rv;
+    };
+    auto converted = visit_contiguous_buffer<TupleType>(visitor,
+                                                        std::as_const(buffer));
+    if(converted) buffer = std::move(*converted);
+    return analysis.selected;
+}
+
+} // namespace wtf::buffer
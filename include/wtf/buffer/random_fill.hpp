@@ -0,0 +1,290 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <numbers>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <wtf/buffer/buffer_view.hpp>
+#include <wtf/buffer/parallel_visit.hpp>
+#include <wtf/detail_/philox.hpp>
+#include <wtf/fp/bfloat16.hpp>
+#include <wtf/fp/float.hpp>
+#include <wtf/fp/half.hpp>
+#include <wtf/type_traits/is_complex.hpp>
+
+/** @file random_fill.hpp
+ *
+ *  Fills buffers with pseudo-random values, in parallel. The random bits come
+ *  from the counter-based Philox4x32-10 generator, keyed by the seed: element
+ *  i of a view is always made from the same call (the counter is i divided
+ *  by the number of values per call), so the values depend only on the seed
+ *  and on i. They do not depend on the number of threads or on how the view
+ *  is chunked. The loops have no data-dependent branches and are
+ *  auto-vectorized; the normal distribution additionally calls std::log,
+ *  std::sqrt, std::cos and std::sin.
+ */
+
+namespace wtf::buffer {
+
+/// Values uniformly distributed over [min, max)
+struct UniformDistribution {
+    /// The smallest value
+    double min = 0.0;
+
+    /// The bound the values stay below (up to rounding, see random_fill)
+    double max = 1.0;
+};
+
+/// Normally distributed values
+struct NormalDistribution {
+    /// The mean of the values
+    double mean = 0.0;
+
+    /// The standard deviation of the values
+    double stddev = 1.0;
+};
+
+namespace detail_ {
+
+/// The random values for elements of type @p T are computed as this type
+template<typename T>
+using random_compute_t =
+  std::conditional_t<std::is_same_v<T, float> || std::is_same_v<T, fp::Half> ||
+                       std::is_same_v<T, fp::BFloat16>,
+                     float, double>;
+
+/// Number of random significand bits of a value for an element of type @p T
+template<typename T>
+inline constexpr int random_bits_v = 52;
+
+/// float's significand
+template<>
+inline constexpr int random_bits_v<float> = 23;
+
+/// Half's significand
+template<>
+inline constexpr int random_bits_v<fp::Half> = 10;
+
+/// BFloat16's significand
+template<>
+inline constexpr int random_bits_v<fp::BFloat16> = 7;
+
+/// Number of values made from one Philox4x32 call for elements of type @p T
+template<typename T>
+inline constexpr std::size_t random_block_v =
+  std::is_same_v<random_compute_t<T>, float> ? 4 : 2;
+
+/// The values for elements [B * counter, B * (counter + 1)) of type @p T
+template<typename T>
+using random_block_t = std::array<random_compute_t<T>, random_block_v<T>>;
+
+/** @brief Makes a float uniformly distributed over [0, 1) from the top
+ *         @p Bits bits of @p word.
+ *
+ *  The bits become the significand of a number in [1, 2), from which 1 is
+ *  subtracted (exactly). With @p Bits no more than the element type's
+ *  significand the result is representable in the element type, so it
+ *  stays below 1.
+ */
+template<int Bits>
+inline float unit_float(std::uint32_t word) noexcept {
+    const auto significand = (word >> (32 - Bits)) << (23 - Bits);
+    return std::bit_cast<float>(0x3F800000u | significand) - 1.0f;
+}
+
+/// The double counterpart of unit_float, using the top @p Bits bits of
+/// @p high followed by @p low
+template<int Bits>
+inline double unit_double(std::uint32_t high, std::uint32_t low) noexcept {
+    const auto word        = (std::uint64_t{high} << 32) | low;
+    const auto significand = (word >> (64 - Bits)) << (52 - Bits);
+    return std::bit_cast<double>(0x3FF0000000000000ull | significand) - 1.0;
+}
+
+/// The uniform values in [0, 1) of block @p counter of the stream @p seed
+template<typename T>
+inline random_block_t<T> unit_block(std::uint64_t counter,
+                                    std::uint64_t seed) noexcept {
+    constexpr auto bits = random_bits_v<T>;
+    const auto w        = wtf::detail_::philox4x32(counter, seed);
+    if constexpr(random_block_v<T> == 4) {
+        return {unit_float<bits>(w[0]), unit_float<bits>(w[1]),
+                unit_float<bits>(w[2]), unit_float<bits>(w[3])};
+    } else {
+        return {unit_double<bits>(w[0], w[1]), unit_double<bits>(w[2], w[3])};
+    }
+}
+
+/// Block @p counter of values for elements of type @p T drawn from
+/// @p distribution
+template<typename T>
+inline random_block_t<T> random_block(
+  const UniformDistribution& distribution, std::uint64_t counter,
+  std::uint64_t seed) noexcept {
+    using compute_type = random_compute_t<T>;
+    const auto min     = static_cast<compute_type>(distribution.min);
+    const auto width   = static_cast<compute_type>(distribution.max -
+                                                 distribution.min);
+    auto rv = unit_block<T>(counter, seed);
+    for(auto& x : rv) x = min + width * x;
+    return rv;
+}
+
+/// Block @p counter of values for elements of type @p T drawn from
+/// @p distribution, by the Box-Muller transform of pairs of uniform values
+template<typename T>
+random_block_t<T> random_block(const NormalDistribution& distribution,
+                               std::uint64_t counter,
+                               std::uint64_t seed) noexcept {
+    using compute_type       = random_compute_t<T>;
+    constexpr auto two_pi    = 2 * std::numbers::pi_v<compute_type>;
+    constexpr compute_type one = 1;
+    const auto mean   = static_cast<compute_type>(distribution.mean);
+    const auto stddev = static_cast<compute_type>(distribution.stddev);
+
+    auto rv = unit_block<T>(counter, seed);
+    for(std::size_t i = 0; i < rv.size(); i += 2) {
+        // 1 - u is in (0, 1], so the log is finite
+        const auto radius = stddev * std::sqrt(-2 * std::log(one - rv[i]));
+        const auto angle  = two_pi * rv[i + 1];
+        rv[i]     = mean + radius * std::cos(angle);
+        rv[i + 1] = mean + radius * std::sin(angle);
+    }
+    return rv;
+}
+
+/** @brief Fills @p out, whose first element is element @p first of the
+ *         stream, with values from @p distribution.
+ *
+ *  Partial blocks at either end of @p out are made whole and the unneeded
+ *  values dropped. The loop over the whole blocks in between has a fixed
+ *  inner trip count so it is vectorized. @p distribution is taken by value
+ *  so the compiler knows the writes to @p out do not change it.
+ */
+template<typename T, typename Distribution>
+void random_fill_span(std::span<T> out, std::size_t first,
+                      Distribution distribution, std::uint64_t seed) {
+    constexpr auto block_size = random_block_v<T>;
+    const auto n              = out.size();
+    auto partial = [&](std::size_t begin, std::size_t end) {
+        const auto counter = (first + begin) / block_size;
+        const auto values  = random_block<T>(distribution, counter, seed);
+        for(auto i = begin; i < end; ++i)
+            out[i] = static_cast<T>(values[(first + i) % block_size]);
+    };
+
+    std::size_t i = std::min(n, (block_size - first % block_size) % block_size);
+    if(i > 0) partial(0, i);
+
+    T* p                = out.data() + i;
+    const auto counter0 = (first + i) / block_size;
+    const auto n_blocks = (n - i) / block_size;
+    for(std::size_t j = 0; j < n_blocks; ++j) {
+        const auto values = random_block<T>(distribution, counter0 + j, seed);
+        for(std::size_t k = 0; k < block_size; ++k)
+            p[j * block_size + k] = static_cast<T>(values[k]);
+    }
+
+    i += n_blocks * block_size;
+    if(i < n) partial(i, n);
+}
+
+/// Implements random_fill for either distribution
+template<typename TupleType, typename Distribution>
+void random_fill(BufferView<fp::Float> view, const Distribution& distribution,
+                 std::uint64_t seed, const ExecutionPolicy& policy) {
+    auto visitor = [&](auto values) {
+        using value_type = std::remove_reference_t<decltype(values[0])>;
+        using clean_type = std::remove_const_t<value_type>;
+        using part_type  = type_traits::real_type_t<clean_type>;
+        constexpr bool is_complex = type_traits::is_complex_v<clean_type>;
+
+        // std::complex<T> is only layout-compatible with T[2] for the
+        // standard floating-point types
+        constexpr bool is_fillable =
+          !std::is_const_v<value_type> &&
+          std::is_constructible_v<part_type, random_compute_t<part_type>> &&
+          (!is_complex || std::is_floating_point_v<part_type>);
+
+        if constexpr(!is_fillable) {
+            throw std::invalid_argument(
+              "random_fill: elements can not be made from random values");
+        } else {
+            constexpr std::size_t n_parts = is_complex ? 2 : 1;
+            auto* p = reinterpret_cast<part_type*>(values.data());
+            std::span<part_type> parts(p, values.size() * n_parts);
+            auto kernel = [&](std::size_t offset, auto chunk) {
+                random_fill_span(chunk, offset, distribution, seed);
+            };
+            parallel_visit_spans(policy, kernel, parts);
+        }
+    };
+    visit_contiguous_buffer_view<TupleType>(visitor, view);
+}
+
+} // namespace detail_
+
+/** @brief Overwrites the elements of @p view with pseudo-random values.
+ *
+ *  @tparam TupleType The floating-point types @p view may alias.
+ *
+ *  The values are computed in float for float, Half and BFloat16 elements
+ *  and in double otherwise, using as many random significand bits as the
+ *  element type has (at most 52). Uniform values in [0, 1) are exactly
+ *  representable, but min + (max - min) * u is rounded, so for other bounds
+ *  a value may round to @p max. The real and imaginary parts of complex
+ *  elements are independent, as if they were consecutive real elements.
+ *
+ *  @param[in] view The elements to overwrite.
+ *  @param[in] distribution The distribution to draw the values from.
+ *  @param[in] seed Selects the random stream. The same seed always gives the
+ *                  same values for the same element type.
+ *  @param[in] policy How to split the work over threads. Does not affect
+ *                    the values. Default is execution::par.
+ *
+ *  @throw std::runtime_error if @p view does not alias one of the types in
+ *                            @p TupleType contiguously. Strong throw
+ *                            guarantee.
+ *  @throw std::invalid_argument if the elements can not be made from float
+ *                               or double values. Strong throw guarantee.
+ *  @throw std::system_error if the default thread pool has to be created
+ *                           and can not be. Strong throw guarantee.
+ */
+///@{
+template<typename TupleType>
+void random_fill(BufferView<fp::Float> view,
+                 const UniformDistribution& distribution, std::uint64_t seed,
+                 ExecutionPolicy policy = execution::par) {
+    detail_::random_fill<TupleType>(view, distribution, seed, policy);
+}
+
+template<typename TupleType>
+void random_fill(BufferView<fp::Float> view,
+                 const NormalDistribution& distribution, std::uint64_t seed,
+                 ExecutionPolicy policy = execution::par) {
+    detail_::random_fill<TupleType>(view, distribution, seed, policy);
+}
+///@}
+
+} // namespace wtf::buffer
@@ -0,0 +1,505 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+#include <wtf/buffer/float_buffer.hpp>
+#include <wtf/buffer/parallel_visit.hpp>
+#include <wtf/fp/float.hpp>
+#include <wtf/parallel/executor.hpp>
+#include <wtf/type_traits/is_complex.hpp>
+
+namespace wtf::buffer {
+
+/** @brief How a parallel reduction splits and combines its work.
+ *
+ *  Floating-point addition is not associative, so the result of a reduction
+ *  depends on the order in which the elements are combined.
+ */
+enum class ReductionMode {
+    /// Each thread reduces one contiguous piece. The result may change with
+    /// the number of threads.
+    fast,
+
+    /// Fixed-size blocks, combined by a fixed pairwise tree. The result only
+    /// depends on the data, it is bitwise identical for any number of
+    /// threads (and any executor).
+    reproducible
+};
+
+/** @brief How a reduction accumulates the elements of each piece.
+ *
+ *  All modes keep the storage type of the buffer; the more accurate ones
+ *  spend extra arithmetic instead of promoting the elements. Each runs
+ *  detail_::reduction_lanes independent accumulators, so the loops
+ *  vectorize and the extra arithmetic costs a small constant factor. The
+ *  error bounds below are for a sum of n terms with unit round-off u.
+ *
+ *  - naive: plain additions, error up to about n u sum(|x|).
+ *  - pairwise: recursive halving, error about log2(n) u sum(|x|).
+ *  - neumaier: Kahan-Babuska-Neumaier compensation, error about
+ *    u |sum(x)| + n u^2 sum(|x|).
+ *  - double_double: each accumulator is an unevaluated sum of two values
+ *    (and, for real dot products and norms, products are split exactly with
+ *    an FMA where std::fma supports the type), giving roughly twice the
+ *    precision of the element type.
+ */
+enum class Accumulation { naive, pairwise, neumaier, double_double };
+
+/** @brief Selects how a reduction runs.
+ *
+ *  A ReductionMode or an Accumulation converts implicitly, so either may be
+ *  passed wherever ReductionOptions are expected.
+ */
+struct ReductionOptions {
+    /** @brief Creates options with the given @p mode and @p accumulation.
+     *
+     *  @param[in] mode How the work is split. Default is fast.
+     *  @param[in] accumulation How each piece is accumulated. Default is
+     *                          naive.
+     *
+     *  @throw None No throw guarantee.
+     */
+    constexpr ReductionOptions(
+      ReductionMode mode        = ReductionMode::fast,
+      Accumulation accumulation = Accumulation::naive) noexcept :
+      mode(mode), accumulation(accumulation) {}
+
+    /// Creates fast options with the given @p accumulation
+    constexpr ReductionOptions(Accumulation accumulation) noexcept :
+      ReductionOptions(ReductionMode::fast, accumulation) {}
+
+    /// How the work is split over threads
+    ReductionMode mode;
+
+    /// How each piece is accumulated
+    Accumulation accumulation;
+};
+
+namespace detail_ {
+
+/// Does the standard library provide fma for T? (__float128 has none)
+template<typename T>
+concept has_std_fma = requires(T x) { std::fma(x, x, x); };
+
+/// |x|, also for types without a std::abs overload
+template<typename T>
+T magnitude(T x) noexcept {
+    if constexpr(requires { std::abs(x); }) {
+        return std::abs(x);
+    } else {
+        return x < T{0} ? -x : x;
+    }
+}
+
+/** @brief The square root of @p x, also for types without std::sqrt.
+ *
+ *  Types like __float128 start from the long double root, which one Newton
+ *  step refines to about twice as many bits.
+ */
+template<typename T>
+T square_root(T x) noexcept {
+    if constexpr(requires { std::sqrt(x); }) {
+        return static_cast<T>(std::sqrt(x));
+    } else {
+        auto y = static_cast<T>(std::sqrt(static_cast<long double>(x)));
+        // Skips zero, infinity, and NaN, which are already exact
+        if(y > T{0} && y - y == T{0}) y = (y + x / y) / T{2};
+        return y;
+    }
+}
+
+/// Number of elements per block of a reproducible reduction
+inline constexpr std::size_t reproducible_block_size = 4096;
+
+/// Number of independent accumulators a piece is reduced with
+inline constexpr std::size_t reduction_lanes = 8;
+
+/// Pieces longer than this are halved by pairwise accumulation
+inline constexpr std::size_t pairwise_base_size = 256;
+
+/// Computes s and e such that a + b == s + e exactly (Knuth's TwoSum)
+template<typename T>
+void two_sum(T a, T b, T& s, T& e) noexcept {
+    s            = a + b;
+    const auto z = s - a;
+    e            = (a - (s - z)) + (b - z);
+}
+
+/// As two_sum, but requires |a| >= |b| (Dekker's FastTwoSum)
+template<typename T>
+void fast_two_sum(T a, T b, T& s, T& e) noexcept {
+    s = a + b;
+    e = b - (s - a);
+}
+
+/** @brief The partial result of a reduction, as the unevaluated sum hi + lo.
+ *
+ *  Partials are added as double-double numbers, so combining the partial
+ *  results of pieces does not lose what the pieces gained.
+ */
+template<typename T>
+struct Partial {
+    /// The leading part
+    T hi{};
+
+    /// The trailing part (the accumulated error of hi)
+    T lo{};
+
+    /// Adds two partials without losing their trailing parts
+    Partial operator+(const Partial& other) const noexcept {
+        Partial rv;
+        T e;
+        two_sum(hi, other.hi, rv.hi, e);
+        e += lo + other.lo;
+        two_sum(rv.hi, e, rv.hi, rv.lo);
+        return rv;
+    }
+
+    /// The value, rounded to T
+    T value() const noexcept { return hi + lo; }
+};
+
+/** @brief Adds the elements of @p values as a balanced binary tree.
+ *
+ *  Neighbors are added pairwise, level by level (an odd element out is
+ *  carried to the next level), so the order of the additions only depends
+ *  on the number of elements. @p values is overwritten.
+ *
+ *  @return The sum, or a value-initialized T if @p values is empty.
+ */
+template<typename T>
+T pairwise_sum(std::span<T> values) {
+    auto n = values.size();
+    if(n == 0) return T{};
+    while(n > 1) {
+        const auto half = n / 2;
+        for(std::size_t i = 0; i < half; ++i)
+            values[i] = values[2 * i] + values[2 * i + 1];
+        if(n % 2 == 1) values[half] = values[n - 1];
+        n = half + n % 2;
+    }
+    return values[0];
+}
+
+/** @brief reduction_lanes accumulators of type T, accumulating as @p A.
+ *
+ *  Term i of a piece goes to lane i % reduction_lanes. Every lane only
+ *  depends on its own terms, so a loop over the lanes vectorizes without
+ *  reordering any operation.
+ */
+template<Accumulation A, typename T>
+class LaneAccumulator {
+public:
+    /// Adds @p x to lane @p j
+    void add(std::size_t j, T x) noexcept {
+        if constexpr(A == Accumulation::naive ||
+                     A == Accumulation::pairwise) {
+            m_hi_[j] += x;
+        } else if constexpr(A == Accumulation::neumaier) {
+            const auto t = m_hi_[j] + x;
+            if constexpr(type_traits::is_complex_v<T>) {
+                // The branch-free TwoSum is exact for each component
+                T e;
+                two_sum(m_hi_[j], x, m_hi_[j], e);
+                m_lo_[j] += e;
+            } else {
+                const bool bigger = magnitude(m_hi_[j]) >= magnitude(x);
+                m_lo_[j] += bigger ? (m_hi_[j] - t) + x : (x - t) + m_hi_[j];
+                m_hi_[j] = t;
+            }
+        } else {
+            T s, e;
+            two_sum(m_hi_[j], x, s, e);
+            e += m_lo_[j];
+            fast_two_sum(s, e, m_hi_[j], m_lo_[j]);
+        }
+    }
+
+    /// Adds @p a * @p b to lane @p j, exactly split with an FMA if possible
+    void add_product(std::size_t j, T a, T b) noexcept {
+        if constexpr(A == Accumulation::double_double && has_std_fma<T> &&
+                     !type_traits::is_complex_v<T>) {
+            const auto p = a * b;
+            add(j, p);
+            m_lo_[j] += std::fma(a, b, -p);
+        } else {
+            add(j, a * b);
+        }
+    }
+
+    /// Combines the lanes
+    Partial<T> result() const noexcept {
+        std::array<Partial<T>, reduction_lanes> lanes;
+        for(std::size_t j = 0; j < reduction_lanes; ++j)
+            lanes[j] = Partial<T>{m_hi_[j], m_lo_[j]};
+        return pairwise_sum(std::span<Partial<T>>(lanes));
+    }
+
+private:
+    /// The leading part of each lane
+    std::array<T, reduction_lanes> m_hi_{};
+
+    /// The trailing part of each lane (unused by naive and pairwise)
+    std::array<T, reduction_lanes> m_lo_{};
+};
+
+/** @brief Accumulates the terms [@p begin, @p end) as @p A.
+ *
+ *  @p term(acc, j, i) must add term i to lane j of the LaneAccumulator
+ *  acc. Pairwise accumulation halves the range (at a multiple of
+ *  reduction_lanes) until it is at most pairwise_base_size terms long.
+ */
+template<Accumulation A, typename T, typename Term>
+Partial<T> accumulate(std::size_t begin, std::size_t end, Term& term) {
+    constexpr auto k = reduction_lanes;
+    if constexpr(A == Accumulation::pairwise) {
+        if(end - begin > pairwise_base_size) {
+            const auto middle = begin + (end - begin) / (2 * k) * k;
+            return accumulate<A, T>(begin, middle, term) +
+                   accumulate<A, T>(middle, end, term);
+        }
+    }
+    LaneAccumulator<A, T> acc;
+    const auto n_full = begin + (end - begin) / k * k;
+    for(std::size_t i = begin; i < n_full; i += k)
+        for(std::size_t j = 0; j < k; ++j) term(acc, j, i + j);
+    for(std::size_t i = n_full; i < end; ++i) term(acc, i - n_full, i);
+    return acc.result();
+}
+
+/** @brief Chunks @p n elements for a reduction in @p mode.
+ *
+ *  Reproducible reductions use reproducible_block_size chunks, whatever
+ *  @p policy says. Fast reductions use one chunk per thread.
+ */
+inline ExecutionPolicy reduction_policy(ReductionMode mode,
+                                        ExecutionPolicy policy,
+                                        std::size_t n) noexcept {
+    if(mode == ReductionMode::reproducible) {
+        policy.grain_size = reproducible_block_size;
+        return policy;
+    }
+    auto n_threads = policy.n_threads;
+    if(n_threads == 0) n_threads = parallel::max_threads();
+    n_threads         = std::max<std::size_t>(n_threads, 1);
+    policy.grain_size = std::max<std::size_t>((n + n_threads - 1) / n_threads,
+                                              1);
+    return policy;
+}
+
+/** @brief Reduces @p spans to a single T, as set by @p options.
+ *
+ *  @p term(acc, j, xs...) must add the term made from one element of each
+ *  span to lane j of acc. The spans are split into pieces by
+ *  parallel_visit_spans; each piece is accumulated with accumulate() and
+ *  the partial results of the pieces are added with pairwise_sum.
+ */
+template<typename T, typename Term, typename Span0, typename... Spans>
+Partial<T> reduce(ReductionOptions options, ExecutionPolicy policy,
+                  Term term, Span0 span0, Spans... spans) {
+    auto run = [&]<Accumulation A>() {
+        auto kernel = [&term](auto chunk0, auto... chunks) {
+            auto chunk_term = [&](auto& acc, std::size_t j, std::size_t i) {
+                term(acc, j, chunk0[i], chunks[i]...);
+            };
+            return accumulate<A, T>(0, chunk0.size(), chunk_term);
+        };
+        const auto chunking = reduction_policy(options.mode, policy,
+                                               span0.size());
+        auto partials = parallel_visit_spans(chunking, kernel, span0, spans...);
+        return pairwise_sum(std::span(partials));
+    };
+    switch(options.accumulation) {
+        case Accumulation::pairwise:
+            return run.template operator()<Accumulation::pairwise>();
+        case Accumulation::neumaier:
+            return run.template operator()<Accumulation::neumaier>();
+        case Accumulation::double_double:
+            return run.template operator()<Accumulation::double_double>();
+        default: return run.template operator()<Accumulation::naive>();
+    }
+}
+
+} // namespace detail_
+
+/** @brief Adds up the elements of @p buffer, in parallel.
+ *
+ *  @relates FloatBuffer
+ *
+ *  @tparam TupleType The floating-point types @p buffer may hold.
+ *
+ *  The sum is accumulated in the type of the elements, as selected by
+ *  options.accumulation (see Accumulation). In ReductionMode::reproducible
+ *  the elements are summed in blocks of detail_::reproducible_block_size
+ *  elements and the block sums are then added as a pairwise tree over the
+ *  block index. Neither the blocks nor the tree depend on how many threads
+ *  compute them, so the result is the same, bit for bit, at any thread
+ *  count. ReductionMode::fast gives each thread one contiguous piece
+ *  instead, which saves storing the block sums but makes the rounding
+ *  depend on the number of threads.
+ *
+ *  @param[in] buffer The buffer to sum. Must be contiguous.
+ *  @param[in] options How to split and accumulate the sum. Defaults to
+ *                     ReductionMode::fast and Accumulation::naive.
+ *  @param[in] policy How many threads to use and, optionally, their
+ *                    floating-point environment. The grain size is
+ *                    ignored. Defaults to execution::par.
+ *
+ *  @return A Float holding the sum, which has the type of the elements. The
+ *          sum of no elements is zero.
+ *
+ *  @throw std::runtime_error if @p buffer does not hold one of the types in
+ *                            @p TupleType contiguously. Strong throw
+ *                            guarantee.
+ *  @throw std::bad_alloc if storing the partial sums fails. Strong throw
+ *                        guarantee.
+ *  @throw std::system_error if the default thread pool has to be created
+ *                           and can not be. Strong throw guarantee.
+ */
+template<typename TupleType>
+fp::Float sum(const FloatBuffer& buffer, ReductionOptions options = {},
+              ExecutionPolicy policy = execution::par) {
+    auto visitor = [&](auto values) {
+        using value_type = typename decltype(values)::value_type;
+        auto term = [](auto& acc, std::size_t j, value_type x) {
+            acc.add(j, x);
+        };
+        auto rv = detail_::reduce<value_type>(options, policy, term, values);
+        return fp::Float(rv.value());
+    };
+    return visit_contiguous_buffer<TupleType>(visitor, buffer);
+}
+
+/** @brief Computes the inner product of @p lhs and @p rhs, in parallel.
+ *
+ *  @relates FloatBuffer
+ *
+ *  @tparam TupleType The floating-point types the buffers may hold.
+ *
+ *  For complex buffers @p lhs is conjugated, i.e., the result is the sum of
+ *  conj(lhs[i]) * rhs[i], so that dot(x, x) is the squared norm of x. For
+ *  real buffers the result is the sum of lhs[i] * rhs[i]. The products are
+ *  summed as for sum(); with Accumulation::double_double the rounding error
+ *  of each real product is accumulated too.
+ *
+ *  @param[in] lhs The (conjugated) left operand. Must be contiguous.
+ *  @param[in] rhs The right operand. Must be contiguous.
+ *  @param[in] options How to split and accumulate the sum. Defaults to
+ *                     ReductionMode::fast and Accumulation::naive.
+ *  @param[in] policy How many threads to use and, optionally, their
+ *                    floating-point environment. The grain size is
+ *                    ignored. Defaults to execution::par.
+ *
+ *  @return A Float holding the result, which has the type of the elements.
+ *
+ *  @throw std::invalid_argument if @p lhs and @p rhs differ in size or hold
+ *                               different types. Strong throw guarantee.
+ *  @throw std::runtime_error if either buffer does not hold one of the types
+ *                            in @p TupleType contiguously. Strong throw
+ *                            guarantee.
+ *  @throw std::bad_alloc if storing the partial sums fails. Strong throw
+ *                        guarantee.
+ *  @throw std::system_error if the default thread pool has to be created
+ *                           and can not be. Strong throw guarantee.
+ */
+template<typename TupleType>
+fp::Float dot(const FloatBuffer& lhs, const FloatBuffer& rhs,
+              ReductionOptions options = {},
+              ExecutionPolicy policy   = execution::par) {
+    if(lhs.size() != rhs.size()) {
+        throw std::invalid_argument("dot: buffers have different sizes");
+    }
+    auto visitor = [&](auto a, auto b) -> fp::Float {
+        using lhs_type = typename decltype(a)::value_type;
+        using rhs_type = typename decltype(b)::value_type;
+        if constexpr(!std::is_same_v<lhs_type, rhs_type>) {
+            throw std::invalid_argument("dot: buffers hold different types");
+        } else {
+            auto term = [](auto& acc, std::size_t j, lhs_type x, lhs_type y) {
+                if constexpr(type_traits::is_complex_v<lhs_type>) {
+                    acc.add_product(j, std::conj(x), y);
+                } else {
+                    acc.add_product(j, x, y);
+                }
+            };
+            auto rv = detail_::reduce<lhs_type>(options, policy, term, a, b);
+            return fp::Float(rv.value());
+        }
+    };
+    return visit_contiguous_buffer<TupleType>(visitor, lhs, rhs);
+}
+
+/** @brief Computes the Euclidean norm of @p buffer, in parallel.
+ *
+ *  @relates FloatBuffer
+ *
+ *  The squared magnitudes of the elements are summed as for sum() (for
+ *  complex elements the squares of the real and imaginary parts) and the
+ *  square root of the sum is returned. The squares are not rescaled, so
+ *  elements whose squares overflow (or underflow) the element type give an
+ *  infinite (or inaccurate) norm.
+ *
+ *  @tparam TupleType The floating-point types @p buffer may hold.
+ *
+ *  @param[in] buffer The buffer whose norm is wanted. Must be contiguous.
+ *  @param[in] options How to split and accumulate the sum of squares.
+ *                     Defaults to ReductionMode::fast and
+ *                     Accumulation::naive.
+ *  @param[in] policy How many threads to use and, optionally, their
+ *                    floating-point environment. The grain size is
+ *                    ignored. Defaults to execution::par.
+ *
+ *  @return A Float holding the norm. For real buffers it has the type of
+ *          the elements, for complex buffers the type of their parts.
+ *
+ *  @throw std::runtime_error if @p buffer does not hold one of the types in
+ *                            @p TupleType contiguously. Strong throw
+ *                            guarantee.
+ *  @throw std::bad_alloc if storing the partial sums fails. Strong throw
+ *                        guarantee.
+ *  @throw std::system_error if the default thread pool has to be created
+ *                           and can not be. Strong throw guarantee.
+ */
+template<typename TupleType>
+fp::Float norm(const FloatBuffer& buffer, ReductionOptions options = {},
+               ExecutionPolicy policy = execution::par) {
+    auto visitor = [&](auto values) {
+        using value_type = typename decltype(values)::value_type;
+        using real_type  = type_traits::real_type_t<value_type>;
+        auto term        = [](auto& acc, std::size_t j, value_type x) {
+            if constexpr(type_traits::is_complex_v<value_type>) {
+                acc.add_product(j, x.real(), x.real());
+                acc.add_product(j, x.imag(), x.imag());
+            } else {
+                acc.add_product(j, x, x);
+            }
+        };
+        auto rv = detail_::reduce<real_type>(options, policy, term, values);
+        return fp::Float(detail_::square_root(rv.value()));
+    };
+    return visit_contiguous_buffer<TupleType>(visitor, buffer);
+}
+
+} // namespace wtf::buffer
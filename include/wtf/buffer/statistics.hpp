@@ -0,0 +1,420 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+#include <wtf/buffer/buffer_view.hpp>
+#include <wtf/buffer/parallel_visit.hpp>
+#include <wtf/buffer/reductions.hpp>
+#include <wtf/fp/float.hpp>
+#include <wtf/type_traits/is_complex.hpp>
+
+/** @file statistics.hpp
+ *
+ *  Descriptive statistics and histograms of buffers, made in one pass over
+ *  memory. The elements are converted to double a block at a time. Each
+ *  block is reduced with several independent accumulators, which
+ *  vectorizes, and the squared deviations are summed in a second pass over
+ *  the block while it is still in cache. The results of blocks, chunks and
+ *  separate calls are combined with the same merge, so streamed data can be
+ *  described piece by piece.
+ */
+
+namespace wtf::buffer {
+
+/** @brief Count, mean, variance and range of a set of values.
+ *
+ *  Only finite values enter the count, the mean, the variance and the
+ *  range; NaNs and infinities are only counted. The variance is kept as
+ *  m2, the sum of the squared deviations from the mean, which two
+ *  Statistics can be merged by without loss of accuracy (Chan et al.).
+ */
+struct Statistics {
+    /// Type used for counts
+    using size_type = std::size_t;
+
+    /// Number of finite values
+    size_type count = 0;
+
+    /// Number of NaNs
+    size_type nan_count = 0;
+
+    /// Number of infinities (of either sign)
+    size_type inf_count = 0;
+
+    /// Mean of the finite values (0 if there are none)
+    double mean = 0.0;
+
+    /// Sum of the squared deviations of the finite values from mean
+    double m2 = 0.0;
+
+    /// Smallest finite value (+infinity if there are none)
+    double min = std::numeric_limits<double>::infinity();
+
+    /// Largest finite value (-infinity if there are none)
+    double max = -std::numeric_limits<double>::infinity();
+
+    /// Number of values, finite or not
+    size_type size() const noexcept { return count + nan_count + inf_count; }
+
+    /// Population variance of the finite values (0 if there are none)
+    double variance() const noexcept {
+        return count == 0 ? 0.0 : m2 / static_cast<double>(count);
+    }
+
+    /// Sample (Bessel-corrected) variance, 0 for fewer than two values
+    double sample_variance() const noexcept {
+        return count < 2 ? 0.0 : m2 / static_cast<double>(count - 1);
+    }
+
+    /// Population standard deviation of the finite values
+    double stddev() const noexcept { return std::sqrt(variance()); }
+
+    /** @brief Adds the single value @p x, by Welford's update.
+     *
+     *  @throw None No throw guarantee.
+     */
+    void add(double x) noexcept;
+
+    /** @brief Makes *this describe its values and those of @p other.
+     *
+     *  @return *this, after the merge.
+     *
+     *  @throw None No throw guarantee.
+     */
+    Statistics& merge(const Statistics& other) noexcept;
+
+    /// Are all the members equal?
+    bool operator==(const Statistics&) const = default;
+};
+
+/** @brief Counts values in equal-width bins over [lower, upper).
+ *
+ *  Bin i holds the values in [lower + i * w, lower + (i + 1) * w), where w
+ *  is (upper - lower) / n_bins (up to rounding at the edges). Values below
+ *  lower, including -infinity, are counted as underflow; values not below
+ *  upper, including +infinity, as overflow; NaNs separately.
+ *
+ *  Histograms with the same binning can be merged, so a histogram of a
+ *  large or streamed data set can be made from histograms of its pieces.
+ */
+class Histogram {
+public:
+    /// Type used for counts
+    using size_type = std::size_t;
+
+    /// Largest number of bins a Histogram can have
+    static constexpr size_type max_bins =
+      std::numeric_limits<std::int32_t>::max() - 3;
+
+    /** @brief Creates a histogram of @p n_bins empty bins over
+     *         [@p lower, @p upper).
+     *
+     *  @throw std::invalid_argument if @p n_bins is 0 or above max_bins, or
+     *                               if the range is not finite and
+     *                               non-empty. Strong throw guarantee.
+     *  @throw std::bad_alloc if allocating the bins fails. Strong throw
+     *                        guarantee.
+     */
+    Histogram(double lower, double upper, size_type n_bins);
+
+    /// The lower edge of the first bin
+    double lower() const noexcept { return m_lower_; }
+
+    /// The upper edge of the last bin
+    double upper() const noexcept { return m_upper_; }
+
+    /// The number of bins
+    size_type n_bins() const noexcept { return m_counts_.size() - 3; }
+
+    /// The counts of the bins, in order
+    std::span<const size_type> counts() const noexcept {
+        return std::span(m_counts_).subspan(1, n_bins());
+    }
+
+    /// The number of values below lower()
+    size_type underflow() const noexcept { return m_counts_.front(); }
+
+    /// The number of values not below upper()
+    size_type overflow() const noexcept { return m_counts_[n_bins() + 1]; }
+
+    /// The number of NaNs
+    size_type nan_count() const noexcept { return m_counts_.back(); }
+
+    /// The number of values added, in any bin or none
+    size_type size() const noexcept;
+
+    /** @brief Counts the value @p x.
+     *
+     *  @throw None No throw guarantee.
+     */
+    void add(double x) noexcept;
+
+    /** @brief Counts the values in @p values.
+     *
+     *  The bins of a block of values are worked out with branch-free
+     *  arithmetic (which vectorizes) before any count is incremented.
+     *
+     *  @throw None No throw guarantee.
+     */
+    void add(std::span<const double> values) noexcept;
+
+    /** @brief Adds the counts of @p other to those of *this.
+     *
+     *  @return *this, after the merge.
+     *
+     *  @throw std::invalid_argument if @p other has a different binning.
+     *                               Strong throw guarantee.
+     */
+    Histogram& merge(const Histogram& other);
+
+    /// Do the histograms have the same binning and counts?
+    bool operator==(const Histogram&) const = default;
+
+private:
+    /// The lower edge of the first bin
+    double m_lower_;
+
+    /// The upper edge of the last bin
+    double m_upper_;
+
+    /// Number of bins per unit
+    double m_scale_;
+
+    /// Underflow, then the bins, then overflow, then NaNs
+    std::vector<size_type> m_counts_;
+};
+
+namespace detail_ {
+
+/// Number of elements converted to double and described at a time
+inline constexpr std::size_t statistics_block_size = 1024;
+
+/// Can statistics be made of elements of type @p T?
+template<typename T>
+inline constexpr bool has_statistics_v =
+  !type_traits::is_complex_v<T> && std::is_convertible_v<T, double>;
+
+/** @brief Describes the @p n values at @p x, for @p n at most
+ *         statistics_block_size.
+ *
+ *  The sum, the counts and the range are accumulated in reduction_lanes
+ *  lanes (the counts as doubles, which are exact for any block) and the
+ *  squared deviations from the block's mean in a second pass. Non-finite
+ *  values are replaced by neutral values with selects, not skipped.
+ */
+inline Statistics block_statistics(const double* x, std::size_t n) noexcept {
+    constexpr auto k   = reduction_lanes;
+    constexpr auto big = std::numeric_limits<double>::max();
+    constexpr auto inf = std::numeric_limits<double>::infinity();
+    std::array<double, k> sum{}, finite{}, nan{}, lo, hi;
+    lo.fill(inf);
+    hi.fill(-inf);
+
+    // Every select is computed into its own value first. Otherwise GCC
+    // merges the selects on is_finite into a branch, and std::min/std::max
+    // (which return references) are not if-converted either; both stop the
+    // loop over the lanes from vectorizing.
+    auto first = [&](std::size_t j, double v) {
+        const bool is_finite = std::abs(v) <= big;
+        const auto value     = is_finite ? v : 0.0;
+        const auto one       = is_finite ? 1.0 : 0.0;
+        const auto low       = is_finite ? v : inf;
+        const auto high      = is_finite ? v : -inf;
+        sum[j] += value;
+        finite[j] += one;
+        nan[j] += v != v ? 1.0 : 0.0;
+        lo[j] = low < lo[j] ? low : lo[j];
+        hi[j] = high > hi[j] ? high : hi[j];
+    };
+    const auto n_full = n / k * k;
+    for(std::size_t i = 0; i < n_full; i += k)
+        for(std::size_t j = 0; j < k; ++j) first(j, x[i + j]);
+    for(std::size_t i = n_full; i < n; ++i) first(i - n_full, x[i]);
+
+    Statistics rv;
+    double total = 0.0, n_finite = 0.0, n_nan = 0.0;
+    for(std::size_t j = 0; j < k; ++j) {
+        total += sum[j];
+        n_finite += finite[j];
+        n_nan += nan[j];
+        rv.min = std::min(rv.min, lo[j]);
+        rv.max = std::max(rv.max, hi[j]);
+    }
+    rv.count     = static_cast<std::size_t>(n_finite);
+    rv.nan_count = static_cast<std::size_t>(n_nan);
+    rv.inf_count = n - rv.count - rv.nan_count;
+    if(rv.count == 0) return rv;
+    rv.mean = total / n_finite;
+
+    // Non-finite values are replaced by the mean before subtracting it
+    std::array<double, k> m2{};
+    const auto mean = rv.mean;
+    auto second     = [&](std::size_t j, double v) {
+        const auto value = std::abs(v) <= big ? v : mean;
+        const auto d     = value - mean;
+        m2[j] += d * d;
+    };
+    for(std::size_t i = 0; i < n_full; i += k)
+        for(std::size_t j = 0; j < k; ++j) second(j, x[i + j]);
+    for(std::size_t i = n_full; i < n; ++i) second(i - n_full, x[i]);
+    for(std::size_t j = 0; j < k; ++j) rv.m2 += m2[j];
+    return rv;
+}
+
+/** @brief Describes @p values and, if @p histogram is not null, adds them
+ *         to it.
+ *
+ *  The blocks' statistics are merged in order.
+ */
+template<typename T>
+Statistics span_statistics(std::span<const T> values, Histogram* histogram) {
+    constexpr auto block_size = statistics_block_size;
+    std::array<double, block_size> x;
+    Statistics rv;
+    for(std::size_t i = 0; i < values.size(); i += block_size) {
+        const auto n = std::min(block_size, values.size() - i);
+        for(std::size_t j = 0; j < n; ++j)
+            x[j] = static_cast<double>(values[i + j]);
+        rv.merge(block_statistics(x.data(), n));
+        if(histogram != nullptr) histogram->add(std::span(x.data(), n));
+    }
+    return rv;
+}
+
+/// Implements statistics, with or without a histogram
+template<typename TupleType>
+Statistics statistics(BufferView<const fp::Float> view, Histogram* histogram,
+                      const ExecutionPolicy& policy) {
+    auto visitor = [&](auto values) -> Statistics {
+        using value_type = typename decltype(values)::value_type;
+        if constexpr(!has_statistics_v<value_type>) {
+            throw std::invalid_argument(
+              "statistics: elements are not real values convertible to "
+              "double");
+        } else {
+            using result_type = std::pair<Statistics, std::optional<Histogram>>;
+            auto kernel = [&](auto chunk) {
+                result_type rv;
+                if(histogram != nullptr) {
+                    rv.second.emplace(histogram->lower(), histogram->upper(),
+                                      histogram->n_bins());
+                }
+                const std::span<const value_type> chunk_values(chunk);
+                rv.first = span_statistics(chunk_values,
+                                           rv.second ? &*rv.second : nullptr);
+                return rv;
+            };
+            const auto chunking = reduction_policy(ReductionMode::fast, policy,
+                                                   values.size());
+            auto results = parallel_visit_spans(chunking, kernel, values);
+            Statistics rv;
+            for(const auto& [stats, chunk_histogram] : results) {
+                rv.merge(stats);
+                if(chunk_histogram) histogram->merge(*chunk_histogram);
+            }
+            return rv;
+        }
+    };
+    return visit_contiguous_buffer_view<TupleType>(visitor, view);
+}
+
+} // namespace detail_
+
+/** @brief Describes the elements of @p view in one parallel pass.
+ *
+ *  @relates BufferView
+ *
+ *  @tparam TupleType The floating-point types @p view may alias.
+ *
+ *  The elements are converted to double. Each thread describes one
+ *  contiguous piece (as for ReductionMode::fast) and the pieces are merged
+ *  in order, so the rounding of the mean and the variance may change with
+ *  the number of threads. To describe streamed data, merge the results of
+ *  the pieces with Statistics::merge.
+ *
+ *  @param[in] view The elements to describe. Must be contiguous and real.
+ *                  FloatBuffer objects convert implicitly.
+ *  @param[in] policy How many threads to use and, optionally, their
+ *                    floating-point environment. The grain size is
+ *                    ignored. Defaults to execution::par.
+ *
+ *  @return The statistics of the elements.
+ *
+ *  @throw std::runtime_error if @p view does not alias one of the types in
+ *                            @p TupleType contiguously. Strong throw
+ *                            guarantee.
+ *  @throw std::invalid_argument if the elements are complex or can not be
+ *                               converted to double. Strong throw
+ *                               guarantee.
+ *  @throw std::bad_alloc if storing the partial results fails. Strong throw
+ *                        guarantee.
+ *  @throw std::system_error if the default thread pool has to be created
+ *                           and can not be. Strong throw guarantee.
+ */
+template<typename TupleType>
+Statistics statistics(BufferView<const fp::Float> view,
+                      ExecutionPolicy policy = execution::par) {
+    return detail_::statistics<TupleType>(view, nullptr, policy);
+}
+
+/** @brief Describes the elements of @p view and counts them in
+ *         @p histogram, in the same parallel pass.
+ *
+ *  @relates BufferView
+ *
+ *  As statistics(view, policy), but each thread also counts its piece in a
+ *  private copy of the bins of @p histogram, and the copies are added to
+ *  @p histogram at the end. The counts already in @p histogram are kept, so
+ *  one histogram can collect several views.
+ *
+ *  @param[in] view The elements to describe. Must be contiguous and real.
+ *                  FloatBuffer objects convert implicitly.
+ *  @param[in,out] histogram The histogram to add the elements to.
+ *  @param[in] policy How many threads to use and, optionally, their
+ *                    floating-point environment. The grain size is
+ *                    ignored. Defaults to execution::par.
+ *
+ *  @return The statistics of the elements.
+ *
+ *  @throw std::runtime_error if @p view does not alias one of the types in
+ *                            @p TupleType contiguously. Strong throw
+ *                            guarantee.
+ *  @throw std::invalid_argument if the elements are complex or can not be
+ *                               converted to double. Strong throw
+ *                               guarantee.
+ *  @throw std::bad_alloc if allocating the private bins fails. Strong throw
+ *                        guarantee.
+ *  @throw std::system_error if the default thread pool has to be created
+ *                           and can not be. Strong throw guarantee.
+ */
+template<typename TupleType>
+Statistics statistics(BufferView<const fp::Float> view, Histogram& histogram,
+                      ExecutionPolicy policy = execution::par) {
+    return detail_::statistics<TupleType>(view, &histogram, policy);
+}
+
+} // namespace wtf::buffer
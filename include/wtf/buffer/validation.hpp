@@ -0,0 +1,358 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <span>
+#include <type_traits>
+#include <wtf/buffer/buffer_view.hpp>
+#include <wtf/buffer/parallel_visit.hpp>
+#include <wtf/fp/bfloat16.hpp>
+#include <wtf/fp/float.hpp>
+#include <wtf/fp/float128.hpp>
+#include <wtf/fp/half.hpp>
+#include <wtf/type_traits/is_complex.hpp>
+
+/** @file validation.hpp
+ *
+ *  Checks for NaNs, infinities and subnormals, meant to be run on the inputs
+ *  of expensive phases. For the IEEE 754 binary formats (float, double,
+ *  __float128, Half and BFloat16) an element is classified from its exponent
+ *  bits with integer operations only, so the scans auto-vectorize and run at
+ *  memory bandwidth.
+ *  Other types fall back to floating-point comparisons. A complex element is
+ *  non-finite (or subnormal) if either of its parts is. Like the reductions,
+ *  the scans split large buffers over threads as set by an ExecutionPolicy.
+ */
+
+namespace wtf::buffer {
+namespace detail_ {
+
+/// Number of elements a scan checks between tests for an early exit
+inline constexpr std::size_t scan_block_size = 1024;
+
+/** @brief Bit layout of an IEEE 754 binary format stored in a @p Bits.
+ *
+ *  Baseline x86-64 (SSE2) has no 64-bit integer compares, so formats wider
+ *  than 32 bits are classified from their most significant 32-bit word
+ *  (which holds the sign and the exponent) plus, where needed, the OR of
+ *  the rest. All compares are then on words of at most 32 bits.
+ */
+template<typename Bits, Bits Exponent>
+struct IeeeLayout : std::true_type {
+    /// Unsigned integer type holding the bit pattern
+    using bits_type = Bits;
+
+    /// Type of the most significant word
+    using word_type =
+      std::conditional_t<(sizeof(Bits) > 4), std::uint32_t, Bits>;
+
+    /// Number of bits below the most significant word
+    static constexpr int shift = 8 * (sizeof(Bits) - sizeof(word_type));
+
+    /// The bits of the exponent field, within the most significant word
+    static constexpr word_type exponent = Exponent >> shift;
+
+    /// Every bit but the sign bit, within the most significant word
+    static constexpr word_type magnitude =
+      std::numeric_limits<word_type>::max() >> 1;
+
+    /// The most significant word of @p bits
+    static word_type high_word(bits_type bits) noexcept {
+        return static_cast<word_type>(bits >> shift);
+    }
+
+    /// Are any of the bits below the most significant word set?
+    static bool low_bits(bits_type bits) noexcept {
+        bool rv = false;
+        for(int i = 0; i < shift; i += 32)
+            rv |= static_cast<std::uint32_t>(bits >> i) != 0;
+        return rv;
+    }
+};
+
+/// Bit layout of @p T, or std::false_type if it is not an IEEE binary format
+template<typename T>
+struct IeeeBits : std::false_type {};
+
+/// Layout of float (binary32)
+template<>
+struct IeeeBits<float> : IeeeLayout<std::uint32_t, 0x7f800000u> {};
+
+/// Layout of double (binary64)
+template<>
+struct IeeeBits<double> : IeeeLayout<std::uint64_t, 0x7ff0000000000000u> {};
+
+#ifdef WTF_HAS_FLOAT128
+/// Unsigned integer type holding the bits of a __float128
+__extension__ typedef unsigned __int128 float128_bits_type;
+
+/// Layout of __float128 (binary128)
+template<>
+struct IeeeBits<__float128>
+  : IeeeLayout<float128_bits_type, float128_bits_type{0x7fff} << 112> {};
+#endif
+
+/// Layout of Half (binary16)
+template<>
+struct IeeeBits<fp::Half> : IeeeLayout<fp::detail_::bits16_type, 0x7c00u> {};
+
+/// Layout of BFloat16
+template<>
+struct IeeeBits<fp::BFloat16>
+  : IeeeLayout<fp::detail_::bits16_type, 0x7f80u> {};
+
+/// The bit pattern of @p x
+template<typename T>
+auto ieee_bits(T x) noexcept {
+    if constexpr(std::is_class_v<T>) {
+        return x.bits();
+    } else {
+        return std::bit_cast<typename IeeeBits<T>::bits_type>(x);
+    }
+}
+
+/// Is @p x a NaN or an infinity?
+template<typename T>
+bool is_nonfinite(T x) noexcept {
+    if constexpr(type_traits::is_complex_v<T>) {
+        return is_nonfinite(x.real()) | is_nonfinite(x.imag());
+    } else if constexpr(IeeeBits<T>::value) {
+        using layout = IeeeBits<T>;
+        const auto high = layout::high_word(ieee_bits(x));
+        return (high & layout::exponent) == layout::exponent;
+    } else {
+        // x - x is NaN exactly for NaN and infinite x
+        const T difference = x - x;
+        return !(difference == difference);
+    }
+}
+
+/// Is @p x subnormal (non-zero, but smaller in magnitude than the smallest
+/// normal value)?
+template<typename T>
+bool is_subnormal(T x) noexcept {
+    if constexpr(type_traits::is_complex_v<T>) {
+        return is_subnormal(x.real()) | is_subnormal(x.imag());
+    } else if constexpr(IeeeBits<T>::value) {
+        using layout    = IeeeBits<T>;
+        const auto bits = ieee_bits(x);
+        const auto high = layout::high_word(bits);
+        return ((high & layout::exponent) == 0) &
+               (((high & layout::magnitude) != 0) | layout::low_bits(bits));
+    } else if constexpr(std::numeric_limits<T>::is_specialized) {
+        const auto min = std::numeric_limits<T>::min();
+        return x != T{0} && x < min && -x < min;
+    } else {
+        return false;
+    }
+}
+
+/// How many of the scan_block_size elements starting at @p p does @p test
+/// hold for? The fixed trip count and 32-bit counter let this vectorize.
+template<typename T, typename Test>
+std::uint32_t count_block(const T* p, Test test) noexcept {
+    std::uint32_t rv = 0;
+    for(std::size_t i = 0; i < scan_block_size; ++i) rv += test(p[i]);
+    return rv;
+}
+
+/// How many elements of @p values does @p test hold for?
+template<typename T, typename Test>
+std::size_t count_if(std::span<T> values, Test test) noexcept {
+    std::size_t rv = 0;
+    std::size_t i  = 0;
+    for(; i + scan_block_size <= values.size(); i += scan_block_size)
+        rv += count_block(values.data() + i, test);
+    for(; i < values.size(); ++i) rv += test(values[i]);
+    return rv;
+}
+
+/** @brief The index of the first element of @p values which is not finite.
+ *
+ *  The elements are counted a block at a time, which vectorizes, and only a
+ *  block with a hit is searched element by element.
+ *
+ *  @return The index, or values.size() if every element is finite.
+ */
+template<typename T>
+std::size_t find_nonfinite(std::span<T> values) noexcept {
+    auto test    = [](auto x) { return is_nonfinite(x); };
+    std::size_t i = 0;
+    while(i + scan_block_size <= values.size() &&
+          count_block(values.data() + i, test) == 0)
+        i += scan_block_size;
+    const auto rest = values.subspan(i);
+    return i + static_cast<std::size_t>(
+                 std::find_if(rest.begin(), rest.end(), test) - rest.begin());
+}
+
+/// Counts the elements of @p view for which @p test holds, in parallel
+template<typename TupleType, typename Test>
+std::size_t parallel_count_if(BufferView<const fp::Float> view,
+                              const ExecutionPolicy& policy, Test test) {
+    auto visitor = [&](auto values) {
+        auto kernel = [&](auto chunk) { return count_if(chunk, test); };
+        auto counts = parallel_visit_spans(policy, kernel, values);
+        std::size_t rv = 0;
+        for(auto n : counts) rv += n;
+        return rv;
+    };
+    return visit_contiguous_buffer_view<TupleType>(visitor, view);
+}
+
+} // namespace detail_
+
+/** @brief The index of the first NaN or infinity in @p view.
+ *
+ *  @relates BufferView
+ *
+ *  @tparam TupleType The floating-point types @p view may alias.
+ *
+ *  Large views are split over threads as set by @p policy. Once a thread
+ *  finds a non-finite element the threads skip the chunks after it.
+ *
+ *  @param[in] view The elements to check. Must be contiguous. FloatBuffer
+ *                  objects convert implicitly.
+ *  @param[in] policy How to split the scan. Defaults to execution::par.
+ *
+ *  @return The index of the first element which is a NaN or an infinity (for
+ *          complex elements, has such a part), or an empty optional if all
+ *          elements are finite.
+ *
+ *  @throw std::runtime_error if @p view does not alias one of the types in
+ *                            @p TupleType contiguously. Strong throw
+ *                            guarantee.
+ *  @throw std::system_error if the default thread pool has to be created
+ *                           and can not be. Strong throw guarantee.
+ */
+template<typename TupleType>
+std::optional<std::size_t> find_first_nonfinite(
+  BufferView<const fp::Float> view, ExecutionPolicy policy = execution::par) {
+    auto visitor = [&](auto values) {
+        constexpr auto none = std::numeric_limits<std::size_t>::max();
+        std::atomic<std::size_t> first{none};
+        auto kernel = [&](std::size_t offset, auto chunk) {
+            if(offset > first.load(std::memory_order_relaxed)) return;
+            const auto i = detail_::find_nonfinite(chunk);
+            if(i == chunk.size()) return;
+            auto current = first.load(std::memory_order_relaxed);
+            while(offset + i < current &&
+                  !first.compare_exchange_weak(current, offset + i)) {}
+        };
+        detail_::parallel_visit_spans(policy, kernel, values);
+        const auto rv = first.load();
+        return rv == none ? std::nullopt : std::optional<std::size_t>(rv);
+    };
+    return visit_contiguous_buffer_view<TupleType>(visitor, view);
+}
+
+/** @brief Does @p view hold a NaN or an infinity?
+ *
+ *  @relates BufferView
+ *
+ *  @tparam TupleType The floating-point types @p view may alias.
+ *
+ *  @param[in] view The elements to check. Must be contiguous. FloatBuffer
+ *                  objects convert implicitly.
+ *  @param[in] policy How to split the scan. Defaults to execution::par.
+ *
+ *  @return True if any element is (or, for complex elements, has a part
+ *          which is) a NaN or an infinity and false otherwise.
+ *
+ *  @throw std::runtime_error if @p view does not alias one of the types in
+ *                            @p TupleType contiguously. Strong throw
+ *                            guarantee.
+ *  @throw std::system_error if the default thread pool has to be created
+ *                           and can not be. Strong throw guarantee.
+ */
+template<typename TupleType>
+bool has_nonfinite(BufferView<const fp::Float> view,
+                   ExecutionPolicy policy = execution::par) {
+    auto visitor = [&](auto values) {
+        std::atomic<bool> found{false};
+        auto kernel = [&](auto chunk) {
+            if(found.load(std::memory_order_relaxed)) return;
+            if(detail_::find_nonfinite(chunk) != chunk.size()) found = true;
+        };
+        detail_::parallel_visit_spans(policy, kernel, values);
+        return found.load();
+    };
+    return visit_contiguous_buffer_view<TupleType>(visitor, view);
+}
+
+/** @brief Counts the NaNs and infinities in @p view.
+ *
+ *  @relates BufferView
+ *
+ *  @tparam TupleType The floating-point types @p view may alias.
+ *
+ *  @param[in] view The elements to check. Must be contiguous. FloatBuffer
+ *                  objects convert implicitly.
+ *  @param[in] policy How to split the scan. Defaults to execution::par.
+ *
+ *  @return The number of elements which are (or, for complex elements, have
+ *          a part which is) a NaN or an infinity.
+ *
+ *  @throw std::runtime_error if @p view does not alias one of the types in
+ *                            @p TupleType contiguously. Strong throw
+ *                            guarantee.
+ *  @throw std::system_error if the default thread pool has to be created
+ *                           and can not be. Strong throw guarantee.
+ */
+template<typename TupleType>
+std::size_t count_nonfinite(BufferView<const fp::Float> view,
+                            ExecutionPolicy policy = execution::par) {
+    auto test = [](auto x) { return detail_::is_nonfinite(x); };
+    return detail_::parallel_count_if<TupleType>(view, policy, test);
+}
+
+/** @brief Counts the subnormal values in @p view.
+ *
+ *  @relates BufferView
+ *
+ *  Zero is not subnormal. Types which are not IEEE binary formats and do not
+ *  specialize std::numeric_limits have no subnormals.
+ *
+ *  @tparam TupleType The floating-point types @p view may alias.
+ *
+ *  @param[in] view The elements to check. Must be contiguous. FloatBuffer
+ *                  objects convert implicitly.
+ *  @param[in] policy How to split the scan. Defaults to execution::par.
+ *
+ *  @return The number of elements which are (or, for complex elements, have
+ *          a part which is) subnormal.
+ *
+ *  @throw std::runtime_error if @p view does not alias one of the types in
+ *                            @p TupleType contiguously. Strong throw
+ *                            guarantee.
+ *  @throw std::system_error if the default thread pool has to be created
+ *                           and can not be. Strong throw guarantee.
+ */
+template<typename TupleType>
+std::size_t count_subnormal(BufferView<const fp::Float> view,
+                            ExecutionPolicy policy = execution::par) {
+    auto test = [](auto x) { return detail_::is_subnormal(x); };
+    return detail_::parallel_count_if<TupleType>(view, policy, test);
+}
+
+} // namespace wtf::buffer
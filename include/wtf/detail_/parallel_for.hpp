@@ -0,0 +1,116 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <wtf/parallel/executor.hpp>
+
+namespace wtf::detail_ {
+
+/** @brief The static chunking shared by WTF's parallel kernels.
+ *
+ *  @p n elements are split over at most @p n_threads threads. Thread i
+ *  processes elements [i * chunk, (i + 1) * chunk), where chunk is @p n
+ *  divided by the number of threads, rounded up. Because every parallel
+ *  kernel (and the first-touch buffer factories) use this same split, and
+ *  chunk i is submitted with the same hint every time, thread i usually
+ *  touches the same elements. With threads pinned to cores, the pages a
+ *  thread first touched then stay on its NUMA node. This is best-effort:
+ *  idle threads steal chunks (see parallel_for), so a chunk can run on
+ *  another thread.
+ *
+ *  @param[in] n The number of elements.
+ *  @param[in] n_threads The maximum number of threads. 0 is treated as 1.
+ *
+ *  @return The number of elements per chunk (at least 1).
+ *
+ *  @throw None No throw guarantee.
+ */
+inline std::size_t static_chunk_size(std::size_t n,
+                                     std::size_t n_threads) noexcept {
+    n_threads = std::max<std::size_t>(std::min(n_threads, n), 1);
+    return std::max<std::size_t>((n + n_threads - 1) / n_threads, 1);
+}
+
+/** @brief Calls @p fxn(begin, end) for each static chunk of [0, @p n).
+ *
+ *  The first chunk runs on the calling thread. The others are submitted to
+ *  the current executor (see wtf::parallel::executor()), chunk i with hint
+ *  i - 1, so the default ThreadPool queues the same chunk with the same
+ *  worker every time. Which thread runs a chunk is not guaranteed though:
+ *  a busy worker's chunks may be stolen by idle workers, and while waiting
+ *  for its chunks the caller runs queued tasks, which may be chunks too.
+ *  If a chunk can not be submitted it is run on the calling thread instead.
+ *  Returns once every chunk is done.
+ *
+ *  @tparam Fxn The type of the callable. Must be callable as
+ *              fxn(std::size_t, std::size_t) and must not throw.
+ *
+ *  @param[in] n The number of elements.
+ *  @param[in] n_threads The maximum number of threads to use.
+ *  @param[in] fxn The work to do for a chunk.
+ *
+ *  @throw std::system_error if the default ThreadPool has to be created and
+ *                           can not be. Strong throw guarantee.
+ */
+template<typename Fxn>
+void parallel_for(std::size_t n, std::size_t n_threads, Fxn&& fxn) {
+    const auto chunk = static_chunk_size(n, n_threads);
+    if(chunk >= n) {
+        fxn(std::size_t{0}, n);
+        return;
+    }
+
+    // Shared, so the last task may still signal after the caller returned
+    const auto n_chunks  = (n + chunk - 1) / chunk;
+    const auto pexecutor = parallel::executor();
+    auto premaining = std::make_shared<std::atomic<std::size_t>>(n_chunks);
+    auto run_chunk  = [&fxn, n, chunk](std::size_t i) {
+        fxn(i * chunk, std::min((i + 1) * chunk, n));
+    };
+    auto finish_chunk = [](std::atomic<std::size_t>& remaining) {
+        if(remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            remaining.notify_all();
+    };
+
+    for(std::size_t i = 1; i < n_chunks; ++i) {
+        try {
+            pexecutor->submit(
+              [=]() {
+                  run_chunk(i);
+                  finish_chunk(*premaining);
+              },
+              i - 1);
+        } catch(...) {
+            run_chunk(i);
+            finish_chunk(*premaining);
+        }
+    }
+    run_chunk(0);
+    finish_chunk(*premaining);
+
+    auto& remaining = *premaining;
+    while(auto left = remaining.load(std::memory_order_acquire)) {
+        if(!pexecutor->run_pending_task())
+            remaining.wait(left, std::memory_order_acquire);
+    }
+}
+
+} // namespace wtf::detail_
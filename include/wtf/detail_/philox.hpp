@@ -0,0 +1,148 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <array>
+#include <cstdint>
+
+/** @file philox.hpp
+ *
+ *  The Philox counter-based random number generator of Salmon et al.,
+ *  "Parallel Random Numbers: As Easy as 1, 2, 3" (SC11). A counter-based
+ *  generator is a keyed hash of its counter: the i-th random number of a
+ *  stream is computed directly from i, so element i of a buffer gets the same
+ *  random bits no matter how the buffer is split over threads. The rounds
+ *  are multiplies, xors and adds of 32-bit words and do not branch, so loops
+ *  over them can be auto-vectorized.
+ */
+
+namespace wtf::detail_ {
+
+/// Number of rounds; 10 is the variant which passes BigCrush with margin
+inline constexpr int philox_rounds = 10;
+
+/// Multiplier of the Philox2x32 round function
+inline constexpr std::uint32_t philox2x32_multiplier = 0xD256D193u;
+
+/// Multipliers of the Philox4x32 round function
+inline constexpr std::array<std::uint32_t, 2> philox4x32_multipliers{
+  0xD2511F53u, 0xCD9E8D57u};
+
+/// Weyl increment added to the (first word of the) key after each round
+inline constexpr std::uint32_t philox_weyl = 0x9E3779B9u;
+
+/// Weyl increment added to the second word of a Philox4x32 key
+inline constexpr std::uint32_t philox_weyl_1 = 0xBB67AE85u;
+
+/// Type of the output of Philox2x32
+using philox2x32_type = std::array<std::uint32_t, 2>;
+
+/// Type of the counter and of the output of Philox4x32
+using philox4x32_type = std::array<std::uint32_t, 4>;
+
+/// Type of the key of Philox4x32
+using philox4x32_key_type = std::array<std::uint32_t, 2>;
+
+/** @brief Computes Philox2x32-10 of @p counter under @p key.
+ *
+ *  The low word of @p counter is the first word of the Philox counter.
+ *
+ *  @param[in] counter The position in the random stream.
+ *  @param[in] key Selects the random stream.
+ *
+ *  @return 64 random bits, as two 32-bit words.
+ *
+ *  @throw None No throw guarantee.
+ */
+inline philox2x32_type philox2x32(std::uint64_t counter,
+                                  std::uint32_t key) noexcept {
+    auto lo = static_cast<std::uint32_t>(counter);
+    auto hi = static_cast<std::uint32_t>(counter >> 32);
+    for(int round = 0; round < philox_rounds; ++round) {
+        const auto product = std::uint64_t{philox2x32_multiplier} * lo;
+        const auto next    = static_cast<std::uint32_t>(product >> 32) ^ key ^
+                          hi;
+        hi  = static_cast<std::uint32_t>(product);
+        lo  = next;
+        key += philox_weyl;
+    }
+    return {lo, hi};
+}
+
+/** @brief Hashes a 64-bit seed into a Philox2x32 key.
+ *
+ *  @param[in] seed The user-facing seed.
+ *
+ *  @return A key which, unlike simply truncating @p seed, depends on all 64
+ *          bits of @p seed.
+ *
+ *  @throw None No throw guarantee.
+ */
+inline std::uint32_t philox2x32_key(std::uint64_t seed) noexcept {
+    return philox2x32(seed, 0u)[0];
+}
+
+/** @brief Computes Philox4x32-10 of @p counter under @p key.
+ *
+ *  @param[in] counter The position in the random stream.
+ *  @param[in] key Selects the random stream.
+ *
+ *  @return 128 random bits, as four 32-bit words.
+ *
+ *  @throw None No throw guarantee.
+ */
+inline philox4x32_type philox4x32(philox4x32_type counter,
+                                  philox4x32_key_type key) noexcept {
+    constexpr auto m0 = std::uint64_t{philox4x32_multipliers[0]};
+    constexpr auto m1 = std::uint64_t{philox4x32_multipliers[1]};
+    for(int round = 0; round < philox_rounds; ++round) {
+        const auto product0 = m0 * counter[0];
+        const auto product1 = m1 * counter[2];
+        counter = {static_cast<std::uint32_t>(product1 >> 32) ^ counter[1] ^
+                     key[0],
+                   static_cast<std::uint32_t>(product1),
+                   static_cast<std::uint32_t>(product0 >> 32) ^ counter[3] ^
+                     key[1],
+                   static_cast<std::uint32_t>(product0)};
+        key[0] += philox_weyl;
+        key[1] += philox_weyl_1;
+    }
+    return counter;
+}
+
+/** @brief Computes Philox4x32-10 of the 64-bit @p counter under the 64-bit
+ *         @p seed.
+ *
+ *  The low words come first in both the counter (whose high 64 bits are
+ *  zero) and the key.
+ *
+ *  @param[in] counter The position in the random stream.
+ *  @param[in] seed Selects the random stream.
+ *
+ *  @return 128 random bits, as four 32-bit words.
+ *
+ *  @throw None No throw guarantee.
+ */
+inline philox4x32_type philox4x32(std::uint64_t counter,
+                                  std::uint64_t seed) noexcept {
+    const auto lo = [](std::uint64_t x) {
+        return static_cast<std::uint32_t>(x);
+    };
+    return philox4x32({lo(counter), lo(counter >> 32), 0u, 0u},
+                      {lo(seed), lo(seed >> 32)});
+}
+
+} // namespace wtf::detail_
@@ -0,0 +1,95 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <wtf/type_traits/type_name.hpp>
+
+namespace wtf::detail_ {
+
+/// The type visit_type_name returns (all overloads must agree)
+template<typename TupleType, typename Visitor>
+using visit_type_name_result_t =
+  std::invoke_result_t<Visitor,
+                       std::type_identity<std::tuple_element_t<0, TupleType>>>;
+
+/** @brief Implements visit_type_name by recursing over @p TupleType.
+ *
+ *  @tparam TupleType The std::tuple of types to search.
+ *  @tparam I The index of the type in @p TupleType to consider.
+ *  @tparam Visitor The type of the visitor to call.
+ *
+ *  @param[in] name The name of the type to find.
+ *  @param[in] visitor The visitor to call with the found type.
+ *
+ *  @return The result of calling @p visitor.
+ *
+ *  @throw std::runtime_error if no type in @p TupleType is named @p name.
+ *                            Strong throw guarantee.
+ *  @throw ??? if calling @p visitor throws. Same throw guarantee.
+ */
+template<typename TupleType, std::size_t I, typename Visitor>
+auto visit_type_name_impl(std::string_view name, Visitor&& visitor)
+  -> visit_type_name_result_t<TupleType, Visitor> {
+    if constexpr(I == std::tuple_size_v<TupleType>) {
+        throw std::runtime_error("Type \"" + std::string(name) +
+                                 "\" is not in the provided tuple");
+    } else {
+        using type = std::tuple_element_t<I, TupleType>;
+        if(name == std::string_view(type_traits::type_name_v<type>)) {
+            return visitor(std::type_identity<type>{});
+        }
+        return visit_type_name_impl<TupleType, I + 1>(
+          name, std::forward<Visitor>(visitor));
+    }
+}
+
+/** @brief Restores a type from its name.
+ *
+ *  @tparam TupleType A std::tuple of the types @p name may refer to. Must be
+ *                    explicitly provided by the caller.
+ *  @tparam Visitor The type of the visitor to call. Must be callable with a
+ *                  std::type_identity<T> object for each T in @p TupleType and
+ *                  all overloads must return the same type. Will be inferred
+ *                  by the compiler.
+ *
+ *  Serialized data (e.g., a file header) records its floating-point type as
+ *  a string, namely type_traits::type_name_v<T>. This function finds the T in
+ *  @p TupleType whose name is @p name and calls @p visitor with
+ *  std::type_identity<T>{}, thereby allowing the visitor to work with the
+ *  type at compile time.
+ *
+ *  @param[in] name The name of the type to restore.
+ *  @param[in] visitor The visitor to call with the restored type.
+ *
+ *  @return The result of calling @p visitor.
+ *
+ *  @throw std::runtime_error if no type in @p TupleType is named @p name.
+ *                            Strong throw guarantee.
+ *  @throw ??? if calling @p visitor throws. Same throw guarantee.
+ */
+template<typename TupleType, typename Visitor>
+decltype(auto) visit_type_name(std::string_view name, Visitor&& visitor) {
+    static_assert(std::tuple_size_v<TupleType> > 0, "TupleType is empty");
+    return visit_type_name_impl<TupleType, 0>(name,
+                                              std::forward<Visitor>(visitor));
+}
+
+} // namespace wtf::detail_
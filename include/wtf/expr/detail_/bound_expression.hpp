@@ -0,0 +1,91 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <cstddef>
+
+/** @file bound_expression.hpp
+ *
+ *  Once the element type of an expression's output is known, each node of the
+ *  expression is "bound" to that type. Bound nodes hold raw pointers and
+ *  values (never a type-erased object), so evaluating element i of a bound
+ *  expression is a handful of inlined loads and arithmetic operations, which
+ *  compilers can vectorize.
+ */
+
+namespace wtf::expr::detail_ {
+
+/** @brief A buffer bound to its element type @p T.
+ *
+ *  @tparam T The type of the elements.
+ */
+template<typename T>
+struct BoundBuffer {
+    /// Returns element @p i of the buffer
+    T operator[](std::size_t i) const noexcept { return m_data[i]; }
+
+    /// The first element of the buffer
+    const T* m_data;
+};
+
+/** @brief A scalar bound to the element type @p T.
+ *
+ *  @tparam T The type of the scalar.
+ */
+template<typename T>
+struct BoundScalar {
+    /// Returns the scalar, regardless of @p i
+    T operator[](std::size_t) const noexcept { return m_value; }
+
+    /// The value of the scalar
+    T m_value;
+};
+
+/** @brief Applies @p Op to elements of bound expressions @p L and @p R.
+ *
+ *  @tparam Op A default-constructible binary functor (e.g., std::plus<>).
+ *  @tparam L The type of the bound left operand.
+ *  @tparam R The type of the bound right operand.
+ */
+template<typename Op, typename L, typename R>
+struct BoundBinary {
+    /// Returns Op applied to element @p i of the operands
+    auto operator[](std::size_t i) const noexcept {
+        return Op{}(m_lhs[i], m_rhs[i]);
+    }
+
+    /// The bound left operand
+    L m_lhs;
+
+    /// The bound right operand
+    R m_rhs;
+};
+
+/** @brief Applies @p Op to elements of the bound expression @p E.
+ *
+ *  @tparam Op A default-constructible unary functor (e.g., std::negate<>).
+ *  @tparam E The type of the bound operand.
+ */
+template<typename Op, typename E>
+struct BoundUnary {
+    /// Returns Op applied to element @p i of the operand
+    auto operator[](std::size_t i) const noexcept { return Op{}(m_operand[i]); }
+
+    /// The bound operand
+    E m_operand;
+};
+
+} // namespace wtf::expr::detail_
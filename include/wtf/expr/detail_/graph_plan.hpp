@@ -0,0 +1,316 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <span>
+#include <vector>
+#include <wtf/detail_/parallel_for.hpp>
+
+/** @file graph_plan.hpp
+ *
+ *  A Graph is executed in two steps. make_plan turns the recorded nodes into
+ *  a GraphPlan, which does not depend on the element type. Element-wise nodes
+ *  used by only one other node are fused into that node's kernel. Only
+ *  kernels, i.e., nodes which are requested or used more than once, write
+ *  out n elements. Each kernel writes to a "slot". Slots of intermediate
+ *  kernels are handed to later kernels once their last reader has run. Then
+ *  run_plan executes the plan for one element type. Independent kernels (those
+ *  at the same level) run concurrently.
+ */
+
+namespace wtf::expr::detail_ {
+
+/// The operations a Graph node can perform
+enum class OpCode : unsigned char {
+    input,
+    scalar,
+    add,
+    subtract,
+    multiply,
+    divide,
+    negate
+};
+
+/** @brief One node of a Graph.
+ *
+ *  For input and scalar nodes @p lhs is the index of the buffer, or scalar,
+ *  the node reads. For all other nodes @p lhs and @p rhs are the indices of
+ *  the operand nodes (@p rhs is unused for unary operations). Operands always
+ *  precede the node, so node order is a topological order.
+ */
+struct GraphNode {
+    /// What the node does
+    OpCode op;
+
+    /// The first operand
+    std::size_t lhs = 0;
+
+    /// The second operand
+    std::size_t rhs = 0;
+};
+
+/// Where an instruction reads an operand from
+struct Argument {
+    /// The kinds of storage an argument can live in
+    enum class Kind : unsigned char { input, scalar, slot, temp };
+
+    /// The kind of storage
+    Kind kind = Kind::temp;
+
+    /// Which input buffer, scalar, slot, or temporary
+    std::size_t index = 0;
+};
+
+/// One element-wise operation of a kernel
+struct Instruction {
+    /// The operation (input and scalar copy @p lhs)
+    OpCode op;
+
+    /// The first operand
+    Argument lhs;
+
+    /// The second operand (only used by binary operations)
+    Argument rhs;
+
+    /// The temporary the result goes to (unused by a kernel's last one)
+    std::size_t result = 0;
+};
+
+/// A fused group of nodes, evaluated in one pass
+struct Kernel {
+    /// The fused operations, in evaluation order
+    std::vector<Instruction> instructions;
+
+    /// The kernels whose slots this kernel reads
+    std::vector<std::size_t> dependencies;
+
+    /// Number of temporaries the instructions use
+    std::size_t n_temps = 0;
+
+    /// The slot the last instruction writes to
+    std::size_t slot = 0;
+};
+
+/// How to evaluate a Graph
+struct GraphPlan {
+    /// The kernels, in a valid evaluation order
+    std::vector<Kernel> kernels;
+
+    /// Indices of kernels which may run concurrently, in evaluation order
+    std::vector<std::vector<std::size_t>> levels;
+
+    /// Number of n-element buffers needed
+    std::size_t n_slots = 0;
+
+    /// Largest number of temporaries any kernel needs
+    std::size_t max_temps = 0;
+
+    /// The slot each requested node ends up in
+    std::vector<std::size_t> output_slots;
+};
+
+/** @brief Plans how to evaluate @p outputs.
+ *
+ *  Nodes not needed for @p outputs are skipped. Each requested node gets its
+ *  own slot, which is never reused, so it can be handed back to the caller.
+ *
+ *  @param[in] nodes The recorded nodes, in topological order.
+ *  @param[in] outputs Indices of the nodes to evaluate.
+ *
+ *  @return The plan.
+ *
+ *  @throw std::out_of_range if an index in @p outputs is not less than
+ *                           @p nodes.size(). Strong throw guarantee.
+ *  @throw std::bad_alloc if allocating the plan fails. Strong throw
+ *                        guarantee.
+ */
+GraphPlan make_plan(std::span<const GraphNode> nodes,
+                    std::span<const std::size_t> outputs);
+
+/// Number of elements a kernel processes at once
+inline constexpr std::size_t block_size = 256;
+
+/// Sets @p out[i] = Op(@p a[i]), where a scalar argument is not indexed
+template<typename T, typename Op>
+void unary_loop(Op op, T* out, const T* a, bool sa, std::size_t m) {
+    if(sa) {
+        std::fill_n(out, m, static_cast<T>(op(*a)));
+    } else {
+        for(std::size_t i = 0; i < m; ++i) out[i] = static_cast<T>(op(a[i]));
+    }
+}
+
+/// Sets @p out[i] = Op(@p a[i], @p b[i]), not indexing scalar arguments
+template<typename T, typename Op>
+void binary_loop(Op op, T* out, const T* a, bool sa, const T* b, bool sb,
+                 std::size_t m) {
+    if(sa && sb) {
+        std::fill_n(out, m, static_cast<T>(op(*a, *b)));
+    } else if(sa) {
+        const T x = *a;
+        for(std::size_t i = 0; i < m; ++i)
+            out[i] = static_cast<T>(op(x, b[i]));
+    } else if(sb) {
+        const T y = *b;
+        for(std::size_t i = 0; i < m; ++i)
+            out[i] = static_cast<T>(op(a[i], y));
+    } else {
+        for(std::size_t i = 0; i < m; ++i)
+            out[i] = static_cast<T>(op(a[i], b[i]));
+    }
+}
+
+/** @brief Runs elements [@p begin, @p end) of @p kernel.
+ *
+ *  The range is processed in blocks of block_size elements. Each instruction
+ *  loops over a whole block, so the loops vectorize, and intermediate results
+ *  stay in @p temps, which fits in cache.
+ *
+ *  @param[in] kernel The kernel to run.
+ *  @param[in] inputs The first element of each input buffer.
+ *  @param[in] scalars The value of each scalar.
+ *  @param[in] slots The first element of each slot.
+ *  @param[in] temps Scratch space for kernel.n_temps blocks.
+ *  @param[in] begin The first element to compute.
+ *  @param[in] end One past the last element to compute.
+ *
+ *  @throw None No throw guarantee.
+ */
+template<typename T>
+void run_kernel(const Kernel& kernel, std::span<const T* const> inputs,
+                std::span<const T> scalars, std::span<T* const> slots,
+                T* temps, std::size_t begin, std::size_t end) noexcept {
+    const auto* last = &kernel.instructions.back();
+    for(std::size_t b = begin; b < end; b += block_size) {
+        const auto m = std::min(block_size, end - b);
+
+        // Returns where arg starts for this block, and if it is a scalar
+        auto resolve = [&](const Argument& arg, bool& is_scalar) -> const T* {
+            is_scalar = arg.kind == Argument::Kind::scalar;
+            switch(arg.kind) {
+                case Argument::Kind::input: return inputs[arg.index] + b;
+                case Argument::Kind::scalar: return &scalars[arg.index];
+                case Argument::Kind::slot: return slots[arg.index] + b;
+                default: return temps + arg.index * block_size;
+            }
+        };
+
+        for(const auto& instruction : kernel.instructions) {
+            T* out = &instruction == last ?
+                       slots[kernel.slot] + b :
+                       temps + instruction.result * block_size;
+            bool sa = false, sb = false;
+            const T* a = resolve(instruction.lhs, sa);
+            switch(instruction.op) {
+                case OpCode::negate:
+                    unary_loop(std::negate<>{}, out, a, sa, m);
+                    break;
+                case OpCode::input:
+                case OpCode::scalar:
+                    unary_loop(std::identity{}, out, a, sa, m);
+                    break;
+                default: {
+                    const T* c = resolve(instruction.rhs, sb);
+                    switch(instruction.op) {
+                        case OpCode::add:
+                            binary_loop(std::plus<>{}, out, a, sa, c, sb, m);
+                            break;
+                        case OpCode::subtract:
+                            binary_loop(std::minus<>{}, out, a, sa, c, sb, m);
+                            break;
+                        case OpCode::multiply:
+                            binary_loop(std::multiplies<>{}, out, a, sa, c, sb,
+                                        m);
+                            break;
+                        default:
+                            binary_loop(std::divides<>{}, out, a, sa, c, sb,
+                                        m);
+                    }
+                }
+            }
+        }
+    }
+}
+
+/** @brief Executes @p plan with elements of type @p T.
+ *
+ *  Levels run one after the other. The kernels of a level, split into chunks
+ *  so that up to @p n_threads threads have work, run concurrently on the
+ *  current executor (see wtf::parallel::executor()).
+ *
+ *  @param[in] plan The plan to execute.
+ *  @param[in] inputs The first element of each input buffer.
+ *  @param[in] scalars The value of each scalar.
+ *  @param[in] slots The first element of each of the plan.n_slots slots.
+ *  @param[in] size The number of elements in every buffer and slot.
+ *  @param[in] n_threads The maximum number of threads to use.
+ *
+ *  @throw std::bad_alloc if allocating scratch space fails. Strong throw
+ *                        guarantee.
+ *  @throw std::system_error if the default ThreadPool has to be created and
+ *                           can not be. Strong throw guarantee.
+ */
+template<typename T>
+void run_plan(const GraphPlan& plan, std::span<const T* const> inputs,
+              std::span<const T> scalars, std::span<T* const> slots,
+              std::size_t size, std::size_t n_threads) {
+    if(size == 0) return;
+    n_threads        = std::max<std::size_t>(n_threads, 1);
+    const auto width = plan.max_temps * block_size;
+    std::vector<T> scratch(n_threads * width);
+
+    struct Task {
+        std::size_t kernel;
+        std::size_t begin;
+        std::size_t end;
+    };
+    std::vector<Task> tasks;
+    for(const auto& level : plan.levels) {
+        // Split each kernel into enough chunks to keep every thread busy
+        const auto n_chunks = std::max<std::size_t>(n_threads / level.size(),
+                                                    1);
+        const auto chunk    = std::max((size + n_chunks - 1) / n_chunks,
+                                       block_size);
+        tasks.clear();
+        for(auto k : level)
+            for(std::size_t begin = 0; begin < size; begin += chunk)
+                tasks.push_back({k, begin, std::min(begin + chunk, size)});
+
+        std::atomic<std::size_t> next = 0;
+        auto worker                   = [&](T* temps) {
+            for(auto i = next++; i < tasks.size(); i = next++) {
+                const auto& task = tasks[i];
+                run_kernel(plan.kernels[task.kernel], inputs, scalars, slots,
+                           temps, task.begin, task.end);
+            }
+        };
+
+        // One chunk per worker; the workers share the tasks dynamically
+        const auto n_workers = std::min(n_threads, tasks.size());
+        wtf::detail_::parallel_for(
+          n_workers, n_workers, [&](std::size_t begin, std::size_t end) {
+              for(auto i = begin; i < end; ++i)
+                  worker(scratch.data() + i * width);
+          });
+    }
+}
+
+} // namespace wtf::expr::detail_
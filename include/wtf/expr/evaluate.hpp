@@ -0,0 +1,107 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <wtf/buffer/buffer_view.hpp>
+#include <wtf/buffer/float_buffer.hpp>
+#include <wtf/detail_/parallel_for.hpp>
+#include <wtf/expr/expression.hpp>
+
+namespace wtf::expr {
+namespace detail_ {
+
+/** @brief Evaluates @p bound into @p out in one pass.
+ *
+ *  The loop body is the fully inlined bound expression, so each element is
+ *  loaded, combined, and stored without any intermediate buffers. When
+ *  @p n_threads is greater than 1 the range is split into that many
+ *  contiguous pieces, each evaluated on its own thread.
+ */
+template<typename T, typename Bound>
+void run_kernel(std::span<T> out, const Bound& bound, std::size_t n_threads) {
+    auto kernel = [&bound, pout = out.data()](std::size_t begin,
+                                              std::size_t end) {
+        for(std::size_t i = begin; i < end; ++i)
+            pout[i] = static_cast<T>(bound[i]);
+    };
+
+    wtf::detail_::parallel_for(out.size(), n_threads, kernel);
+}
+
+} // namespace detail_
+
+/** @brief Evaluates @p expression, element-wise, into @p out.
+ *
+ *  @tparam TupleType The floating-point types the buffers and scalars may
+ *                    hold.
+ *  @tparam BufferType The type of @p out, either buffer::FloatBuffer or
+ *                     buffer::BufferView<fp::Float>.
+ *  @tparam E The type of the expression.
+ *
+ *  This is where the work of an expression happens. The element type of
+ *  @p out is resolved once, every node of @p expression is bound to it, and
+ *  the whole expression is evaluated in a single fused loop with no
+ *  temporary buffers. For example,
+ *
+ *  ```cpp
+ *  evaluate<wtf::default_fp_types>(y, a * lazy(x) + b * lazy(z));
+ *  ```
+ *
+ *  reads x and z and writes y once each. All buffers in @p expression must
+ *  hold the same type as @p out and have the same number of elements; scalars
+ *  are converted to that type. @p out may also appear in @p expression.
+ *
+ *  @param[in,out] out Where the result goes. Must be contiguous and already
+ *                     have the right size.
+ *  @param[in] expression The expression to evaluate.
+ *  @param[in] n_threads The number of threads to split the loop over.
+ *                       Defaults to 1.
+ *
+ *  @throw std::runtime_error if a buffer is not contiguous or does not hold
+ *                            the element type of @p out, or if a value's
+ *                            type is not in @p TupleType. Strong throw
+ *                            guarantee.
+ *  @throw std::invalid_argument if the buffers differ in size or a scalar can
+ *                               not be converted to the element type. Strong
+ *                               throw guarantee.
+ *  @throw std::system_error if a thread can not be started. Basic throw
+ *                           guarantee.
+ */
+template<typename TupleType, typename BufferType, Expression E>
+    requires(std::is_same_v<BufferType, buffer::FloatBuffer> ||
+             std::is_same_v<BufferType, buffer::BufferView<fp::Float>>)
+void evaluate(BufferType& out, const E& expression,
+              std::size_t n_threads = 1) {
+    auto visitor = [&](auto&& values) {
+        using value_type = std::remove_reference_t<decltype(values[0])>;
+        if constexpr(!std::is_const_v<value_type>) {
+            auto bound =
+              expression.template bind<value_type, TupleType>(values.size());
+            detail_::run_kernel(values, bound, n_threads);
+        }
+    };
+    if constexpr(std::is_same_v<BufferType, buffer::FloatBuffer>) {
+        buffer::visit_contiguous_buffer<TupleType>(visitor, out);
+    } else {
+        buffer::visit_contiguous_buffer_view<TupleType>(visitor, out);
+    }
+}
+
+} // namespace wtf::expr
@@ -0,0 +1,27 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <wtf/expr/detail_/bound_expression.hpp>
+#include <wtf/expr/detail_/graph_plan.hpp>
+#include <wtf/expr/evaluate.hpp>
+#include <wtf/expr/expression.hpp>
+#include <wtf/expr/graph.hpp>
+
+/** @brief Contains the lazy, fused expression templates and the deferred
+ *         operation graph for buffers.
+ */
+namespace wtf::expr {}
@@ -0,0 +1,410 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <wtf/buffer/buffer_view.hpp>
+#include <wtf/buffer/float_buffer.hpp>
+#include <wtf/expr/detail_/bound_expression.hpp>
+#include <wtf/fp/float.hpp>
+
+namespace wtf::expr {
+
+/** @brief Common base class of all expression nodes.
+ *
+ *  Expression nodes describe an element-wise computation over buffers and
+ *  scalars without doing it. They are built with lazy() and the arithmetic
+ *  operators below, and are consumed by evaluate(). Each node implements
+ *
+ *  ```cpp
+ *  template<typename T, typename TupleType>
+ *  auto bind(std::size_t size) const;
+ *  ```
+ *
+ *  which returns the node bound to the element type T (see
+ *  detail_/bound_expression.hpp), checking that every buffer has @p size
+ *  elements.
+ *
+ *  Nodes alias the buffers and Float objects they were built from, so an
+ *  expression must not outlive them. In practice expressions should be built
+ *  and evaluated in the same statement.
+ */
+struct ExpressionBase {};
+
+/// Is @p T an expression node?
+template<typename T>
+concept Expression = std::derived_from<std::remove_cvref_t<T>, ExpressionBase>;
+
+/** @brief An expression node aliasing a buffer.
+ *
+ *  @tparam BufferType The type of the aliased buffer, either FloatBuffer or
+ *                     a BufferView.
+ */
+template<typename BufferType>
+class BufferTerminal : public ExpressionBase {
+public:
+    /** @brief Creates a node aliasing @p buffer.
+     *
+     *  @param[in] buffer The buffer to alias. Must outlive *this.
+     *
+     *  @throw None No throw guarantee.
+     */
+    explicit BufferTerminal(const BufferType& buffer) noexcept :
+      m_pbuffer_(&buffer) {}
+
+    /** @brief Binds *this to the element type @p T.
+     *
+     *  @tparam T The element type of the expression.
+     *  @tparam TupleType The types the expression may hold (unused).
+     *
+     *  @param[in] size The number of elements the buffer must have.
+     *
+     *  @return A bound buffer pointing at the aliased elements.
+     *
+     *  @throw std::runtime_error if the buffer is not a contiguous buffer of
+     *                            @p T objects. Strong throw guarantee.
+     *  @throw std::invalid_argument if the buffer does not have @p size
+     *                               elements. Strong throw guarantee.
+     */
+    template<typename T, typename TupleType>
+    detail_::BoundBuffer<T> bind(std::size_t size) const {
+        auto values = m_pbuffer_->template value<T>();
+        if(values.size() != size) {
+            throw std::invalid_argument(
+              "Expression: buffers must all have the same size");
+        }
+        return {values.data()};
+    }
+
+private:
+    /// The aliased buffer
+    const BufferType* m_pbuffer_;
+};
+
+/** @brief An expression node aliasing a type-erased scalar. */
+class FloatTerminal : public ExpressionBase {
+public:
+    /** @brief Creates a node aliasing @p value.
+     *
+     *  @param[in] value The scalar to alias. Must outlive *this.
+     *
+     *  @throw None No throw guarantee.
+     */
+    explicit FloatTerminal(const fp::Float& value) noexcept :
+      m_pvalue_(&value) {}
+
+    /** @brief Binds *this to the element type @p T.
+     *
+     *  The scalar may hold any type in @p TupleType which can be converted to
+     *  @p T.
+     *
+     *  @tparam T The element type of the expression.
+     *  @tparam TupleType The types the scalar may hold.
+     *
+     *  @return A bound scalar holding the value converted to @p T.
+     *
+     *  @throw std::runtime_error if the scalar does not hold a type in
+     *                            @p TupleType. Strong throw guarantee.
+     *  @throw std::invalid_argument if the scalar can not be converted to
+     *                               @p T. Strong throw guarantee.
+     */
+    template<typename T, typename TupleType>
+    detail_::BoundScalar<T> bind(std::size_t) const {
+        auto lambda = [](const auto& value) -> T {
+            using value_type = std::remove_cvref_t<decltype(value)>;
+            if constexpr(std::is_constructible_v<T, const value_type&>) {
+                return static_cast<T>(value);
+            } else {
+                throw std::invalid_argument(
+                  "Expression: scalar can not be converted to element type");
+            }
+        };
+        return {fp::visit_float<TupleType>(lambda, *m_pvalue_)};
+    }
+
+private:
+    /// The aliased scalar
+    const fp::Float* m_pvalue_;
+};
+
+/** @brief An expression node holding a built-in arithmetic constant.
+ *
+ *  @tparam S The type of the constant (e.g., double in `2.0 * lazy(x)`).
+ */
+template<typename S>
+class ConstantTerminal : public ExpressionBase {
+public:
+    /** @brief Creates a node holding @p value.
+     *
+     *  @param[in] value The constant.
+     *
+     *  @throw None No throw guarantee.
+     */
+    explicit ConstantTerminal(S value) noexcept : m_value_(value) {}
+
+    /** @brief Binds *this to the element type @p T.
+     *
+     *  @tparam T The element type of the expression.
+     *  @tparam TupleType The types the expression may hold (unused).
+     *
+     *  @return A bound scalar holding the constant converted to @p T.
+     *
+     *  @throw None No throw guarantee.
+     */
+    template<typename T, typename TupleType>
+    detail_::BoundScalar<T> bind(std::size_t) const noexcept {
+        if constexpr(std::is_constructible_v<T, S>) {
+            return {static_cast<T>(m_value_)};
+        } else {
+            return {static_cast<T>(static_cast<double>(m_value_))};
+        }
+    }
+
+private:
+    /// The value of the constant
+    S m_value_;
+};
+
+/** @brief An expression node applying a binary operation element-wise.
+ *
+ *  @tparam Op A default-constructible binary functor (e.g., std::plus<>).
+ *  @tparam L The type of the left operand's node.
+ *  @tparam R The type of the right operand's node.
+ */
+template<typename Op, Expression L, Expression R>
+class BinaryExpression : public ExpressionBase {
+public:
+    /** @brief Creates a node applying Op to @p lhs and @p rhs.
+     *
+     *  @param[in] lhs The left operand.
+     *  @param[in] rhs The right operand.
+     *
+     *  @throw None No throw guarantee.
+     */
+    BinaryExpression(L lhs, R rhs) noexcept :
+      m_lhs_(std::move(lhs)), m_rhs_(std::move(rhs)) {}
+
+    /** @brief Binds *this, and recursively its operands, to @p T.
+     *
+     *  @tparam T The element type of the expression.
+     *  @tparam TupleType The types the expression may hold.
+     *
+     *  @param[in] size The number of elements each buffer must have.
+     *
+     *  @return The bound expression.
+     *
+     *  @throw ??? If binding either operand throws. Strong throw guarantee.
+     */
+    template<typename T, typename TupleType>
+    auto bind(std::size_t size) const {
+        auto lhs = m_lhs_.template bind<T, TupleType>(size);
+        auto rhs = m_rhs_.template bind<T, TupleType>(size);
+        return detail_::BoundBinary<Op, decltype(lhs), decltype(rhs)>{lhs,
+                                                                      rhs};
+    }
+
+private:
+    /// The left operand
+    L m_lhs_;
+
+    /// The right operand
+    R m_rhs_;
+};
+
+/** @brief An expression node applying a unary operation element-wise.
+ *
+ *  @tparam Op A default-constructible unary functor (e.g., std::negate<>).
+ *  @tparam E The type of the operand's node.
+ */
+template<typename Op, Expression E>
+class UnaryExpression : public ExpressionBase {
+public:
+    /** @brief Creates a node applying Op to @p operand.
+     *
+     *  @param[in] operand The operand.
+     *
+     *  @throw None No throw guarantee.
+     */
+    explicit UnaryExpression(E operand) noexcept :
+      m_operand_(std::move(operand)) {}
+
+    /** @brief Binds *this, and recursively its operand, to @p T.
+     *
+     *  @tparam T The element type of the expression.
+     *  @tparam TupleType The types the expression may hold.
+     *
+     *  @param[in] size The number of elements each buffer must have.
+     *
+     *  @return The bound expression.
+     *
+     *  @throw ??? If binding the operand throws. Strong throw guarantee.
+     */
+    template<typename T, typename TupleType>
+    auto bind(std::size_t size) const {
+        auto operand = m_operand_.template bind<T, TupleType>(size);
+        return detail_::BoundUnary<Op, decltype(operand)>{operand};
+    }
+
+private:
+    /// The operand
+    E m_operand_;
+};
+
+// -----------------------------------------------------------------------------
+// Building expressions
+// -----------------------------------------------------------------------------
+
+/** @brief Starts an expression from a buffer or a scalar.
+ *
+ *  The overloads taking temporaries are deleted because the terminal would
+ *  be left aliasing an object which no longer exists.
+ *
+ *  @param[in] buffer The buffer (or scalar) to alias. Must outlive the
+ *                    expression.
+ *
+ *  @return A terminal node aliasing the argument.
+ *
+ *  @throw None No throw guarantee.
+ */
+///@{
+inline auto lazy(const buffer::FloatBuffer& buffer) noexcept {
+    return BufferTerminal<buffer::FloatBuffer>(buffer);
+}
+
+template<concepts::WTFFloat FloatType>
+auto lazy(const buffer::BufferView<FloatType>& buffer) noexcept {
+    return BufferTerminal<buffer::BufferView<FloatType>>(buffer);
+}
+
+inline auto lazy(const fp::Float& value) noexcept {
+    return FloatTerminal(value);
+}
+
+void lazy(const buffer::FloatBuffer&&) = delete;
+
+template<concepts::WTFFloat FloatType>
+void lazy(const buffer::BufferView<FloatType>&&) = delete;
+
+void lazy(const fp::Float&&) = delete;
+///@}
+
+/// Is @p T something that can appear in an expression?
+template<typename T>
+concept Operand = Expression<T> || std::is_arithmetic_v<T> ||
+                  requires(const T& value) { lazy(value); };
+
+namespace detail_ {
+
+/// Wraps @p value in a node, unless it already is one
+template<Operand T>
+auto as_expression(const T& value) {
+    if constexpr(Expression<T>) {
+        return value;
+    } else if constexpr(std::is_arithmetic_v<T>) {
+        return ConstantTerminal<T>(value);
+    } else {
+        return lazy(value);
+    }
+}
+
+/// Makes a BinaryExpression for @p Op from two operands
+template<typename Op, typename L, typename R>
+auto make_binary(const L& lhs, const R& rhs) {
+    auto l = as_expression(lhs);
+    auto r = as_expression(rhs);
+    return BinaryExpression<Op, decltype(l), decltype(r)>(std::move(l),
+                                                          std::move(r));
+}
+
+/// At least one side of an operator must already be an expression
+template<typename L, typename R>
+concept ExpressionOperands =
+  Operand<L> && Operand<R> && (Expression<L> || Expression<R>);
+
+/// Can an operand of (possibly reference) type @p T safely be stored?
+template<typename T>
+concept StorableOperand = std::is_lvalue_reference_v<T> ||
+                          Expression<std::remove_cvref_t<T>> ||
+                          std::is_arithmetic_v<std::remove_cvref_t<T>>;
+
+/// ExpressionOperands, also rejecting temporaries which would be aliased
+template<typename L, typename R>
+concept ForwardedOperands =
+  ExpressionOperands<std::remove_cvref_t<L>, std::remove_cvref_t<R>> &&
+  StorableOperand<L> && StorableOperand<R>;
+
+} // namespace detail_
+
+/** @brief Element-wise arithmetic on expressions.
+ *
+ *  At least one of the operands must be an expression node (start one with
+ *  lazy()); the other may also be a FloatBuffer, BufferView, Float, or
+ *  built-in arithmetic value. No work is done until the expression is
+ *  evaluated. Temporary buffers, views, and Floats are rejected since the
+ *  resulting node would alias them.
+ *
+ *  @param[in] lhs The left operand.
+ *  @param[in] rhs The right operand.
+ *
+ *  @return A node describing the operation.
+ *
+ *  @throw None No throw guarantee.
+ */
+///@{
+template<typename L, typename R>
+    requires detail_::ForwardedOperands<L, R>
+auto operator+(L&& lhs, R&& rhs) {
+    return detail_::make_binary<std::plus<>>(lhs, rhs);
+}
+
+template<typename L, typename R>
+    requires detail_::ForwardedOperands<L, R>
+auto operator-(L&& lhs, R&& rhs) {
+    return detail_::make_binary<std::minus<>>(lhs, rhs);
+}
+
+template<typename L, typename R>
+    requires detail_::ForwardedOperands<L, R>
+auto operator*(L&& lhs, R&& rhs) {
+    return detail_::make_binary<std::multiplies<>>(lhs, rhs);
+}
+
+template<typename L, typename R>
+    requires detail_::ForwardedOperands<L, R>
+auto operator/(L&& lhs, R&& rhs) {
+    return detail_::make_binary<std::divides<>>(lhs, rhs);
+}
+///@}
+
+/** @brief Element-wise negation of an expression.
+ *
+ *  @param[in] operand The expression to negate.
+ *
+ *  @return A node describing the negation.
+ *
+ *  @throw None No throw guarantee.
+ */
+template<Expression E>
+auto operator-(const E& operand) {
+    return UnaryExpression<std::negate<>, E>(operand);
+}
+
+} // namespace wtf::expr
@@ -0,0 +1,403 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+#include <concepts>
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <wtf/buffer/float_buffer.hpp>
+#include <wtf/expr/detail_/graph_plan.hpp>
+#include <wtf/fp/float.hpp>
+
+namespace wtf::expr {
+
+class Graph;
+
+/** @brief A buffer whose elements have not been computed yet.
+ *
+ *  A LazyBuffer is a handle to one node of a Graph. Arithmetic on LazyBuffer
+ *  objects records new nodes in the same Graph instead of computing anything.
+ *  The elements are computed when the Graph is evaluated.
+ */
+class LazyBuffer {
+public:
+    /// Type used to identify a node of the graph
+    using node_type = std::size_t;
+
+    /** @brief Creates a handle to node @p node of @p graph.
+     *
+     *  Users normally get LazyBuffer objects from Graph::input,
+     *  Graph::scalar, or arithmetic on other LazyBuffer objects.
+     *
+     *  @param[in] graph The graph holding the node. Must outlive *this.
+     *  @param[in] node The node's index in @p graph.
+     *
+     *  @throw None No throw guarantee.
+     */
+    LazyBuffer(Graph& graph, node_type node) noexcept :
+      m_pgraph_(&graph), m_node_(node) {}
+
+    /** @brief Computes the elements of *this.
+     *
+     *  Convenience function for calling Graph::evaluate with only *this.
+     *
+     *  @tparam TupleType The types the graph's inputs may hold.
+     *
+     *  @param[in] n_threads The maximum number of threads to use.
+     *
+     *  @return A buffer holding the elements.
+     *
+     *  @throw ??? If Graph::evaluate throws. Strong throw guarantee.
+     */
+    template<typename TupleType>
+    buffer::FloatBuffer evaluate(std::size_t n_threads = 1) const;
+
+    /// The graph holding the node. No throw guarantee.
+    Graph& graph() const noexcept { return *m_pgraph_; }
+
+    /// The index of the node. No throw guarantee.
+    node_type node() const noexcept { return m_node_; }
+
+private:
+    /// The graph holding the node
+    Graph* m_pgraph_;
+
+    /// The index of the node in *m_pgraph_
+    node_type m_node_;
+};
+
+/** @brief Records element-wise operations on buffers for deferred execution.
+ *
+ *  Type-erased buffers hide their element type from the compiler, so
+ *  expression templates can not fuse operations which are spread across
+ *  functions taking FloatBuffer objects. A Graph records those operations as
+ *  a directed acyclic graph instead, and evaluate() executes them together.
+ *  When a result is requested, evaluate():
+ *
+ *  - resolves the element type once, from the first input buffer;
+ *  - fuses each chain of element-wise operations into one kernel, so only
+ *    requested nodes and nodes used more than once are written to memory;
+ *  - reuses the memory of intermediate results once they are no longer
+ *    needed;
+ *  - runs independent kernels concurrently.
+ *
+ *  All input buffers must hold the same type and have the same size. Scalars
+ *  are converted to that type. Graph objects can not be copied or moved,
+ *  because LazyBuffer objects point to them.
+ */
+class Graph {
+public:
+    /// Type used for sizes and indices
+    using size_type = std::size_t;
+
+    /// Type used to identify a node
+    using node_type = LazyBuffer::node_type;
+
+    /// Creates an empty graph. No throw guarantee.
+    Graph() noexcept = default;
+
+    /// Deleted, LazyBuffer objects point to *this
+    ///@{
+    Graph(const Graph&)            = delete;
+    Graph& operator=(const Graph&) = delete;
+    ///@}
+
+    /** @brief Adds a node reading @p buffer.
+     *
+     *  The graph aliases @p buffer, so the overload taking a temporary is
+     *  deleted.
+     *
+     *  @param[in] buffer The buffer to read. It is not copied, must outlive
+     *                    *this, and must not change before evaluation.
+     *
+     *  @return A handle to the new node.
+     *
+     *  @throw std::bad_alloc if adding the node fails. Strong throw guarantee.
+     */
+    LazyBuffer input(const buffer::FloatBuffer& buffer) {
+        m_inputs_.push_back(&buffer);
+        try {
+            return add_node_({detail_::OpCode::input, m_inputs_.size() - 1});
+        } catch(...) {
+            m_inputs_.pop_back();
+            throw;
+        }
+    }
+
+    /// Deleted, *this would alias a temporary
+    LazyBuffer input(const buffer::FloatBuffer&&) = delete;
+
+    /** @brief Adds a node broadcasting @p value to every element.
+     *
+     *  @param[in] value The value of every element.
+     *
+     *  @return A handle to the new node.
+     *
+     *  @throw std::bad_alloc if adding the node fails. Strong throw guarantee.
+     */
+    LazyBuffer scalar(fp::Float value) {
+        m_scalars_.push_back(std::move(value));
+        try {
+            return add_node_({detail_::OpCode::scalar, m_scalars_.size() - 1});
+        } catch(...) {
+            m_scalars_.pop_back();
+            throw;
+        }
+    }
+
+    /** @brief Adds a node applying @p op to nodes @p lhs and @p rhs.
+     *
+     *  This is how the arithmetic operators of LazyBuffer record nodes.
+     *
+     *  @param[in] op The operation. Must not be input or scalar.
+     *  @param[in] lhs The first operand.
+     *  @param[in] rhs The second operand. Ignored by unary operations.
+     *
+     *  @return A handle to the new node.
+     *
+     *  @throw std::invalid_argument if @p op is input or scalar, or if an
+     *                               operand belongs to another graph. Strong
+     *                               throw guarantee.
+     *  @throw std::bad_alloc if adding the node fails. Strong throw guarantee.
+     */
+    LazyBuffer apply(detail_::OpCode op, const LazyBuffer& lhs,
+                     const LazyBuffer& rhs) {
+        if(op == detail_::OpCode::input || op == detail_::OpCode::scalar) {
+            throw std::invalid_argument("Graph: op must be an operation");
+        }
+        check_owner_(lhs);
+        check_owner_(rhs);
+        return add_node_({op, lhs.node(), rhs.node()});
+    }
+
+    /// Number of nodes recorded so far. No throw guarantee.
+    size_type size() const noexcept { return m_nodes_.size(); }
+
+    /** @brief Computes the elements of @p outputs.
+     *
+     *  @tparam TupleType The types the input buffers may hold.
+     *
+     *  @param[in] outputs The nodes to compute.
+     *  @param[in] n_threads The maximum number of threads to use.
+     *
+     *  @return One buffer per node in @p outputs, in the same order.
+     *
+     *  @throw std::invalid_argument if a node in @p outputs belongs to another
+     *                               graph, the graph has no inputs, the
+     *                               inputs differ in size, or a scalar can
+     *                               not be converted. Strong throw guarantee.
+     *  @throw std::runtime_error if the inputs are not contiguous buffers of
+     *                            the same type in @p TupleType. Strong throw
+     *                            guarantee.
+     *  @throw std::bad_alloc if allocating the results fails. Strong throw
+     *                        guarantee.
+     *  @throw std::system_error if the default ThreadPool has to be created
+     *                           and can not be. Strong throw guarantee.
+     */
+    template<typename TupleType>
+    std::vector<buffer::FloatBuffer> evaluate(
+      const std::vector<LazyBuffer>& outputs, size_type n_threads = 1) const {
+        std::vector<size_type> nodes;
+        for(const auto& output : outputs) {
+            check_owner_(output);
+            nodes.push_back(output.node());
+        }
+        if(m_inputs_.empty()) {
+            throw std::invalid_argument("Graph: there are no input buffers");
+        }
+
+        const auto plan = detail_::make_plan(m_nodes_, nodes);
+        auto lambda     = [&](auto&& values) {
+            using value_type = std::remove_cvref_t<decltype(values[0])>;
+            return evaluate_<value_type, TupleType>(plan, values.size(),
+                                                    n_threads);
+        };
+        return buffer::visit_contiguous_buffer<TupleType>(lambda,
+                                                          *m_inputs_.front());
+    }
+
+private:
+    /// Records @p node and returns a handle to it
+    LazyBuffer add_node_(detail_::GraphNode node) {
+        m_nodes_.push_back(node);
+        return LazyBuffer(*this, m_nodes_.size() - 1);
+    }
+
+    /// Throws std::invalid_argument if @p buffer's node is not in *this
+    void check_owner_(const LazyBuffer& buffer) const {
+        if(&buffer.graph() != this) {
+            throw std::invalid_argument("Graph: node belongs to another graph");
+        }
+    }
+
+    /// Executes @p plan with elements of type @p T
+    template<typename T, typename TupleType>
+    std::vector<buffer::FloatBuffer> evaluate_(const detail_::GraphPlan& plan,
+                                               size_type size,
+                                               size_type n_threads) const {
+        std::vector<const T*> inputs;
+        for(const auto* pinput : m_inputs_) {
+            auto values = pinput->template value<T>();
+            if(values.size() != size) {
+                throw std::invalid_argument(
+                  "Graph: input buffers must all have the same size");
+            }
+            inputs.push_back(values.data());
+        }
+
+        auto convert = [](const auto& value) -> T {
+            using value_type = std::remove_cvref_t<decltype(value)>;
+            if constexpr(std::is_constructible_v<T, const value_type&>) {
+                return static_cast<T>(value);
+            } else {
+                throw std::invalid_argument(
+                  "Graph: scalar can not be converted to element type");
+            }
+        };
+        std::vector<T> scalars;
+        for(const auto& scalar : m_scalars_)
+            scalars.push_back(fp::visit_float<TupleType>(convert, scalar));
+
+        std::vector<std::vector<T>> slots(plan.n_slots, std::vector<T>(size));
+        std::vector<T*> pslots;
+        for(auto& slot : slots) pslots.push_back(slot.data());
+        detail_::run_plan<T>(plan, inputs, scalars, pslots, size, n_threads);
+
+        // A node requested twice shares a slot, so later requests copy
+        std::vector<std::optional<size_type>> returned(plan.n_slots);
+        std::vector<buffer::FloatBuffer> rv;
+        for(auto slot : plan.output_slots) {
+            if(returned[slot]) {
+                rv.push_back(rv[*returned[slot]]);
+            } else {
+                returned[slot] = rv.size();
+                rv.emplace_back(std::move(slots[slot]));
+            }
+        }
+        return rv;
+    }
+
+    /// The recorded nodes, in topological order
+    std::vector<detail_::GraphNode> m_nodes_;
+
+    /// The buffers read by input nodes
+    std::vector<const buffer::FloatBuffer*> m_inputs_;
+
+    /// The values of scalar nodes
+    std::vector<fp::Float> m_scalars_;
+};
+
+template<typename TupleType>
+buffer::FloatBuffer LazyBuffer::evaluate(std::size_t n_threads) const {
+    return std::move(
+      m_pgraph_->template evaluate<TupleType>({*this}, n_threads).front());
+}
+
+// -----------------------------------------------------------------------------
+// Recording operations
+// -----------------------------------------------------------------------------
+
+namespace detail_ {
+
+/// Can @p T be combined with a LazyBuffer?
+template<typename T>
+concept GraphOperand = std::same_as<T, LazyBuffer> ||
+                       std::same_as<T, fp::Float> || std::is_arithmetic_v<T>;
+
+/// Returns @p value as a node of @p graph
+template<GraphOperand T>
+LazyBuffer as_node(Graph& graph, const T& value) {
+    if constexpr(std::same_as<T, LazyBuffer>) {
+        return value;
+    } else if constexpr(std::same_as<T, fp::Float>) {
+        return graph.scalar(value);
+    } else {
+        return graph.scalar(fp::Float(static_cast<double>(value)));
+    }
+}
+
+/// Records @p op applied to @p lhs and @p rhs, at least one a LazyBuffer
+template<OpCode op, typename L, typename R>
+LazyBuffer record_binary(const L& lhs, const R& rhs) {
+    Graph* pgraph;
+    if constexpr(std::same_as<L, LazyBuffer>) {
+        pgraph = &lhs.graph();
+    } else {
+        pgraph = &rhs.graph();
+    }
+    auto l = as_node(*pgraph, lhs);
+    auto r = as_node(*pgraph, rhs);
+    return pgraph->apply(op, l, r);
+}
+
+/// At least one side of an operator must be a LazyBuffer
+template<typename L, typename R>
+concept LazyOperands =
+  GraphOperand<L> && GraphOperand<R> &&
+  (std::same_as<L, LazyBuffer> || std::same_as<R, LazyBuffer>);
+
+} // namespace detail_
+
+/** @brief Records element-wise arithmetic on LazyBuffer objects.
+ *
+ *  Either operand may also be a Float or a built-in arithmetic value, which
+ *  is recorded as a scalar node.
+ *
+ *  @throw std::invalid_argument if the operands belong to different graphs.
+ *                               Strong throw guarantee.
+ *  @throw std::bad_alloc if recording the node fails. Strong throw guarantee.
+ */
+///@{
+template<typename L, typename R>
+    requires detail_::LazyOperands<L, R>
+LazyBuffer operator+(const L& lhs, const R& rhs) {
+    return detail_::record_binary<detail_::OpCode::add>(lhs, rhs);
+}
+
+template<typename L, typename R>
+    requires detail_::LazyOperands<L, R>
+LazyBuffer operator-(const L& lhs, const R& rhs) {
+    return detail_::record_binary<detail_::OpCode::subtract>(lhs, rhs);
+}
+
+template<typename L, typename R>
+    requires detail_::LazyOperands<L, R>
+LazyBuffer operator*(const L& lhs, const R& rhs) {
+    return detail_::record_binary<detail_::OpCode::multiply>(lhs, rhs);
+}
+
+template<typename L, typename R>
+    requires detail_::LazyOperands<L, R>
+LazyBuffer operator/(const L& lhs, const R& rhs) {
+    return detail_::record_binary<detail_::OpCode::divide>(lhs, rhs);
+}
+///@}
+
+/** @brief Records element-wise negation of @p operand.
+ *
+ *  @throw std::bad_alloc if recording the node fails. Strong throw guarantee.
+ */
+inline LazyBuffer operator-(const LazyBuffer& operand) {
+    return operand.graph().apply(detail_::OpCode::negate, operand, operand);
+}
+
+} // namespace wtf::expr
@@ -0,0 +1,171 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <compare>
+#include <cstddef>
+#include <ostream>
+#include <type_traits>
+#include <wtf/fp/detail_/narrow_bits.hpp>
+#include <wtf/type_traits/is_floating_point.hpp>
+#include <wtf/type_traits/precision.hpp>
+#include <wtf/type_traits/type_name.hpp>
+
+namespace wtf::fp {
+
+/** @brief A software bfloat16 ("brain floating point") floating-point type.
+ *
+ *  BFloat16 is a storage type. It holds the 16-bit pattern of a value and does
+ *  no arithmetic of its own. A BFloat16 implicitly widens to float (and from
+ *  there to double and long double); widening is exact, so arithmetic on
+ *  BFloat16 objects is done in float. Narrowing to BFloat16 rounds to nearest,
+ *  ties to even, and must be asked for explicitly. Whole buffers should be
+ *  converted with the functions in wtf/fp/convert.hpp, which vectorize.
+ */
+class BFloat16 {
+public:
+    /// Type of the bit pattern
+    using bits_type = detail_::bits16_type;
+
+    /** @brief Creates a BFloat16 holding +0.
+     *
+     *  @throw None No throw guarantee.
+     */
+    constexpr BFloat16() noexcept = default;
+
+    /** @brief Creates a BFloat16 holding @p value rounded to 8 bits.
+     *
+     *  @param[in] value The value to round.
+     *
+     *  @throw None No throw guarantee.
+     */
+    explicit BFloat16(float value) noexcept :
+      m_bits_(detail_::float_to_bfloat16_bits(value)) {}
+
+    /** @brief Creates a BFloat16 holding @p value rounded to 8 bits.
+     *
+     *  @p value is rounded once, i.e., the result is the same as if the
+     *  rounding were done directly from double.
+     *
+     *  @param[in] value The value to round.
+     *
+     *  @throw None No throw guarantee.
+     */
+    explicit BFloat16(double value) noexcept :
+      BFloat16(detail_::round_to_odd(value)) {}
+
+    /** @brief Creates a BFloat16 from its bit pattern.
+     *
+     *  @param[in] bits The bit pattern of the value.
+     *
+     *  @return A BFloat16 whose bit pattern is @p bits.
+     *
+     *  @throw None No throw guarantee.
+     */
+    static constexpr BFloat16 from_bits(bits_type bits) noexcept {
+        BFloat16 rv;
+        rv.m_bits_ = bits;
+        return rv;
+    }
+
+    /** @brief The bit pattern of *this.
+     *
+     *  @return The 16 bits making up *this.
+     *
+     *  @throw None No throw guarantee.
+     */
+    constexpr bits_type bits() const noexcept { return m_bits_; }
+
+    /** @brief Widens *this to float.
+     *
+     *  @return The value of *this as a float. The conversion is exact.
+     *
+     *  @throw None No throw guarantee.
+     */
+    operator float() const noexcept {
+        return detail_::bfloat16_bits_to_float(m_bits_);
+    }
+
+    /** @brief Compares @p lhs and @p rhs as floats.
+     *
+     *  These are defined so that comparing two BFloat16 objects does not go
+     *  through the Float comparison operators (a BFloat16 implicitly converts
+     *  to both float and Float). Like float, +0 equals -0 and NaN equals
+     *  nothing.
+     *
+     *  @param[in] lhs The left operand.
+     *  @param[in] rhs The right operand.
+     *
+     *  @return The result of comparing the widened values.
+     *
+     *  @throw None No throw guarantee.
+     */
+    ///@{
+    friend bool operator==(BFloat16 lhs, BFloat16 rhs) noexcept {
+        return static_cast<float>(lhs) == static_cast<float>(rhs);
+    }
+    friend std::partial_ordering operator<=>(BFloat16 lhs,
+                                             BFloat16 rhs) noexcept {
+        return static_cast<float>(lhs) <=> static_cast<float>(rhs);
+    }
+    ///@}
+
+private:
+    /// The bit pattern of the value
+    bits_type m_bits_ = 0;
+};
+
+/** @brief Prints @p value by printing it as a float.
+ *
+ *  @relates BFloat16
+ *
+ *  @param[in] os The stream to print to.
+ *  @param[in] value The value to print.
+ *
+ *  @return @p os after printing @p value.
+ */
+inline std::ostream& operator<<(std::ostream& os, BFloat16 value) {
+    return os << static_cast<float>(value);
+}
+
+static_assert(sizeof(BFloat16) == 2);
+static_assert(std::is_trivially_copyable_v<BFloat16>);
+
+} // namespace wtf::fp
+
+namespace wtf::type_traits {
+
+/// Registers BFloat16 as a floating-point type
+template<>
+struct IsFloatingPoint<fp::BFloat16> : std::true_type {};
+
+/// Specializes TypeName for BFloat16
+template<>
+struct TypeName<fp::BFloat16> {
+    static constexpr auto value = "bfloat16";
+};
+
+/// Specializes Precision for BFloat16, which has 8 significant bits
+template<>
+struct Precision<fp::BFloat16> {
+    /// Type used for measuring the precision
+    using size_type = std::size_t;
+
+    /// Number of significant digits in base 10 that can be represented
+    constexpr static size_type value = 2;
+};
+
+} // namespace wtf::type_traits
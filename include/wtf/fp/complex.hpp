@@ -0,0 +1,64 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <complex>
+#include <cstddef>
+#include <type_traits>
+#include <wtf/type_traits/is_complex.hpp>
+#include <wtf/type_traits/is_floating_point.hpp>
+#include <wtf/type_traits/precision.hpp>
+#include <wtf/type_traits/serializer.hpp>
+#include <wtf/type_traits/type_name.hpp>
+
+/** @file complex.hpp
+ *
+ *  Registers std::complex<float>, std::complex<double>, and
+ *  std::complex<long double> with WTF. A std::complex<T> stores its real and
+ *  imaginary parts as two adjacent T objects, so buffers of them (e.g., a
+ *  ContiguousModel) are interleaved (re, im, re, im, ...). The precision of a
+ *  complex type is the precision of its parts, and it is serialized bitwise
+ *  with the byte order of each part swapped independently.
+ *
+ *  Only the real-to-complex and narrow-to-wide conversions are implicit, as
+ *  per std::complex, so IsConvertible needs no specializations.
+ */
+
+/// Registers std::complex<T> for the real type @p T
+#define WTF_REGISTER_COMPLEX_TYPE(T)                             \
+    namespace wtf::type_traits {                                 \
+    template<>                                                   \
+    struct IsFloatingPoint<std::complex<T>> : std::true_type {}; \
+    template<>                                                   \
+    struct TypeName<std::complex<T>> {                           \
+        static constexpr auto value = "std::complex<" #T ">";    \
+    };                                                           \
+    template<>                                                   \
+    struct Precision<std::complex<T>> {                          \
+        using size_type                  = std::size_t;          \
+        constexpr static size_type value = precision_v<T>;       \
+    };                                                           \
+    template<>                                                   \
+    struct WordSize<std::complex<T>> {                           \
+        static constexpr std::size_t value = sizeof(T);          \
+    };                                                           \
+    } // namespace wtf::type_traits
+
+WTF_REGISTER_COMPLEX_TYPE(float)
+WTF_REGISTER_COMPLEX_TYPE(double)
+WTF_REGISTER_COMPLEX_TYPE(long double)
+
+#undef WTF_REGISTER_COMPLEX_TYPE
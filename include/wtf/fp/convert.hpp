@@ -0,0 +1,141 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <cstdint>
+#include <future>
+#include <span>
+#include <wtf/fp/bfloat16.hpp>
+#include <wtf/fp/half.hpp>
+#include <wtf/parallel/async.hpp>
+
+namespace wtf::fp {
+
+/** @brief Widens or narrows a whole buffer of floating-point values.
+ *
+ *  These overloads convert between the 16-bit storage types (Half and
+ *  BFloat16) and float/double. The intended use is to keep large, read-mostly
+ *  arrays at 2 bytes per element and to widen them, a chunk at a time, inside
+ *  of compute kernels. The loops are table-free and branch-free, so they are
+ *  auto-vectorized. Narrowing rounds to nearest, ties to even (narrowing from
+ *  double rounds once, not twice).
+ *
+ *  @param[in] in The values to convert.
+ *  @param[out] out Where the converted values go. Must be the same size as
+ *                  @p in and must not overlap with @p in.
+ *
+ *  @throw std::invalid_argument if @p in and @p out are different sizes.
+ *                              Strong throw guarantee.
+ */
+///@{
+void convert(std::span<const Half> in, std::span<float> out);
+void convert(std::span<const Half> in, std::span<double> out);
+void convert(std::span<const float> in, std::span<Half> out);
+void convert(std::span<const double> in, std::span<Half> out);
+void convert(std::span<const BFloat16> in, std::span<float> out);
+void convert(std::span<const BFloat16> in, std::span<double> out);
+void convert(std::span<const float> in, std::span<BFloat16> out);
+void convert(std::span<const double> in, std::span<BFloat16> out);
+///@}
+
+/// How the narrowing overloads of convert round
+struct ConvertOptions {
+    /** @brief Round stochastically instead of to nearest.
+     *
+     *  Each value rounds to one of its two neighbours in the output type,
+     *  with probabilities such that the expected value of the result is the
+     *  input. Accumulating many stochastically rounded values does not build
+     *  up the systematic error round-to-nearest can.
+     */
+    bool stochastic = false;
+
+    /** @brief Clamp values beyond the output's range to its largest finite
+     *         value instead of converting them to infinity.
+     *
+     *  Infinities are clamped too. NaNs stay NaNs.
+     */
+    bool saturate = false;
+
+    /// Selects the random stream used for stochastic rounding
+    std::uint64_t seed = 0;
+
+    /** @brief Position in the random stream of the first input value.
+     *
+     *  Element i uses random number offset + i, so converting a buffer in
+     *  pieces, with offset set to the index of each piece, gives the same
+     *  result as converting it whole.
+     */
+    std::uint64_t offset = 0;
+};
+
+/** @brief Narrows a whole buffer of floating-point values as set by
+ *         @p options.
+ *
+ *  The random numbers for stochastic rounding come from a counter-based
+ *  generator (Philox2x32-10) indexed by element, so for a given seed the
+ *  result does not depend on how many threads do the conversion. With
+ *  default @p options these are the same as the overloads without options.
+ *
+ *  @param[in] in The values to convert.
+ *  @param[out] out Where the converted values go. Must be the same size as
+ *                  @p in and must not overlap with @p in.
+ *  @param[in] options How to round and what to do with out-of-range values.
+ *
+ *  @throw std::invalid_argument if @p in and @p out are different sizes.
+ *                              Strong throw guarantee.
+ */
+///@{
+void convert(std::span<const double> in, std::span<float> out,
+             const ConvertOptions& options);
+void convert(std::span<const float> in, std::span<Half> out,
+             const ConvertOptions& options);
+void convert(std::span<const double> in, std::span<Half> out,
+             const ConvertOptions& options);
+void convert(std::span<const float> in, std::span<BFloat16> out,
+             const ConvertOptions& options);
+void convert(std::span<const double> in, std::span<BFloat16> out,
+             const ConvertOptions& options);
+///@}
+
+/** @brief Starts convert(@p in, @p out) without waiting for it.
+ *
+ *  @tparam InType The type being converted from.
+ *  @tparam OutType The type being converted to.
+ *
+ *  The conversion runs as a task of the current executor (see
+ *  wtf::parallel::executor()), so conversions of different buffers overlap
+ *  with each other and with the caller.
+ *
+ *  @param[in] in The values to convert. Must stay alive until the returned
+ *                future is ready.
+ *  @param[out] out Where the converted values go. Must stay alive until the
+ *                  returned future is ready.
+ *
+ *  @return A future which is ready once the conversion is done. It holds the
+ *          exception if convert() throws.
+ *
+ *  @throw std::system_error if the default thread pool has to be created
+ *                           and can not be. Strong throw guarantee.
+ *  @throw std::bad_alloc if the task can not be queued. Strong throw
+ *                        guarantee.
+ */
+template<typename InType, typename OutType>
+std::future<void> convert_async(std::span<const InType> in,
+                                std::span<OutType> out) {
+    return parallel::async([in, out]() { convert(in, out); });
+}
+
+} // namespace wtf::fp
@@ -0,0 +1,181 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <bit>
+#include <cmath>
+#include <cstdint>
+
+/** @file narrow_bits.hpp
+ *
+ *  Bit-level conversions between float and the 16-bit binary16 ("half") and
+ *  bfloat16 formats. None of the conversions use lookup tables and all of the
+ *  data-dependent decisions are written as selects, so loops over them can be
+ *  auto-vectorized. All conversions into a 16-bit format round to nearest,
+ *  ties to even.
+ */
+
+namespace wtf::fp::detail_ {
+
+/// Type of the bit pattern of a 16-bit floating-point value
+using bits16_type = std::uint16_t;
+
+/** @brief Returns @p a if @p condition is true and @p b otherwise.
+ *
+ *  The ternary operator is not used because, unless FP exceptions are
+ *  ignored, compilers will not speculate the FP math feeding the unused
+ *  branch and so will not vectorize loops containing it.
+ */
+inline std::uint32_t select(bool condition, std::uint32_t a,
+                            std::uint32_t b) noexcept {
+    const auto mask = 0u - static_cast<std::uint32_t>(condition);
+    return b ^ ((a ^ b) & mask);
+}
+
+/** @brief Rounds @p value to float using round-to-odd.
+ *
+ *  Rounding a double to a 16-bit format by way of float can round twice and
+ *  give the wrong answer when the double lies just off of a tie. Rounding to
+ *  float with round-to-odd (truncate, then set the last bit if the result is
+ *  inexact) keeps enough information for the second rounding to be correct,
+ *  because float has more than two bits more precision than either 16-bit
+ *  format.
+ *
+ *  @param[in] value The value to round.
+ *
+ *  @return @p value rounded to float with round-to-odd.
+ *
+ *  @throw None No throw guarantee.
+ */
+inline float round_to_odd(double value) noexcept {
+    constexpr std::int64_t abs_mask = 0x7FFFFFFFFFFFFFFFll;
+
+    const auto rounded = static_cast<float>(value);
+    const auto back    = static_cast<double>(rounded);
+    const auto exact   = std::bit_cast<std::int64_t>(value) & abs_mask;
+    const auto inexact = std::bit_cast<std::int64_t>(back) & abs_mask;
+
+    // Integer compares of the magnitudes keep this free of FP exceptions
+    auto bits = std::bit_cast<std::uint32_t>(rounded);
+    bits -= static_cast<std::uint32_t>(inexact > exact);
+    bits |= static_cast<std::uint32_t>(inexact != exact);
+    return std::bit_cast<float>(bits);
+}
+
+/** @brief Converts @p value to the bit pattern of a binary16 value.
+ *
+ *  Values too large for binary16 become infinity, NaNs become quiet NaNs, and
+ *  values below the normal range become subnormals (or zero).
+ *
+ *  @param[in] value The value to convert.
+ *
+ *  @return The binary16 bit pattern nearest to @p value.
+ *
+ *  @throw None No throw guarantee.
+ */
+inline bits16_type float_to_half_bits(float value) noexcept {
+    constexpr std::uint32_t f32_infty  = 0x7F800000u; // float infinity
+    constexpr std::uint32_t f16_max    = 0x47800000u; // 2^16 as a float
+    constexpr std::uint32_t f16_normal = 0x38800000u; // 2^-14 as a float
+    constexpr std::uint32_t denorm     = 0x3F000000u; // 0.5 (ulp of 2^-24)
+    constexpr std::uint32_t rebias     = (15u - 127u) << 23;
+
+    const auto all  = std::bit_cast<std::uint32_t>(value);
+    const auto sign = all & 0x80000000u;
+    const auto abs  = all ^ sign;
+
+    // Overflow: infinity, or a quiet NaN
+    const auto special = select(abs > f32_infty, 0x7E00u, 0x7C00u);
+
+    // Subnormal: let the FPU round by adding a number whose ulp is 2^-24
+    const auto shifted   = std::bit_cast<float>(abs) +
+                         std::bit_cast<float>(denorm);
+    const auto subnormal = std::bit_cast<std::uint32_t>(shifted) - denorm;
+
+    // Normal: rebias the exponent and round the dropped 13 bits to even
+    const auto odd    = (abs >> 13) & 1u;
+    const auto normal = (abs + rebias + 0xFFFu + odd) >> 13;
+
+    const auto finite    = select(abs < f16_normal, subnormal, normal);
+    const auto magnitude = select(abs >= f16_max, special, finite);
+    return static_cast<bits16_type>(magnitude | (sign >> 16));
+}
+
+/** @brief Converts the binary16 bit pattern @p bits to a float.
+ *
+ *  Every binary16 value is exactly representable as a float, so this
+ *  conversion is exact.
+ *
+ *  @param[in] bits The bit pattern of a binary16 value.
+ *
+ *  @return The value of @p bits as a float.
+ *
+ *  @throw None No throw guarantee.
+ */
+inline float half_bits_to_float(bits16_type bits) noexcept {
+    constexpr std::uint32_t exp_mask = 0x7C00u << 13; // exponent after shift
+    constexpr std::uint32_t magic    = 113u << 23;    // 2^-14 as a float
+
+    const std::uint32_t h = bits;
+    const auto shifted    = (h & 0x7FFFu) << 13;
+    const auto exponent   = shifted & exp_mask;
+    const auto rebiased   = shifted + ((127u - 15u) << 23);
+
+    // Infinity/NaN: exponent goes to all ones
+    const auto special = rebiased + ((128u - 16u) << 23);
+
+    // Zero/subnormal: renormalize by letting the FPU subtract 2^-14
+    const auto renorm    = std::bit_cast<float>(rebiased + (1u << 23)) -
+                        std::bit_cast<float>(magic);
+    const auto subnormal = std::bit_cast<std::uint32_t>(renorm);
+
+    const auto finite    = select(exponent == 0u, subnormal, rebiased);
+    const auto magnitude = select(exponent == exp_mask, special, finite);
+    return std::bit_cast<float>(magnitude | ((h & 0x8000u) << 16));
+}
+
+/** @brief Converts @p value to the bit pattern of a bfloat16 value.
+ *
+ *  bfloat16 has the exponent range of float, so this only rounds away the
+ *  low 16 bits of the significand. NaNs become quiet NaNs.
+ *
+ *  @param[in] value The value to convert.
+ *
+ *  @return The bfloat16 bit pattern nearest to @p value.
+ *
+ *  @throw None No throw guarantee.
+ */
+inline bits16_type float_to_bfloat16_bits(float value) noexcept {
+    const auto all     = std::bit_cast<std::uint32_t>(value);
+    const auto is_nan  = (all & 0x7FFFFFFFu) > 0x7F800000u;
+    const auto rounded = all + 0x7FFFu + ((all >> 16) & 1u);
+    const auto bits    = select(is_nan, all | 0x00400000u, rounded);
+    return static_cast<bits16_type>(bits >> 16);
+}
+
+/** @brief Converts the bfloat16 bit pattern @p bits to a float.
+ *
+ *  @param[in] bits The bit pattern of a bfloat16 value.
+ *
+ *  @return The value of @p bits as a float. The conversion is exact.
+ *
+ *  @throw None No throw guarantee.
+ */
+inline float bfloat16_bits_to_float(bits16_type bits) noexcept {
+    return std::bit_cast<float>(static_cast<std::uint32_t>(bits) << 16);
+}
+
+} // namespace wtf::fp::detail_
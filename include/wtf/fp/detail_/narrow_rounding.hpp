@@ -0,0 +1,171 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <bit>
+#include <cstdint>
+#include <limits>
+
+/** @file narrow_rounding.hpp
+ *
+ *  Stochastic rounding and saturation of doubles to the precision and range
+ *  of a narrower binary format. Both work in double: they return a double
+ *  which the usual round-to-nearest conversion then narrows exactly. Like
+ *  narrow_bits.hpp, the data-dependent decisions are selects so loops over
+ *  these functions can be auto-vectorized.
+ */
+
+namespace wtf::fp::detail_ {
+
+/// The parameters of a binary floating-point format narrower than double
+struct NarrowFormat {
+    /// Number of explicitly stored significand bits
+    int mantissa_bits;
+
+    /// The smallest positive normal value
+    double min_normal;
+
+    /// The largest finite value
+    double max;
+};
+
+/// IEEE binary32 (float)
+inline constexpr NarrowFormat binary32_format{23, 0x1p-126, 0x1.fffffep127};
+
+/// IEEE binary16 (Half)
+inline constexpr NarrowFormat binary16_format{10, 0x1p-14, 65504.0};
+
+/// bfloat16
+inline constexpr NarrowFormat bfloat16_format{7, 0x1p-126, 0x1.fep127};
+
+/// 64-bit version of select (see narrow_bits.hpp)
+inline std::uint64_t select64(bool condition, std::uint64_t a,
+                              std::uint64_t b) noexcept {
+    const auto mask = std::uint64_t{0} - static_cast<std::uint64_t>(condition);
+    return b ^ ((a ^ b) & mask);
+}
+
+/// The high 32 bits of the bit pattern of @p x
+constexpr std::uint32_t high_word(double x) noexcept {
+    return static_cast<std::uint32_t>(std::bit_cast<std::uint64_t>(x) >> 32);
+}
+
+/** @brief Rounds @p x stochastically to the precision of @p Format.
+ *
+ *  @tparam Format The format being rounded to.
+ *
+ *  With lo <= x <= hi the neighbours of @p x in @p Format, @p x rounds to hi
+ *  with probability (x - lo) / (hi - lo) and to lo otherwise, so the
+ *  expected value of the result is @p x. The probability is resolved by the
+ *  32 bits of @p random.
+ *
+ *  Normal results are found by adding random bits below the kept part of the
+ *  significand and truncating. Subnormal results are found in units of the
+ *  smallest subnormal, q, as floor(x / q + u) with u uniform in [0, 1).
+ *  Infinities and NaNs are returned as is. Values within one ulp of
+ *  @p Format's largest finite value may round up to a power of 2 which is
+ *  out of range; narrowing then gives infinity.
+ *
+ *  @param[in] x The value to round.
+ *  @param[in] random 32 uniformly distributed random bits.
+ *
+ *  @return @p x rounded to a value representable in @p Format.
+ *
+ *  @throw None No throw guarantee.
+ */
+template<NarrowFormat Format>
+double stochastic_round(double x, std::uint32_t random) noexcept {
+    constexpr int shift          = 52 - Format.mantissa_bits;
+    constexpr std::uint64_t mask = (std::uint64_t{1} << shift) - 1;
+    constexpr std::uint64_t sign = std::uint64_t{1} << 63;
+    constexpr double round_magic = 0x1p52;
+    constexpr double infinity    = std::numeric_limits<double>::infinity();
+
+    // The smallest subnormal of Format
+    constexpr auto scale   = std::uint64_t{1} << Format.mantissa_bits;
+    constexpr auto quantum = Format.min_normal / static_cast<double>(scale);
+
+    const auto bits     = std::bit_cast<std::uint64_t>(x);
+    const auto abs_bits = bits & ~sign;
+    const auto abs_x    = std::bit_cast<double>(abs_bits);
+
+    // Normal: the random bits carry into the kept bits with the right odds
+    std::uint64_t noise;
+    if constexpr(shift <= 32) {
+        noise = random >> (32 - shift);
+    } else {
+        noise = std::uint64_t{random} << (shift - 32);
+    }
+    const auto normal = (abs_bits + noise) & ~mask;
+
+    // Subnormal: floor(x / q + u) is the round-to-nearest of
+    // x / q + u + 1/2, minus 1, which adding and subtracting 2^52 computes
+    // (the + 1/2 keeps the sum in the binade where the ulp is 1). 1 + u is
+    // built from its bits; u is offset by half a step (2^-33) so ties can not
+    // occur.
+    const auto u_bits     = (std::uint64_t{random} << 20) | (1u << 19);
+    const auto one_plus_u = std::bit_cast<double>(
+      std::bit_cast<std::uint64_t>(1.0) | u_bits);
+    const auto t = abs_x * (1.0 / quantum) + (one_plus_u - 0.5);
+    const auto k = (t + round_magic) - (round_magic + 1.0);
+    const auto subnormal = std::bit_cast<std::uint64_t>(k * quantum);
+
+    // min_normal and infinity have zero low words, so comparing high words
+    // suffices; SSE2 has no 64-bit compares
+    const auto high       = static_cast<std::uint32_t>(abs_bits >> 32);
+    const bool is_small   = high < high_word(Format.min_normal);
+    const bool is_special = high >= high_word(infinity);
+    auto rv = select64(is_small, subnormal, normal);
+    rv      = select64(is_special, abs_bits, rv);
+    return std::bit_cast<double>(rv | (bits & sign));
+}
+
+/** @brief Clamps @p x to the finite range of @p Format.
+ *
+ *  @tparam Format The format whose range is used.
+ *
+ *  Infinities also clamp, to the largest finite value of the same sign.
+ *  NaNs are returned as is.
+ *
+ *  @param[in] x The value to clamp.
+ *
+ *  @return @p x clamped to [-Format.max, Format.max].
+ *
+ *  @throw None No throw guarantee.
+ */
+template<NarrowFormat Format>
+double saturate(double x) noexcept {
+    constexpr std::uint64_t sign = std::uint64_t{1} << 63;
+    constexpr auto max_bits      = std::bit_cast<std::uint64_t>(Format.max);
+    constexpr auto max_high      = high_word(Format.max);
+    constexpr auto max_low       = static_cast<std::uint32_t>(max_bits);
+    constexpr auto infinity_high = high_word(
+      std::numeric_limits<double>::infinity());
+
+    // Word-wise compares of the magnitude, since SSE2 has no 64-bit ones;
+    // & and | instead of && and || keep them branch-free
+    const auto bits  = std::bit_cast<std::uint64_t>(x);
+    const auto high  = static_cast<std::uint32_t>(bits >> 32) & 0x7FFFFFFFu;
+    const auto low   = static_cast<std::uint32_t>(bits);
+    const bool above = (high > max_high) |
+                       ((high == max_high) & (low > max_low));
+    const bool is_nan = (high > infinity_high) |
+                        ((high == infinity_high) & (low != 0));
+    const auto clamped = max_bits | (bits & sign);
+    return std::bit_cast<double>(select64(above & !is_nan, clamped, bits));
+}
+
+} // namespace wtf::fp::detail_
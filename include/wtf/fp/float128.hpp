@@ -0,0 +1,72 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <cstddef>
+#include <type_traits>
+#include <wtf/type_traits/is_floating_point.hpp>
+#include <wtf/type_traits/precision.hpp>
+#include <wtf/type_traits/type_name.hpp>
+
+/** @file float128.hpp
+ *
+ *  Optional support for the quad-precision (IEEE binary128) type `__float128`.
+ *  When the compiler provides `__float128` this header defines
+ *  WTF_HAS_FLOAT128 and registers the type with WTF. Support can be turned
+ *  off by defining WTF_DISABLE_FLOAT128 before including any WTF header.
+ *
+ *  Arithmetic on `__float128` is done in software on most hardware, so it is
+ *  much slower than `long double`. See the float128 benchmarks for numbers.
+ */
+
+#if defined(__SIZEOF_FLOAT128__) && !defined(WTF_DISABLE_FLOAT128)
+#define WTF_HAS_FLOAT128 1
+#endif
+
+#ifdef WTF_HAS_FLOAT128
+
+namespace wtf::fp {
+
+/// The quad-precision floating-point type
+using float128 = __float128;
+
+} // namespace wtf::fp
+
+namespace wtf::type_traits {
+
+/// Registers __float128, which is only a std floating-point type in GNU mode
+template<>
+struct IsFloatingPoint<__float128> : std::true_type {};
+
+/// Specializes TypeName for __float128
+template<>
+struct TypeName<__float128> {
+    static constexpr auto value = "__float128";
+};
+
+/// Specializes Precision for __float128, which std::numeric_limits may not
+template<>
+struct Precision<__float128> {
+    /// Type used for measuring the precision
+    using size_type = std::size_t;
+
+    /// Number of significant digits in base 10 that can be represented
+    constexpr static size_type value = 33;
+};
+
+} // namespace wtf::type_traits
+
+#endif
@@ -0,0 +1,144 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <optional>
+
+namespace wtf::fp {
+
+/// The IEEE 754 rounding directions
+enum class RoundingMode { to_nearest, downward, upward, toward_zero };
+
+/** @brief The parts of a thread's floating-point environment WTF controls.
+ *
+ *  Arithmetic on subnormal (denormal) numbers is handled in microcode on
+ *  most CPUs and can be two orders of magnitude slower than on normal
+ *  numbers. Flushing them to zero trades the gradual underflow of IEEE 754
+ *  for speed:
+ *
+ *  - flush_to_zero (FTZ) makes results which would be subnormal zero.
+ *  - denormals_are_zero (DAZ) reads subnormal operands as zero.
+ *
+ *  On x86 both are bits of the SSE control register, so they do not affect
+ *  x87 (long double) arithmetic. On AArch64 a single bit controls both, so
+ *  asking for either one sets both. Elsewhere they are not supported (see
+ *  supports_flush_to_zero) and are ignored.
+ *
+ *  The rounding mode is set with std::fesetround. Note that compilers assume
+ *  round-to-nearest when optimizing unless told otherwise (e.g., GCC's
+ *  -frounding-math), so other modes are only reliably honored by code built
+ *  with such a flag.
+ */
+struct FloatEnv {
+    /// Should subnormal results become zero?
+    bool flush_to_zero = false;
+
+    /// Should subnormal operands be read as zero?
+    bool denormals_are_zero = false;
+
+    /// The rounding direction
+    RoundingMode rounding = RoundingMode::to_nearest;
+
+    /** @brief The environment of the calling thread.
+     *
+     *  @return The current settings of the calling thread.
+     *
+     *  @throw None No throw guarantee.
+     */
+    static FloatEnv current() noexcept;
+
+    /// The default environment with FTZ and DAZ turned on
+    static constexpr FloatEnv flush_denormals() noexcept {
+        return FloatEnv{true, true, RoundingMode::to_nearest};
+    }
+
+    /// Are all settings the same?
+    bool operator==(const FloatEnv&) const = default;
+};
+
+/** @brief Can flush_to_zero and denormals_are_zero be set on this platform?
+ *
+ *  @return True if FloatEnv::flush_to_zero and FloatEnv::denormals_are_zero
+ *          are honored and false if they are ignored.
+ *
+ *  @throw None No throw guarantee.
+ */
+bool supports_flush_to_zero() noexcept;
+
+/** @brief Changes the environment of the calling thread to @p env.
+ *
+ *  Only the settings in FloatEnv are changed; the exception flags and any
+ *  other state are left alone. Settings the platform does not support are
+ *  ignored.
+ *
+ *  @param[in] env The settings to use from now on.
+ *
+ *  @throw None No throw guarantee.
+ */
+void set_float_env(const FloatEnv& env) noexcept;
+
+/** @brief Sets the calling thread's FloatEnv for the lifetime of *this.
+ *
+ *  The constructor saves the current environment and sets the requested
+ *  one, the destructor restores the saved one. Guards nest, but must be
+ *  destroyed on the thread which created them. Parallel kernels take the
+ *  environment as part of their buffer::ExecutionPolicy, which guards every
+ *  thread running a piece of the kernel.
+ */
+class FloatEnvGuard {
+public:
+    /** @brief Sets the environment of the calling thread to @p env.
+     *
+     *  @param[in] env The settings to use while *this is alive.
+     *
+     *  @throw None No throw guarantee.
+     */
+    explicit FloatEnvGuard(const FloatEnv& env) noexcept :
+      m_saved_(FloatEnv::current()) {
+        set_float_env(env);
+    }
+
+    /** @brief Sets the environment of the calling thread to @p env, if any.
+     *
+     *  @param[in] env The settings to use while *this is alive. If empty,
+     *                 the guard does nothing.
+     *
+     *  @throw None No throw guarantee.
+     */
+    explicit FloatEnvGuard(const std::optional<FloatEnv>& env) noexcept {
+        if(env) {
+            m_saved_ = FloatEnv::current();
+            set_float_env(*env);
+        }
+    }
+
+    /// Guards can not be copied
+    FloatEnvGuard(const FloatEnvGuard&) = delete;
+
+    /// Guards can not be copied
+    FloatEnvGuard& operator=(const FloatEnvGuard&) = delete;
+
+    /// Restores the environment *this replaced
+    ~FloatEnvGuard() noexcept {
+        if(m_saved_) set_float_env(*m_saved_);
+    }
+
+private:
+    /// The environment to restore, if one was replaced
+    std::optional<FloatEnv> m_saved_;
+};
+
+} // namespace wtf::fp
@@ -15,8 +15,14 @@
  */
 
 #pragma once
+#include <wtf/fp/bfloat16.hpp>
+#include <wtf/fp/complex.hpp>
+#include <wtf/fp/convert.hpp>
 #include <wtf/fp/float.hpp>
+#include <wtf/fp/float128.hpp>
+#include <wtf/fp/float_env.hpp>
 #include <wtf/fp/float_view.hpp>
+#include <wtf/fp/half.hpp>
 
 /** @brief Contains classes and functions pertaining to the Float class
  *         hierarchy.
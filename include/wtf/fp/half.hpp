@@ -0,0 +1,170 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <compare>
+#include <cstddef>
+#include <ostream>
+#include <type_traits>
+#include <wtf/fp/detail_/narrow_bits.hpp>
+#include <wtf/type_traits/is_floating_point.hpp>
+#include <wtf/type_traits/precision.hpp>
+#include <wtf/type_traits/type_name.hpp>
+
+namespace wtf::fp {
+
+/** @brief A software binary16 ("half precision") floating-point type.
+ *
+ *  Half is a storage type. It holds the 16-bit pattern of a value and does no
+ *  arithmetic of its own. A Half implicitly widens to float (and from there to
+ *  double and long double); widening is exact, so arithmetic on Half objects
+ *  is done in float. Narrowing to Half rounds to nearest, ties to even, and
+ *  must be asked for explicitly. Whole buffers should be converted with the
+ *  functions in wtf/fp/convert.hpp, which vectorize.
+ */
+class Half {
+public:
+    /// Type of the bit pattern
+    using bits_type = detail_::bits16_type;
+
+    /** @brief Creates a Half holding +0.
+     *
+     *  @throw None No throw guarantee.
+     */
+    constexpr Half() noexcept = default;
+
+    /** @brief Creates a Half holding @p value rounded to 11 bits.
+     *
+     *  @param[in] value The value to round.
+     *
+     *  @throw None No throw guarantee.
+     */
+    explicit Half(float value) noexcept :
+      m_bits_(detail_::float_to_half_bits(value)) {}
+
+    /** @brief Creates a Half holding @p value rounded to 11 bits.
+     *
+     *  @p value is rounded once, i.e., the result is the same as if the
+     *  rounding were done directly from double.
+     *
+     *  @param[in] value The value to round.
+     *
+     *  @throw None No throw guarantee.
+     */
+    explicit Half(double value) noexcept :
+      Half(detail_::round_to_odd(value)) {}
+
+    /** @brief Creates a Half from its bit pattern.
+     *
+     *  @param[in] bits The bit pattern of the value.
+     *
+     *  @return A Half whose bit pattern is @p bits.
+     *
+     *  @throw None No throw guarantee.
+     */
+    static constexpr Half from_bits(bits_type bits) noexcept {
+        Half rv;
+        rv.m_bits_ = bits;
+        return rv;
+    }
+
+    /** @brief The bit pattern of *this.
+     *
+     *  @return The 16 bits making up *this.
+     *
+     *  @throw None No throw guarantee.
+     */
+    constexpr bits_type bits() const noexcept { return m_bits_; }
+
+    /** @brief Widens *this to float.
+     *
+     *  @return The value of *this as a float. The conversion is exact.
+     *
+     *  @throw None No throw guarantee.
+     */
+    operator float() const noexcept {
+        return detail_::half_bits_to_float(m_bits_);
+    }
+
+    /** @brief Compares @p lhs and @p rhs as floats.
+     *
+     *  These are defined so that comparing two Half objects does not go
+     *  through the Float comparison operators (a Half implicitly converts
+     *  to both float and Float). Like float, +0 equals -0 and NaN equals
+     *  nothing.
+     *
+     *  @param[in] lhs The left operand.
+     *  @param[in] rhs The right operand.
+     *
+     *  @return The result of comparing the widened values.
+     *
+     *  @throw None No throw guarantee.
+     */
+    ///@{
+    friend bool operator==(Half lhs, Half rhs) noexcept {
+        return static_cast<float>(lhs) == static_cast<float>(rhs);
+    }
+    friend std::partial_ordering operator<=>(Half lhs, Half rhs) noexcept {
+        return static_cast<float>(lhs) <=> static_cast<float>(rhs);
+    }
+    ///@}
+
+private:
+    /// The bit pattern of the value
+    bits_type m_bits_ = 0;
+};
+
+/** @brief Prints @p value by printing it as a float.
+ *
+ *  @relates Half
+ *
+ *  @param[in] os The stream to print to.
+ *  @param[in] value The value to print.
+ *
+ *  @return @p os after printing @p value.
+ */
+inline std::ostream& operator<<(std::ostream& os, Half value) {
+    return os << static_cast<float>(value);
+}
+
+static_assert(sizeof(Half) == 2);
+static_assert(std::is_trivially_copyable_v<Half>);
+
+} // namespace wtf::fp
+
+namespace wtf::type_traits {
+
+/// Registers Half as a floating-point type
+template<>
+struct IsFloatingPoint<fp::Half> : std::true_type {};
+
+/// Specializes TypeName for Half
+template<>
+struct TypeName<fp::Half> {
+    static constexpr auto value = "half";
+};
+
+/// Specializes Precision for Half, which has 11 significant bits
+template<>
+struct Precision<fp::Half> {
+    /// Type used for measuring the precision
+    using size_type = std::size_t;
+
+    /// Number of significant digits in base 10 that can be represented
+    constexpr static size_type value = 3;
+};
+
+} // namespace wtf::type_traits
@@ -0,0 +1,252 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <cstddef>
+#include <filesystem>
+#include <functional>
+#include <future>
+#include <memory>
+#include <type_traits>
+#include <vector>
+#include <wtf/buffer/buffer_view.hpp>
+#include <wtf/buffer/float_buffer.hpp>
+#include <wtf/fp/float.hpp>
+#include <wtf/io/detail_/byte_stream.hpp>
+#include <wtf/io/serialization.hpp>
+
+namespace wtf::io {
+namespace detail_ {
+class WriteQueue;
+}
+
+/// Options controlling how an AsyncWriter writes
+struct AsyncWriteOptions {
+    /// Maximum bytes of queued, not yet written, elements (default 256 MiB)
+    std::size_t max_in_flight_bytes = std::size_t{256} << 20;
+
+    /// Should the file be opened with O_DIRECT (bypassing the page cache)?
+    bool direct_io = false;
+
+    /// Alignment, in bytes, of the staging buffer and writes for direct_io
+    std::size_t alignment = 4096;
+
+    /// Size, in bytes, of the staging buffer used for direct_io (4 MiB)
+    std::size_t staging_size = std::size_t{4} << 20;
+
+    /// How each record is written (e.g., whether to checksum it)
+    WriteOptions record_options;
+};
+
+/** @brief Writes buffers to a file from a background thread.
+ *
+ *  Each buffer passed to write() is appended to the file as one record in the
+ *  format of write_float_buffer, so the file can be read back by calling
+ *  read_float_buffer once per buffer. write() only queues the buffer and
+ *  returns a completion handle; a background thread does the actual writing,
+ *  so the calling (compute) thread is free to continue.
+ *
+ *  Queued buffers hold memory until they are written. To keep memory from
+ *  growing when the disk can not keep up, write() blocks while accepting the
+ *  buffer would push the bytes in flight over max_in_flight_bytes (a buffer
+ *  larger than the budget is accepted once nothing else is in flight).
+ *  Buffers passed as a BufferView are copied (the caller may reuse its memory
+ *  as soon as write() returns); buffers moved in as a FloatBuffer are written
+ *  without a copy.
+ *
+ *  With direct_io the file is opened with O_DIRECT and records are staged
+ *  through an aligned buffer so that every write meets O_DIRECT's alignment
+ *  requirements. If the OS or file system does not support O_DIRECT, the file
+ *  is opened normally (see is_direct()) but still written in aligned blocks.
+ *
+ *  If a write fails, its handle and the handles of all later writes hold the
+ *  error, and close() rethrows it.
+ */
+class AsyncWriter {
+public:
+    /// Type used for sizes (in bytes)
+    using size_type = std::size_t;
+
+    /// Type of the handle used to wait on, or check, a single write
+    using handle_type = std::future<void>;
+
+    /// Type used to specify the file to write
+    using path_type = std::filesystem::path;
+
+    /// Type of a type-erased job which writes one record
+    using job_type =
+      std::function<void(detail_::ByteSink&, const WriteOptions&)>;
+
+    /** @brief Creates (or truncates) the file at @p path for writing.
+     *
+     *  @param[in] path The file to write.
+     *  @param[in] options How to write the file.
+     *
+     *  @throw std::system_error if the file can not be opened or the
+     *                           background thread can not be started. Weak
+     *                           throw guarantee, the file may have been
+     *                           created.
+     *  @throw std::invalid_argument if direct_io is requested with an invalid
+     *                               alignment or staging size. Weak throw
+     *                               guarantee, the file may have been
+     *                               created.
+     */
+    explicit AsyncWriter(const path_type& path, AsyncWriteOptions options = {});
+
+    /// Defaulted no-throw move ctor
+    AsyncWriter(AsyncWriter&& other) noexcept;
+
+    /// Defaulted no-throw move assignment
+    AsyncWriter& operator=(AsyncWriter&& other) noexcept;
+
+    /// Calls close(), discarding any error
+    ~AsyncWriter() noexcept;
+
+    /** @brief Queues a copy of @p buffer to be written.
+     *
+     *  @tparam TupleType A std::tuple of the floating-point types @p buffer
+     *                    may hold. Must be explicitly provided by the caller.
+     *
+     *  Blocks until the copy fits in the in-flight budget.
+     *
+     *  @param[in] buffer The elements to write.
+     *
+     *  @return A handle which becomes ready once the record is written.
+     *
+     *  @throw std::runtime_error if the writer is closed or @p buffer does not
+     *                            hold one of the types in @p TupleType. Strong
+     *                            throw guarantee.
+     *  @throw std::bad_alloc if copying @p buffer fails. Strong throw
+     *                        guarantee.
+     */
+    template<typename TupleType>
+    handle_type write(buffer::BufferView<const fp::Float> buffer) {
+        auto lambda = [](auto values) { return values.size_bytes(); };
+        const auto nbytes =
+          buffer.size() == 0 ? 0 :
+                               buffer::visit_contiguous_buffer_view<TupleType>(
+                                 lambda, buffer);
+        reserve_(nbytes);
+        try {
+            auto copy = [](auto values) {
+                using value_type = typename decltype(values)::value_type;
+                std::vector<value_type> temp(values.begin(), values.end());
+                return buffer::FloatBuffer(std::move(temp));
+            };
+            auto powned = std::make_shared<buffer::FloatBuffer>();
+            if(buffer.size() > 0)
+                *powned = buffer::visit_contiguous_buffer_view<TupleType>(
+                  copy, buffer);
+            return enqueue_(make_job_<TupleType>(std::move(powned)), nbytes);
+        } catch(...) {
+            release_(nbytes);
+            throw;
+        }
+    }
+
+    /** @brief Queues @p buffer to be written without copying it.
+     *
+     *  @tparam TupleType A std::tuple of the floating-point types @p buffer
+     *                    may hold. Must be explicitly provided by the caller.
+     *
+     *  Blocks until @p buffer fits in the in-flight budget. The writer owns
+     *  @p buffer until the record is written.
+     *
+     *  @param[in] buffer The elements to write.
+     *
+     *  @return A handle which becomes ready once the record is written.
+     *
+     *  @throw std::runtime_error if the writer is closed or @p buffer does not
+     *                            hold one of the types in @p TupleType. Strong
+     *                            throw guarantee, @p buffer is left as it was.
+     *  @throw std::bad_alloc if queuing @p buffer fails. Strong throw
+     *                        guarantee, @p buffer is left as it was.
+     */
+    template<typename TupleType>
+    handle_type write(buffer::FloatBuffer&& buffer) {
+        auto lambda = [](auto values) { return values.size_bytes(); };
+        const auto nbytes =
+          buffer.size() == 0 ?
+            0 :
+            buffer::visit_contiguous_buffer<TupleType>(lambda, buffer);
+        reserve_(nbytes);
+        // Everything which can throw happens before buffer is moved from, or
+        // the move is undone, so the caller keeps buffer if this throws
+        std::shared_ptr<buffer::FloatBuffer> pbuffer;
+        try {
+            pbuffer  = std::make_shared<buffer::FloatBuffer>();
+            auto job = make_job_<TupleType>(pbuffer);
+            *pbuffer = std::move(buffer);
+            try {
+                return enqueue_(std::move(job), nbytes);
+            } catch(...) {
+                buffer = std::move(*pbuffer);
+                throw;
+            }
+        } catch(...) {
+            release_(nbytes);
+            throw;
+        }
+    }
+
+    /** @brief Blocks until every queued buffer has been written.
+     *
+     *  Errors are not reported by this call, check the handles or call
+     *  close().
+     *
+     *  @throw None No throw guarantee.
+     */
+    void wait() noexcept;
+
+    /** @brief Writes everything queued and closes the file.
+     *
+     *  Calling close() more than once is allowed; later calls do nothing.
+     *
+     *  @throw std::system_error if any write, or closing the file, failed.
+     *                           The file is closed regardless.
+     */
+    void close();
+
+    /// Bytes of elements queued but not yet written. No throw guarantee.
+    size_type in_flight_bytes() const noexcept;
+
+    /// Was the file opened with O_DIRECT? No throw guarantee.
+    bool is_direct() const noexcept;
+
+private:
+    /// Wraps writing *@p pbuffer as a record into a job
+    template<typename TupleType>
+    static job_type make_job_(std::shared_ptr<buffer::FloatBuffer> pbuffer) {
+        return [pbuffer](detail_::ByteSink& sink,
+                         const WriteOptions& options) {
+            detail_::write_buffer<TupleType>(sink, *pbuffer, options);
+        };
+    }
+
+    /// Blocks until @p nbytes more bytes fit in the budget, then claims them
+    void reserve_(size_type nbytes);
+
+    /// Returns @p nbytes claimed by reserve_ to the budget
+    void release_(size_type nbytes) noexcept;
+
+    /// Hands @p job, which holds @p nbytes reserved bytes, to the thread
+    handle_type enqueue_(job_type job, size_type nbytes);
+
+    /// The state shared with the background thread
+    std::unique_ptr<detail_::WriteQueue> m_pqueue_;
+};
+
+} // namespace wtf::io
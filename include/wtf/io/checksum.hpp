@@ -0,0 +1,39 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace wtf::io {
+
+/** @brief Computes a 64-bit checksum of @p bytes.
+ *
+ *  The checksum is a fast, non-cryptographic hash which consumes the bytes
+ *  eight at a time. It is meant to detect accidental corruption (truncated or
+ *  bit-flipped files), not tampering. The result only depends on the values
+ *  of the bytes, i.e., it is the same on little and big endian machines.
+ *
+ *  @param[in] bytes The bytes to checksum.
+ *
+ *  @return The checksum of @p bytes.
+ *
+ *  @throw None No throw guarantee.
+ */
+std::uint64_t checksum(std::span<const std::byte> bytes) noexcept;
+
+} // namespace wtf::io
@@ -0,0 +1,235 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <wtf/buffer/buffer_view.hpp>
+#include <wtf/detail_/visit_type_name.hpp>
+#include <wtf/fp/float.hpp>
+#include <wtf/io/file_header.hpp>
+#include <wtf/io/serialization.hpp>
+
+namespace wtf::io {
+namespace detail_ {
+class ChunkPipeline;
+}
+
+/** @brief Streams the elements of a WTF buffer file in fixed-size chunks.
+ *
+ *  ChunkedReader is meant for files too large to hold in memory. The file is
+ *  read in chunks of chunk_size() elements; each call to next() returns a
+ *  read-only, type-erased view of the next chunk. While the caller processes
+ *  that chunk, the following chunk is read on a background thread into a
+ *  second chunk buffer, so computation and I/O overlap.
+ *
+ *  Only two chunk buffers are ever allocated, so memory use is bounded by
+ *  2 * chunk_size() elements regardless of the size of the file, and the
+ *  buffers are reused for every chunk (and across rewind() calls). The price
+ *  is that a view returned by next() is only valid until the following call
+ *  to next() or rewind(); copy the elements out if they are needed longer.
+ *
+ *  ChunkedReader objects are created with open_chunked_reader, which resolves
+ *  the type of the elements. Only bitwise-serializable types (see
+ *  type_traits::Serializer) can be streamed, since chunks of elements written
+ *  by a custom Serializer can not be located without reading everything
+ *  before them. Files written on machines with the other byte order are
+ *  byte-swapped as they are read. If the file has checksums they are verified
+ *  chunk by chunk, which requires each chunk to span a whole number of
+ *  checksum blocks.
+ */
+class ChunkedReader {
+public:
+    /// Type used for counting elements
+    using size_type = std::size_t;
+
+    /// Type of a read-only view of one chunk
+    using chunk_type = buffer::BufferView<const fp::Float>;
+
+    /// Type used to specify the file to read
+    using path_type = std::filesystem::path;
+
+    /// Type of a function which wraps raw chunk memory in a chunk_type
+    using view_factory = chunk_type (*)(const std::byte*, size_type);
+
+    /** @brief Creates a reader for the file at @p path.
+     *
+     *  Users should call open_chunked_reader rather than this ctor. Reading
+     *  the first chunk starts before the ctor returns.
+     *
+     *  @param[in] path The file to read.
+     *  @param[in] header The header of the file at @p path.
+     *  @param[in] chunk_size The number of elements per chunk. The last chunk
+     *                        may be shorter.
+     *  @param[in] make_view Wraps chunk memory holding elements of the type
+     *                       described by @p header in a chunk_type. May be
+     *                       null if the file holds no elements.
+     *  @param[in] word_size The number of bytes reversed together if the
+     *                       file's byte order is not native (see
+     *                       type_traits::WordSize). 0, the default, means
+     *                       the element size.
+     *
+     *  @throw std::invalid_argument if @p chunk_size is 0 or a chunk would
+     *                               not fit in size_type bytes, if @p header
+     *                               describes elements written by a custom
+     *                               Serializer, or if the file has checksums
+     *                               and chunks do not span whole checksum
+     *                               blocks. Strong throw guarantee.
+     *  @throw std::system_error if the file can not be opened or the
+     *                           background thread can not be started. Strong
+     *                           throw guarantee.
+     *  @throw std::bad_alloc if allocating the chunk buffers fails. Strong
+     *                        throw guarantee.
+     */
+    ChunkedReader(const path_type& path, FileHeader header,
+                  size_type chunk_size, view_factory make_view,
+                  size_type word_size = 0);
+
+    /** @brief Takes the state of @p other.
+     *
+     *  @p other is left as an empty reader: next() returns std::nullopt,
+     *  rewind() does nothing, and the sizes are 0.
+     *
+     *  @param[in,out] other The reader to take the state of.
+     *
+     *  @throw None No throw guarantee.
+     */
+    ChunkedReader(ChunkedReader&& other) noexcept;
+
+    /** @brief Overrides the state of *this with the state of @p other.
+     *
+     *  Waits for any pending read of *this first. @p other is left as an
+     *  empty reader (see the move ctor).
+     *
+     *  @param[in,out] other The reader to take the state of.
+     *
+     *  @return *this after taking the state of @p other.
+     *
+     *  @throw None No throw guarantee.
+     */
+    ChunkedReader& operator=(ChunkedReader&& other) noexcept;
+
+    /// Waits for any pending read, then releases the file and chunk buffers
+    ~ChunkedReader() noexcept;
+
+    /** @brief Returns the next chunk of the file.
+     *
+     *  This call waits for the chunk to finish being read (if it has not
+     *  already) and then starts reading the chunk after it. The returned view
+     *  is invalidated by the next call to next() or rewind().
+     *
+     *  @return A view of the next chunk, or std::nullopt if every chunk has
+     *          been returned.
+     *
+     *  @throw std::system_error if reading the chunk failed. The reader is
+     *                           left at the end of the file.
+     *  @throw std::runtime_error if the chunk failed its checksum. The reader
+     *                            is left at the end of the file.
+     *  @throw std::bad_alloc if allocating the view fails. Strong throw
+     *                        guarantee.
+     */
+    std::optional<chunk_type> next();
+
+    /** @brief Starts reading the file from the beginning again.
+     *
+     *  The chunk buffers are reused, no memory is allocated.
+     *
+     *  @throw None No throw guarantee.
+     */
+    void rewind() noexcept;
+
+    /// The total number of elements in the file. No throw guarantee.
+    size_type size() const noexcept;
+
+    /// The maximum number of elements in a chunk. No throw guarantee.
+    size_type chunk_size() const noexcept;
+
+    /// The number of chunks the file is split into. No throw guarantee.
+    size_type n_chunks() const noexcept;
+
+    /// The header of the file being read (a default header if *this was
+    /// moved from). No throw guarantee.
+    const FileHeader& header() const noexcept;
+
+private:
+    /// The state shared with the background thread
+    std::unique_ptr<detail_::ChunkPipeline> m_ppipeline_;
+};
+
+/** @brief Opens a WTF buffer file for streaming in chunks.
+ *
+ *  @tparam TupleType A std::tuple of the floating-point types the file may
+ *                    hold. Must be explicitly provided by the caller.
+ *
+ *  Typical usage:
+ *
+ *  ```cpp
+ *  auto reader = open_chunked_reader<std::tuple<float, double>>(path, 4096);
+ *  while(auto chunk = reader.next()) process(*chunk);
+ *  ```
+ *
+ *  @param[in] path The file to read. Must have been written by
+ *                  write_float_buffer or be a mapped buffer file.
+ *  @param[in] chunk_size The number of elements per chunk.
+ *
+ *  @return A reader which will stream the elements of the file.
+ *
+ *  @throw std::runtime_error if the header is invalid, the elements are not
+ *                            one of the types in @p TupleType, or their size
+ *                            does not match the type. Strong throw guarantee.
+ *  @throw std::invalid_argument if the elements can not be streamed or
+ *                               @p chunk_size is invalid (see the
+ *                               ChunkedReader ctor). Strong throw guarantee.
+ *  @throw std::system_error if the file can not be read. Strong throw
+ *                           guarantee.
+ */
+template<typename TupleType>
+ChunkedReader open_chunked_reader(const std::filesystem::path& path,
+                                  std::size_t chunk_size) {
+    auto header = FileHeader::read(path);
+    if(header.type_name == detail_::empty_type_name) {
+        return ChunkedReader(path, std::move(header), chunk_size, nullptr);
+    }
+
+    auto lambda = [&](auto type_id) -> ChunkedReader::view_factory {
+        using float_type = typename decltype(type_id)::type;
+        if constexpr(!std::is_trivially_copyable_v<float_type>) {
+            throw std::invalid_argument("Type can not be streamed");
+        } else {
+            if(header.element_size != sizeof(float_type)) {
+                throw std::runtime_error("Element size does not match type");
+            }
+            return [](const std::byte* p, std::size_t n) {
+                const auto* pbuffer = reinterpret_cast<const float_type*>(p);
+                return ChunkedReader::chunk_type(pbuffer, n);
+            };
+        }
+    };
+    auto make_view =
+      wtf::detail_::visit_type_name<TupleType>(header.type_name, lambda);
+    auto word_size = wtf::detail_::visit_type_name<TupleType>(
+      header.type_name, [](auto type_id) {
+          return type_traits::word_size_v<typename decltype(type_id)::type>;
+      });
+    return ChunkedReader(path, std::move(header), chunk_size, make_view,
+                         word_size);
+}
+
+} // namespace wtf::io
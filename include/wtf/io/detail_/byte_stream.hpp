@@ -0,0 +1,239 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdlib>
+#include <iosfwd>
+#include <memory>
+#include <optional>
+#include <span>
+
+namespace wtf::io::detail_ {
+
+/** @brief Type-erases where serialized bytes are written to.
+ *
+ *  The serialization routines describe what they want to write as a list of
+ *  byte ranges (a "gather list"). Derived classes then write those ranges to
+ *  the actual destination, ideally without first copying them into a single
+ *  buffer.
+ */
+class ByteSink {
+public:
+    /// Type of one contiguous range of bytes to write
+    using piece_type = std::span<const std::byte>;
+
+    /// Type of the list of ranges to write
+    using gather_list = std::span<const piece_type>;
+
+    /// Default virtual dtor
+    virtual ~ByteSink() = default;
+
+    /** @brief Writes the pieces, in order, to the destination.
+     *
+     *  @param[in] pieces The ranges of bytes to write.
+     *
+     *  @throw std::system_error if writing fails. No throw guarantee, some of
+     *                           the bytes may have been written.
+     */
+    virtual void write(gather_list pieces) = 0;
+};
+
+/** @brief Writes bytes to a std::ostream.
+ *
+ *  The pieces are handed to the stream one at a time; for file streams large
+ *  pieces bypass the stream's internal buffer.
+ */
+class StreamSink : public ByteSink {
+public:
+    /// Wraps @p os, which must outlive *this
+    explicit StreamSink(std::ostream& os) noexcept : m_os_(os) {}
+
+    /// Writes each piece with std::ostream::write
+    void write(gather_list pieces) override;
+
+private:
+    /// The stream being written to
+    std::ostream& m_os_;
+};
+
+/** @brief Writes bytes to a POSIX file descriptor.
+ *
+ *  All pieces are written with writev, so the bytes go straight from the
+ *  caller's buffers to the OS without being copied into a staging buffer.
+ */
+class FileDescriptorSink : public ByteSink {
+public:
+    /// Wraps @p fd, which must stay open for the life of *this
+    explicit FileDescriptorSink(int fd) noexcept : m_fd_(fd) {}
+
+    /// Writes the pieces with as few writev calls as possible
+    void write(gather_list pieces) override;
+
+private:
+    /// The file descriptor being written to
+    int m_fd_;
+};
+
+/** @brief Writes bytes to a POSIX file descriptor in aligned blocks.
+ *
+ *  Files opened with O_DIRECT bypass the OS's page cache, but every write
+ *  must then start at an aligned offset, cover an aligned number of bytes,
+ *  and come from an aligned buffer. This sink copies the pieces into an
+ *  aligned staging buffer and only writes whole staging buffers. finish()
+ *  writes the partially filled tail (padded to the alignment) and then trims
+ *  the padding off of the file. The sink also works for files opened without
+ *  O_DIRECT, where it simply coalesces small writes.
+ *
+ *  The file must be empty (or positioned at an aligned offset) when the sink
+ *  is created and only written to through the sink.
+ */
+class AlignedFileSink : public ByteSink {
+public:
+    /// Type used for sizes and offsets (in bytes)
+    using size_type = std::size_t;
+
+    /** @brief Wraps @p fd, which must stay open for the life of *this.
+     *
+     *  @param[in] fd The file to write to.
+     *  @param[in] alignment The required alignment, in bytes, of the staging
+     *                       buffer and of file offsets. Must be a power of 2.
+     *  @param[in] capacity The size of the staging buffer in bytes. Must be a
+     *                      non-zero multiple of @p alignment.
+     *
+     *  @throw std::invalid_argument if @p alignment or @p capacity are
+     *                               invalid. Strong throw guarantee.
+     *  @throw std::bad_alloc if allocating the staging buffer fails. Strong
+     *                        throw guarantee.
+     */
+    AlignedFileSink(int fd, size_type alignment, size_type capacity);
+
+    /// Copies the pieces into the staging buffer, writing it whenever full
+    void write(gather_list pieces) override;
+
+    /** @brief Writes the remaining staged bytes and trims the padding.
+     *
+     *  This must be the last call made on *this. Afterwards the file holds
+     *  exactly the bytes passed to write.
+     *
+     *  @throw std::system_error if writing or truncating fails. No throw
+     *                           guarantee.
+     */
+    void finish();
+
+    /// The total number of bytes passed to write. No throw guarantee.
+    size_type size() const noexcept { return m_written_ + m_fill_; }
+
+private:
+    /// Releases memory from std::aligned_alloc
+    struct FreeDeleter {
+        void operator()(std::byte* p) const noexcept { std::free(p); }
+    };
+
+    /// Writes the first @p n bytes of the staging buffer to the file
+    void write_staged_(size_type n);
+
+    /// The file descriptor being written to
+    int m_fd_;
+
+    /// Required alignment of offsets, sizes, and the staging buffer
+    size_type m_alignment_;
+
+    /// The size of the staging buffer
+    size_type m_capacity_;
+
+    /// The staging buffer
+    std::unique_ptr<std::byte, FreeDeleter> m_buffer_;
+
+    /// The number of bytes in the staging buffer
+    size_type m_fill_ = 0;
+
+    /// The number of bytes written to the file
+    size_type m_written_ = 0;
+};
+
+/** @brief Type-erases where serialized bytes are read from.
+ *
+ *  Reads always go directly into the caller's buffer, which allows the
+ *  deserialization routines to read elements straight into the memory of the
+ *  buffer being filled.
+ */
+class ByteSource {
+public:
+    /// Default virtual dtor
+    virtual ~ByteSource() = default;
+
+    /** @brief Fills @p bytes with the next bytes of the source.
+     *
+     *  @param[in] bytes Where to put the bytes. Exactly bytes.size() bytes
+     *                   are read.
+     *
+     *  @throw std::runtime_error if the source ends before @p bytes is full.
+     *                            No throw guarantee.
+     *  @throw std::system_error if reading fails. No throw guarantee.
+     */
+    virtual void read(std::span<std::byte> bytes) = 0;
+
+    /** @brief The number of bytes left in the source, if it is known.
+     *
+     *  Used to reject records whose headers claim more data than there is
+     *  before allocating memory for it. The default does not know.
+     *
+     *  @return The number of bytes which can still be read, or an empty
+     *          optional if the source can not tell (e.g., a pipe).
+     *
+     *  @throw None No throw guarantee.
+     */
+    virtual std::optional<std::size_t> remaining() noexcept {
+        return std::nullopt;
+    }
+};
+
+/// Reads bytes from a std::istream
+class StreamSource : public ByteSource {
+public:
+    /// Wraps @p is, which must outlive *this
+    explicit StreamSource(std::istream& is) noexcept : m_is_(is) {}
+
+    /// Reads with std::istream::read
+    void read(std::span<std::byte> bytes) override;
+
+    /// The distance to the end of the stream, if it is seekable
+    std::optional<std::size_t> remaining() noexcept override;
+
+private:
+    /// The stream being read from
+    std::istream& m_is_;
+};
+
+/// Reads bytes from a POSIX file descriptor
+class FileDescriptorSource : public ByteSource {
+public:
+    /// Wraps @p fd, which must stay open for the life of *this
+    explicit FileDescriptorSource(int fd) noexcept : m_fd_(fd) {}
+
+    /// Calls read until all bytes have been read
+    void read(std::span<std::byte> bytes) override;
+
+    /// The distance to the end of the file, if it is a regular file
+    std::optional<std::size_t> remaining() noexcept override;
+
+private:
+    /// The file descriptor being read from
+    int m_fd_;
+};
+
+} // namespace wtf::io::detail_
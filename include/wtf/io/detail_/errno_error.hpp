@@ -0,0 +1,32 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <string>
+
+namespace wtf::io::detail_ {
+
+/** @brief Throws a std::system_error built from errno.
+ *
+ *  Shared by the sources which call POSIX I/O functions directly.
+ *
+ *  @param[in] what The message of the exception.
+ *
+ *  @throw std::system_error always.
+ */
+[[noreturn]] void throw_errno(const std::string& what);
+
+} // namespace wtf::io::detail_
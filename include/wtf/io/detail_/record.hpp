@@ -0,0 +1,156 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <cstddef>
+#include <span>
+#include <string>
+#include <string_view>
+#include <wtf/io/detail_/byte_stream.hpp>
+#include <wtf/io/file_header.hpp>
+
+namespace wtf::io::detail_ {
+
+// A serialized buffer (a "record") is a FileHeader, the payload (i.e., the
+// serialized elements), and optionally the checksums of the payload.
+
+/** @brief Reads a header, including its padding, from @p source.
+ *
+ *  @param[in] source Where to read the header from.
+ *
+ *  @return The header which was read.
+ *
+ *  @throw std::runtime_error if the bytes are not a valid header or
+ *                            @p source ends early. No throw guarantee.
+ */
+FileHeader read_header(ByteSource& source);
+
+/// Records read from sources of unknown length (e.g., pipes) may not claim
+/// more payload bytes than this, since the claim can not be checked
+inline constexpr std::size_t max_unsized_payload_bytes = std::size_t{1} << 32;
+
+/** @brief Checks that the payload @p header describes can be read from
+ *         @p source, before anything is allocated for it.
+ *
+ *  The payload (and its checksums) must not overflow std::size_t and must
+ *  fit in what is left of @p source or, if @p source can not tell, in
+ *  max_unsized_payload_bytes. Elements written by a custom Serializer are
+ *  assumed to take at least one byte each.
+ *
+ *  @param[in] source Where the payload will be read from. The header must
+ *                    have already been read.
+ *  @param[in] header The header which was read.
+ *
+ *  @throw std::runtime_error if the payload can not be read. Strong throw
+ *                            guarantee.
+ */
+void check_payload_size(ByteSource& source, const FileHeader& header);
+
+/** @brief Writes a complete record to @p sink.
+ *
+ *  The header, payload, and checksums (if header.checksum_block_size is not
+ *  zero) are written with a single gather write. The payload is not copied.
+ *
+ *  @param[in] sink Where to write the record.
+ *  @param[in] header The header of the record.
+ *  @param[in] payload The serialized elements.
+ *
+ *  @throw std::system_error if writing fails. No throw guarantee.
+ */
+void write_record(ByteSink& sink, const FileHeader& header,
+                  std::span<const std::byte> payload);
+
+/** @brief Reads the payload (and checksums) which follow a header.
+ *
+ *  @param[in] source Where to read the payload from. The header must have
+ *                    already been read.
+ *  @param[in] header The header which was read.
+ *  @param[out] payload Where to put the payload. Must be exactly the size of
+ *                      the payload.
+ *
+ *  @throw std::runtime_error if @p source ends early or a checksum does not
+ *                            match. No throw guarantee.
+ */
+void read_payload(ByteSource& source, const FileHeader& header,
+                  std::span<std::byte> payload);
+
+/** @brief Computes the checksums of @p payload.
+ *
+ *  @param[in] payload The bytes to checksum.
+ *  @param[in] block The number of bytes covered by each checksum. The last
+ *                   block may be shorter. If 0 no checksums are computed.
+ *
+ *  @return The checksums, serialized as they are stored after the payload.
+ *
+ *  @throw std::bad_alloc if allocating the checksums fails. Strong throw
+ *                        guarantee.
+ */
+FileHeader::byte_buffer make_checksums(std::span<const std::byte> payload,
+                                       std::size_t block);
+
+/** @brief Compares the checksums of @p payload to @p stored.
+ *
+ *  @param[in] payload The bytes to check. May be part of a larger payload,
+ *                     in which case it must start on a block boundary.
+ *  @param[in] block The number of bytes covered by each checksum.
+ *  @param[in] stored The stored checksums of @p payload (as returned by
+ *                    make_checksums).
+ *  @param[in] first_block The index of the block @p payload starts with.
+ *                         Only used to make the error message useful.
+ *
+ *  @throw std::runtime_error if a checksum does not match. Strong throw
+ *                            guarantee.
+ */
+void check_checksums(std::span<const std::byte> payload, std::size_t block,
+                     std::span<const std::byte> stored,
+                     std::size_t first_block = 0);
+
+/** @brief Builds the payload for elements written by a custom Serializer.
+ *
+ *  @param[in] blob The bytes written by the Serializer.
+ *
+ *  @return The byte count of @p blob followed by @p blob.
+ *
+ *  @throw std::bad_alloc if allocating the payload fails. Strong throw
+ *                        guarantee.
+ */
+FileHeader::byte_buffer make_custom_payload(std::string_view blob);
+
+/** @brief Reads the payload of elements written by a custom Serializer.
+ *
+ *  @param[in] source Where to read the payload from. The header must have
+ *                    already been read.
+ *  @param[in] header The header which was read.
+ *
+ *  @return The bytes written by the Serializer.
+ *
+ *  @throw std::runtime_error if @p source ends early, the stored byte count
+ *                            is more than @p source holds (see
+ *                            check_payload_size), or a checksum does not
+ *                            match. No throw guarantee.
+ */
+std::string read_custom_payload(ByteSource& source, const FileHeader& header);
+
+/** @brief Reverses the byte order of each element in @p bytes.
+ *
+ *  @param[in,out] bytes The elements to byte swap.
+ *  @param[in] element_size The number of bytes in each element.
+ *
+ *  @throw None No throw guarantee.
+ */
+void byte_swap(std::span<std::byte> bytes, std::size_t element_size) noexcept;
+
+} // namespace wtf::io::detail_
@@ -0,0 +1,213 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <vector>
+#include <wtf/type_traits/type_name.hpp>
+
+namespace wtf::io {
+
+/** @brief The header WTF writes at the start of a buffer file.
+ *
+ *  WTF buffer files are laid out as a small header followed by the raw
+ *  elements of the buffer. The header records what type the elements are so
+ *  that the file can be read back without knowing the type at compile time.
+ *  On disk the header looks like:
+ *
+ *  | Bytes | Contents                                            |
+ *  |-------|-----------------------------------------------------|
+ *  | 4     | The magic bytes "WTFB"                              |
+ *  | 2     | Format version                                      |
+ *  | 1     | Endianness of the elements (1 = little, 2 = big)    |
+ *  | 1     | Flags (bit 0 set if the data is checksummed)        |
+ *  | 4     | Size of one element, in bytes                       |
+ *  | 4     | Length of the type name, in bytes                   |
+ *  | 8     | Number of elements                                  |
+ *  | 8     | Offset of the first element from the start of file  |
+ *  | 4     | Bytes per checksummed block (0 if not checksummed)  |
+ *  | 4     | Reserved, must be 0                                 |
+ *  | N     | The type name (as given by type_traits::TypeName)   |
+ *
+ *  The integers in the header are always stored little endian. The header is
+ *  zero-padded so that the elements start on a data_alignment boundary, which
+ *  makes it possible to memory map the elements directly.
+ *
+ *  An element size of 0 means the elements were written by a custom
+ *  type_traits::Serializer. In that case the data starts with the number of
+ *  serialized bytes (as a little endian 8 byte integer) followed by the bytes
+ *  themselves. If the data is checksummed the checksums (see io::checksum)
+ *  follow the data, one little endian 8 byte integer per block.
+ */
+struct FileHeader {
+    /// Type used for sizes and offsets
+    using size_type = std::size_t;
+
+    /// Type used to hold the serialized header
+    using byte_buffer = std::vector<std::byte>;
+
+    /// Possible byte orders of the elements
+    enum class Endianness : std::uint8_t { little = 1, big = 2 };
+
+    /// Version of the format written by this version of WTF
+    static constexpr std::uint16_t current_version = 1;
+
+    /// Size of the fixed-length part of the header, in bytes
+    static constexpr size_type fixed_size = 40;
+
+    /// The elements start on a multiple of this many bytes
+    static constexpr size_type data_alignment = 64;
+
+    /// The name of the element type, i.e., type_traits::type_name_v<T>
+    std::string type_name;
+
+    /// The size of one element, in bytes
+    size_type element_size = 0;
+
+    /// The number of elements
+    size_type size = 0;
+
+    /// The byte order of the elements
+    Endianness endianness = native_endianness();
+
+    /// Number of bytes covered by each checksum, 0 if there are no checksums
+    size_type checksum_block_size = 0;
+
+    /// The format version of the header
+    std::uint16_t version = current_version;
+
+    /** @brief Creates the header describing @p n elements of type @p T.
+     *
+     *  @tparam T The type of the elements. Must be registered with WTF.
+     *
+     *  @param[in] n The number of elements.
+     *
+     *  @return A header for @p n elements of type @p T stored in the native
+     *          byte order.
+     *
+     *  @throw std::bad_alloc if copying the type name fails. Strong throw
+     *                        guarantee.
+     */
+    template<typename T>
+    static FileHeader make(size_type n) {
+        FileHeader header;
+        header.type_name    = type_traits::type_name_v<T>;
+        header.element_size = sizeof(T);
+        header.size         = n;
+        return header;
+    }
+
+    /** @brief The byte order of the machine this code is running on.
+     *
+     *  @return The native byte order.
+     *
+     *  @throw None No throw guarantee.
+     */
+    static constexpr Endianness native_endianness() noexcept {
+        return std::endian::native == std::endian::big ? Endianness::big :
+                                                         Endianness::little;
+    }
+
+    /** @brief Offset of the first element from the start of the file.
+     *
+     *  @return The number of bytes which precede the first element.
+     *
+     *  @throw None No throw guarantee.
+     */
+    size_type data_offset() const noexcept;
+
+    /** @brief The number of bytes the elements occupy.
+     *
+     *  @return size * element_size.
+     *
+     *  @throw None No throw guarantee.
+     */
+    size_type data_size() const noexcept { return size * element_size; }
+
+    /** @brief Serializes *this, including the padding before the elements.
+     *
+     *  @return A buffer of data_offset() bytes holding *this.
+     *
+     *  @throw std::bad_alloc if allocating the buffer fails. Strong throw
+     *                        guarantee.
+     */
+    byte_buffer to_bytes() const;
+
+    /** @brief Works out how long a header is from its first bytes.
+     *
+     *  Headers are variable length. This function is used when reading a
+     *  header from a stream to work out how many more bytes need to be read.
+     *
+     *  @param[in] prefix At least the first fixed_size bytes of the header.
+     *
+     *  @return The total number of bytes in the header, including the
+     *          padding before the elements (i.e., data_offset()).
+     *
+     *  @throw std::runtime_error if @p prefix does not look like the start
+     *                            of a header. Strong throw guarantee.
+     */
+    static size_type total_size(std::span<const std::byte> prefix);
+
+    /** @brief Deserializes a header.
+     *
+     *  @param[in] bytes The bytes to parse. Must start with the header.
+     *                   Bytes after the header are ignored.
+     *
+     *  @return The parsed header.
+     *
+     *  @throw std::runtime_error if @p bytes does not hold a valid header.
+     *                            Strong throw guarantee.
+     */
+    static FileHeader from_bytes(std::span<const std::byte> bytes);
+
+    /** @brief Reads the header at the start of @p path.
+     *
+     *  @param[in] path The file to read the header of.
+     *
+     *  @return The parsed header.
+     *
+     *  @throw std::system_error if the file can not be read. Strong throw
+     *                           guarantee.
+     *  @throw std::runtime_error if the file does not start with a valid
+     *                            header. Strong throw guarantee.
+     */
+    static FileHeader read(const std::filesystem::path& path);
+
+    /** @brief Creates a file holding *this followed by zeroed elements.
+     *
+     *  The file is created (or truncated if it already exists), *this is
+     *  written at the start of it, and the file is then extended so that it
+     *  holds data_size() zero bytes after the header. On most file systems
+     *  the extension is sparse, i.e., no disk space is used until the
+     *  elements are written.
+     *
+     *  @param[in] path The file to create.
+     *
+     *  @throw std::system_error if the file can not be created or written.
+     *                           Weak throw guarantee, the file may exist.
+     */
+    void create_file(const std::filesystem::path& path) const;
+
+    /// Headers are equal if all of their fields are equal
+    bool operator==(const FileHeader&) const = default;
+};
+
+} // namespace wtf::io
@@ -0,0 +1,32 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <wtf/io/async_writer.hpp>
+#include <wtf/io/checksum.hpp>
+#include <wtf/io/chunked_reader.hpp>
+#include <wtf/io/file_header.hpp>
+#include <wtf/io/memory_map.hpp>
+#include <wtf/io/serialization.hpp>
+
+/** @brief Classes and functions for moving floating-point data to and from
+ *         files.
+ *
+ *  This namespace contains the low-level pieces (file format, memory maps,
+ *  etc.) used to implement WTF's I/O. Most users will want the higher-level
+ *  functions, such as buffer::map_float_buffer, built on top of them.
+ */
+namespace wtf::io {}
@@ -0,0 +1,192 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <cstddef>
+#include <filesystem>
+
+namespace wtf::io {
+
+/** @brief RAII wrapper around a memory-mapped region of a file.
+ *
+ *  This class owns a POSIX memory mapping. The mapping is established by the
+ *  ctor and torn down by the dtor. Because the OS requires mappings to start
+ *  on a page boundary, *this internally maps slightly more than requested and
+ *  data() points at the first requested byte.
+ *
+ *  MemoryMap objects are move-only. Moving a MemoryMap does not change the
+ *  address of the mapped memory, so pointers into the mapping remain valid.
+ */
+class MemoryMap {
+public:
+    /// Type used for sizes and offsets (in bytes)
+    using size_type = std::size_t;
+
+    /// Type of a pointer to the mapped bytes
+    using pointer = std::byte*;
+
+    /// Type of a read-only pointer to the mapped bytes
+    using const_pointer = const std::byte*;
+
+    /// Type used to specify which file to map
+    using path_type = std::filesystem::path;
+
+    /** @brief How the mapping interacts with the underlying file.
+     *
+     *  - read_only: the file is never modified. The memory is still writable,
+     *    but writes are private to the process (copy-on-write).
+     *  - read_write: writes are shared with the file and are made durable by
+     *    flush() (or eventually by the OS).
+     */
+    enum class Mode { read_only, read_write };
+
+    /// Hints to the OS about how the mapped memory will be accessed
+    enum class Advice { normal, sequential, random, will_need, dont_need };
+
+    /** @brief Creates an object which does not map anything.
+     *
+     *  @throw None No throw guarantee.
+     */
+    MemoryMap() noexcept = default;
+
+    /** @brief Maps @p length bytes of @p path starting at byte @p offset.
+     *
+     *  @param[in] path The file to map.
+     *  @param[in] mode How changes to the memory relate to the file.
+     *  @param[in] offset The byte offset of the first byte to map. Need not
+     *                    be page aligned.
+     *  @param[in] length The number of bytes to map. May be zero, in which
+     *                    case nothing is mapped.
+     *
+     *  @throw std::system_error if the file can not be opened or mapped.
+     *                           Strong throw guarantee.
+     *  @throw std::out_of_range if the requested region extends past the end
+     *                           of the file. Strong throw guarantee.
+     */
+    MemoryMap(const path_type& path, Mode mode, size_type offset,
+              size_type length);
+
+    /// Move-only
+    ///@{
+    MemoryMap(const MemoryMap&)            = delete;
+    MemoryMap& operator=(const MemoryMap&) = delete;
+    ///@}
+
+    /** @brief Takes ownership of the mapping in @p other.
+     *
+     *  @param[in,out] other The object to take the mapping from. After the
+     *                       call @p other does not map anything.
+     *
+     *  @throw None No throw guarantee.
+     */
+    MemoryMap(MemoryMap&& other) noexcept;
+
+    /** @brief Releases the mapping in *this and takes the one in @p other.
+     *
+     *  @param[in,out] other The object to take the mapping from. After the
+     *                       call @p other does not map anything.
+     *
+     *  @return *this after taking the mapping from @p other.
+     *
+     *  @throw None No throw guarantee.
+     */
+    MemoryMap& operator=(MemoryMap&& other) noexcept;
+
+    /// Unmaps the memory (if any). Unflushed shared writes are not lost, the
+    /// OS will still write them back eventually.
+    ~MemoryMap() noexcept;
+
+    /** @brief The address of the first requested byte.
+     *
+     *  @return A pointer to the first mapped byte, or nullptr if nothing is
+     *          mapped.
+     *
+     *  @throw None No throw guarantee.
+     */
+    pointer data() noexcept { return m_pbase_ ? m_pbase_ + m_shift_ : nullptr; }
+
+    /// Read-only version of data()
+    const_pointer data() const noexcept {
+        return m_pbase_ ? m_pbase_ + m_shift_ : nullptr;
+    }
+
+    /** @brief The number of requested bytes.
+     *
+     *  @return The number of bytes which may be accessed starting at data().
+     *
+     *  @throw None No throw guarantee.
+     */
+    size_type size() const noexcept { return m_length_; }
+
+    /** @brief How was the file mapped?
+     *
+     *  @return The mode the file was mapped with.
+     *
+     *  @throw None No throw guarantee.
+     */
+    Mode mode() const noexcept { return m_mode_; }
+
+    /** @brief Hints to the OS how the whole mapping will be accessed.
+     *
+     *  @param[in] advice The expected access pattern.
+     *
+     *  @throw std::system_error if the OS rejects the hint. Strong throw
+     *                           guarantee.
+     */
+    void advise(Advice advice) { advise(advice, 0, m_length_); }
+
+    /** @brief Hints to the OS how part of the mapping will be accessed.
+     *
+     *  @param[in] advice The expected access pattern.
+     *  @param[in] offset Offset, relative to data(), of the first byte the
+     *                    hint applies to.
+     *  @param[in] length The number of bytes the hint applies to.
+     *
+     *  @throw std::out_of_range if the region is not part of the mapping.
+     *                           Strong throw guarantee.
+     *  @throw std::system_error if the OS rejects the hint. Strong throw
+     *                           guarantee.
+     */
+    void advise(Advice advice, size_type offset, size_type length);
+
+    /** @brief Synchronously writes modified pages back to the file.
+     *
+     *  This is a no-op for read_only mappings (their writes are private) and
+     *  for objects which do not map anything.
+     *
+     *  @throw std::system_error if writing back the pages fails. Strong throw
+     *                           guarantee.
+     */
+    void flush();
+
+private:
+    /// Releases the mapping (if any)
+    void unmap_() noexcept;
+
+    /// Page-aligned address returned by the OS
+    pointer m_pbase_ = nullptr;
+
+    /// Offset from m_pbase_ to the first requested byte
+    size_type m_shift_ = 0;
+
+    /// Number of requested bytes
+    size_type m_length_ = 0;
+
+    /// How the file was mapped
+    Mode m_mode_ = Mode::read_only;
+};
+
+} // namespace wtf::io
@@ -0,0 +1,389 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <cstddef>
+#include <istream>
+#include <ostream>
+#include <span>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+#include <wtf/buffer/buffer_view.hpp>
+#include <wtf/buffer/float_buffer.hpp>
+#include <wtf/detail_/visit_type_name.hpp>
+#include <wtf/fp/float.hpp>
+#include <wtf/io/detail_/byte_stream.hpp>
+#include <wtf/io/detail_/record.hpp>
+#include <wtf/io/file_header.hpp>
+#include <wtf/type_traits/serializer.hpp>
+#include <wtf/type_traits/type_name.hpp>
+
+namespace wtf::io {
+
+/// Options controlling how buffers are serialized
+struct WriteOptions {
+    /// Bytes covered by each checksum, 0 (the default) disables checksums
+    std::size_t checksum_block_size = 0;
+};
+
+namespace detail_ {
+
+/// Name recorded for empty buffers, whose type can not always be known
+inline constexpr std::string_view empty_type_name =
+  type_traits::type_name_v<std::nullptr_t>;
+
+/** @brief Serializes @p values to @p sink.
+ *
+ *  @tparam T The type of the elements. Must be serializable per
+ *            type_traits::Serializer.
+ *
+ *  Bitwise types are written straight from @p values. Other types are first
+ *  serialized into memory with their Serializer.
+ *
+ *  @param[in] sink Where to write the record.
+ *  @param[in] values The elements to write.
+ *  @param[in] options How to write the record.
+ *
+ *  @throw std::runtime_error if @p T can not be serialized. Strong throw
+ *                            guarantee.
+ *  @throw std::system_error if writing fails. No throw guarantee.
+ */
+template<typename T>
+void write_span(ByteSink& sink, std::span<const T> values,
+                const WriteOptions& options) {
+    using serializer_type = type_traits::Serializer<T>;
+
+    auto header                = FileHeader::make<T>(values.size());
+    header.checksum_block_size = options.checksum_block_size;
+    if constexpr(serializer_type::is_bitwise) {
+        write_record(sink, header, std::as_bytes(values));
+    } else if constexpr(type_traits::has_custom_serializer_v<T>) {
+        header.element_size = 0;
+        std::ostringstream os(std::ios::binary);
+        for(const auto& value : values) serializer_type::write(os, value);
+        write_record(sink, header, make_custom_payload(os.view()));
+    } else {
+        throw std::runtime_error(std::string(type_traits::type_name_v<T>) +
+                                 " does not have a Serializer");
+    }
+}
+
+/** @brief Deserializes the payload described by @p header into @p values.
+ *
+ *  @tparam T The type of the elements. Must be the type described by
+ *            @p header.
+ *
+ *  @param[in] source Where to read the payload from. The header must have
+ *                    already been read.
+ *  @param[in] header The header which was read.
+ *  @param[out] values Where to put the elements. Must have header.size
+ *                     elements.
+ *
+ *  @throw std::runtime_error if the payload is not a serialized buffer of
+ *                            @p T objects or if it is corrupt. No throw
+ *                            guarantee.
+ */
+template<typename T>
+void read_span(ByteSource& source, const FileHeader& header,
+               std::span<T> values) {
+    using serializer_type = type_traits::Serializer<T>;
+
+    if constexpr(serializer_type::is_bitwise) {
+        if(header.element_size != sizeof(T)) {
+            throw std::runtime_error("Element size does not match type");
+        }
+        auto bytes = std::as_writable_bytes(values);
+        read_payload(source, header, bytes);
+        if(header.endianness != FileHeader::native_endianness())
+            byte_swap(bytes, type_traits::word_size_v<T>);
+    } else if constexpr(type_traits::has_custom_serializer_v<T>) {
+        if(header.element_size != 0) {
+            throw std::runtime_error("Data was not written by a Serializer");
+        }
+        std::istringstream is(read_custom_payload(source, header),
+                              std::ios::binary);
+        for(auto& value : values) serializer_type::read(is, value);
+        if(!is) throw std::runtime_error("Serializer ran out of data");
+    } else {
+        throw std::runtime_error(std::string(type_traits::type_name_v<T>) +
+                                 " does not have a Serializer");
+    }
+}
+
+/// Implements write_float_buffer for an arbitrary sink
+template<typename TupleType>
+void write_buffer(ByteSink& sink, buffer::BufferView<const fp::Float> buffer,
+                  const WriteOptions& options) {
+    if(buffer.size() == 0) {
+        FileHeader header;
+        header.type_name           = empty_type_name;
+        header.checksum_block_size = options.checksum_block_size;
+        write_record(sink, header, {});
+        return;
+    }
+
+    auto lambda = [&](auto values) {
+        using float_type = std::remove_const_t<
+          typename decltype(values)::element_type>;
+        write_span(sink, std::span<const float_type>(values), options);
+    };
+    buffer::visit_contiguous_buffer_view<TupleType>(lambda, buffer);
+}
+
+/// Implements read_float_buffer (the allocating version) for any source
+template<typename TupleType>
+buffer::FloatBuffer read_buffer(ByteSource& source) {
+    const auto header = read_header(source);
+    if(header.type_name == empty_type_name) return buffer::FloatBuffer{};
+
+    auto lambda = [&](auto type_id) {
+        using float_type = typename decltype(type_id)::type;
+        check_payload_size(source, header);
+        std::vector<float_type> values(header.size);
+        read_span(source, header, std::span<float_type>(values));
+        return buffer::FloatBuffer(std::move(values));
+    };
+    return wtf::detail_::visit_type_name<TupleType>(header.type_name, lambda);
+}
+
+/// Implements read_float_buffer (the in-place version) for any source
+template<typename TupleType>
+void read_buffer(ByteSource& source, buffer::BufferView<fp::Float> buffer) {
+    const auto header = read_header(source);
+    if(header.size != buffer.size()) {
+        throw std::runtime_error("Serialized buffer has " +
+                                 std::to_string(header.size) +
+                                 " elements, but the destination has " +
+                                 std::to_string(buffer.size()));
+    }
+    if(header.type_name == empty_type_name) return;
+
+    auto lambda = [&](auto values) {
+        using element_type = typename decltype(values)::element_type;
+        using float_type   = std::remove_const_t<element_type>;
+        if(header.type_name != type_traits::type_name_v<float_type>) {
+            throw std::runtime_error("Serialized buffer holds " +
+                                     header.type_name + " not " +
+                                     type_traits::type_name_v<float_type>);
+        }
+        if constexpr(std::is_const_v<element_type>) {
+            throw std::runtime_error("Can not read into a read-only buffer");
+        } else {
+            read_span(source, header, values);
+        }
+    };
+    buffer::visit_contiguous_buffer_view<TupleType>(lambda, buffer);
+}
+
+} // namespace detail_
+
+/** @brief Serializes a buffer to a stream.
+ *
+ *  @tparam TupleType A std::tuple of the floating-point types @p buffer may
+ *                    hold. Must be explicitly provided by the caller.
+ *
+ *  The buffer is written as a self-describing record: an io::FileHeader
+ *  (recording the type, element size, byte order, and number of elements)
+ *  followed by the elements and, optionally, checksums. Types whose
+ *  type_traits::Serializer is bitwise (e.g., the built-in floating-point
+ *  types) are written directly from the buffer's memory; other types use
+ *  their custom Serializer. Records written to a file can be memory mapped
+ *  with buffer::map_float_buffer if the type is bitwise and the record starts
+ *  at the beginning of the file.
+ *
+ *  @param[in] os The stream to write to.
+ *  @param[in] buffer The buffer to write. Must be contiguous.
+ *  @param[in] options How to write the buffer. Default writes no checksums.
+ *
+ *  @throw std::runtime_error if the type of @p buffer is not in
+ *                            @p TupleType or is not serializable. Strong
+ *                            throw guarantee.
+ *  @throw std::system_error if writing fails. No throw guarantee.
+ */
+template<typename TupleType>
+void write_float_buffer(std::ostream& os,
+                        buffer::BufferView<const fp::Float> buffer,
+                        WriteOptions options = {}) {
+    detail_::StreamSink sink(os);
+    detail_::write_buffer<TupleType>(sink, std::move(buffer), options);
+}
+
+/** @brief Serializes a buffer to a file descriptor.
+ *
+ *  This overload is the same as the std::ostream overload except that the
+ *  record is written with a single writev call (modulo partial writes). For
+ *  bitwise types the elements are handed to the OS directly from the
+ *  buffer's memory, so the cost is essentially that of a raw write.
+ *
+ *  @param[in] fd The open file descriptor to write to.
+ *  @param[in] buffer The buffer to write. Must be contiguous.
+ *  @param[in] options How to write the buffer. Default writes no checksums.
+ *
+ *  @throw std::runtime_error if the type of @p buffer is not in
+ *                            @p TupleType or is not serializable. Strong
+ *                            throw guarantee.
+ *  @throw std::system_error if writing fails. No throw guarantee.
+ */
+template<typename TupleType>
+void write_float_buffer(int fd, buffer::BufferView<const fp::Float> buffer,
+                        WriteOptions options = {}) {
+    detail_::FileDescriptorSink sink(fd);
+    detail_::write_buffer<TupleType>(sink, std::move(buffer), options);
+}
+
+/** @brief Deserializes a buffer from a stream.
+ *
+ *  @tparam TupleType A std::tuple of the floating-point types the record may
+ *                    hold. Must be explicitly provided by the caller.
+ *
+ *  The type of the elements is read from the record's header. Elements are
+ *  read directly into the new buffer's memory. If the record was written on a
+ *  machine with the other byte order, bitwise elements are byte swapped. If
+ *  the record is checksummed, the checksums are verified.
+ *
+ *  The number of elements the header claims is checked against the length
+ *  of the stream before the buffer is allocated. If @p is can not seek, the
+ *  claim can not be checked and records with more than
+ *  detail_::max_unsized_payload_bytes bytes of elements are rejected; read
+ *  those into an existing buffer instead.
+ *
+ *  @param[in] is The stream to read from.
+ *
+ *  @return The deserialized buffer.
+ *
+ *  @throw std::runtime_error if the record is invalid or corrupt, or its type
+ *                            is not in @p TupleType. No throw guarantee, the
+ *                            stream may have been partially consumed.
+ */
+template<typename TupleType>
+buffer::FloatBuffer read_float_buffer(std::istream& is) {
+    detail_::StreamSource source(is);
+    return detail_::read_buffer<TupleType>(source);
+}
+
+/** @brief Deserializes a buffer from a file descriptor.
+ *
+ *  This overload is the same as the std::istream overload except that it
+ *  reads from a POSIX file descriptor.
+ *
+ *  @param[in] fd The open file descriptor to read from.
+ *
+ *  @return The deserialized buffer.
+ *
+ *  @throw std::runtime_error if the record is invalid or corrupt, or its type
+ *                            is not in @p TupleType. No throw guarantee.
+ *  @throw std::system_error if reading fails. No throw guarantee.
+ */
+template<typename TupleType>
+buffer::FloatBuffer read_float_buffer(int fd) {
+    detail_::FileDescriptorSource source(fd);
+    return detail_::read_buffer<TupleType>(source);
+}
+
+/** @brief Deserializes a buffer from a stream into an existing buffer.
+ *
+ *  This overload does not allocate the elements. Instead they are read
+ *  directly into the memory aliased by @p buffer, which makes it suitable for
+ *  streaming many records through the same preallocated buffer.
+ *
+ *  @param[in] is The stream to read from.
+ *  @param[in] buffer Where to put the elements. Must be contiguous and have
+ *                    the same type and number of elements as the record.
+ *
+ *  @throw std::runtime_error if the record is invalid or corrupt, or does not
+ *                            match @p buffer. No throw guarantee.
+ */
+template<typename TupleType>
+void read_float_buffer(std::istream& is, buffer::BufferView<fp::Float> buffer) {
+    detail_::StreamSource source(is);
+    detail_::read_buffer<TupleType>(source, std::move(buffer));
+}
+
+/** @brief Deserializes a buffer from a file descriptor into an existing
+ *         buffer.
+ *
+ *  This overload is the same as the std::istream overload except that it
+ *  reads from a POSIX file descriptor.
+ *
+ *  @param[in] fd The open file descriptor to read from.
+ *  @param[in] buffer Where to put the elements. Must be contiguous and have
+ *                    the same type and number of elements as the record.
+ *
+ *  @throw std::runtime_error if the record is invalid or corrupt, or does not
+ *                            match @p buffer. No throw guarantee.
+ *  @throw std::system_error if reading fails. No throw guarantee.
+ */
+template<typename TupleType>
+void read_float_buffer(int fd, buffer::BufferView<fp::Float> buffer) {
+    detail_::FileDescriptorSource source(fd);
+    detail_::read_buffer<TupleType>(source, std::move(buffer));
+}
+
+/** @brief Serializes a single Float to a stream.
+ *
+ *  The Float is written as a record holding one element. See
+ *  write_float_buffer for details.
+ *
+ *  @tparam TupleType A std::tuple of the floating-point types @p value may
+ *                    hold. Must be explicitly provided by the caller.
+ *
+ *  @param[in] os The stream to write to.
+ *  @param[in] value The value to write.
+ *  @param[in] options How to write the value. Default writes no checksums.
+ *
+ *  @throw std::runtime_error if the type of @p value is not in @p TupleType
+ *                            or is not serializable. Strong throw guarantee.
+ *  @throw std::system_error if writing fails. No throw guarantee.
+ */
+template<typename TupleType>
+void write_float(std::ostream& os, const fp::Float& value,
+                 WriteOptions options = {}) {
+    detail_::StreamSink sink(os);
+    auto lambda = [&](const auto& x) {
+        using float_type = std::decay_t<decltype(x)>;
+        detail_::write_span(sink, std::span<const float_type>(&x, 1), options);
+    };
+    fp::visit_float<TupleType>(lambda, value);
+}
+
+/** @brief Deserializes a single Float from a stream.
+ *
+ *  @tparam TupleType A std::tuple of the floating-point types the record may
+ *                    hold. Must be explicitly provided by the caller.
+ *
+ *  @param[in] is The stream to read from.
+ *
+ *  @return The deserialized value.
+ *
+ *  @throw std::runtime_error if the record is invalid or corrupt, its type
+ *                            is not in @p TupleType, or it does not hold
+ *                            exactly one element. No throw guarantee.
+ */
+template<typename TupleType>
+fp::Float read_float(std::istream& is) {
+    auto buffer = read_float_buffer<TupleType>(is);
+    if(buffer.size() != 1) {
+        throw std::runtime_error("Serialized data is not a single Float");
+    }
+    auto lambda = [](auto values) { return fp::Float(values[0]); };
+    return buffer::visit_contiguous_buffer<TupleType>(lambda, buffer);
+}
+
+} // namespace wtf::io
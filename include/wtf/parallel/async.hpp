@@ -0,0 +1,136 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <chrono>
+#include <future>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <wtf/parallel/executor.hpp>
+
+namespace wtf::parallel {
+
+/** @brief Runs @p fxn on @p executor.
+ *
+ *  @tparam Fxn The type of the callable. Must be callable with no arguments.
+ *
+ *  @param[in] executor Where to run @p fxn.
+ *  @param[in] fxn The work to run. Copied (or moved) into the task.
+ *
+ *  @return A future holding the result of @p fxn, or the exception it threw.
+ *
+ *  @throw std::bad_alloc if creating or queuing the task fails. Strong throw
+ *                        guarantee.
+ */
+template<typename Fxn>
+auto async(Executor& executor, Fxn&& fxn) {
+    using result_type = std::invoke_result_t<std::decay_t<Fxn>&>;
+    using task_type   = std::packaged_task<result_type()>;
+    auto ptask  = std::make_shared<task_type>(std::forward<Fxn>(fxn));
+    auto future = ptask->get_future();
+    executor.submit([ptask]() { (*ptask)(); });
+    return future;
+}
+
+/** @brief Runs @p fxn on the current executor.
+ *
+ *  Independent kernels started this way overlap, e.g., two reductions over
+ *  different buffers:
+ *
+ *  ```cpp
+ *  auto sum_x = wtf::parallel::async([&]() { return sum(x); });
+ *  auto sum_y = wtf::parallel::async([&]() { return sum(y); });
+ *  auto total = wtf::parallel::get(std::move(sum_x)) +
+ *               wtf::parallel::get(std::move(sum_y));
+ *  ```
+ *
+ *  Parallel kernels called by @p fxn share the same threads, so nesting
+ *  does not oversubscribe the cores.
+ *
+ *  @tparam Fxn The type of the callable. Must be callable with no arguments.
+ *
+ *  @param[in] fxn The work to run. Copied (or moved) into the task.
+ *
+ *  @return A future holding the result of @p fxn, or the exception it threw.
+ *
+ *  @throw std::system_error if the default ThreadPool has to be created and
+ *                           can not be. Strong throw guarantee.
+ *  @throw std::bad_alloc if creating or queuing the task fails. Strong throw
+ *                        guarantee.
+ */
+template<typename Fxn>
+auto async(Fxn&& fxn) {
+    return async(*executor(), std::forward<Fxn>(fxn));
+}
+
+/** @brief Waits for @p future, running queued tasks while waiting.
+ *
+ *  Unlike std::future::get, the calling thread helps the current executor
+ *  until @p future is ready. Tasks which wait on other tasks should use this
+ *  so that a pool whose workers are all waiting can still make progress.
+ *
+ *  @tparam T The type of the result.
+ *
+ *  @param[in] future The future to wait on.
+ *
+ *  @return The result held by @p future.
+ *
+ *  @throw ??? Rethrows the exception held by @p future, if any.
+ */
+template<typename T>
+T get(std::future<T> future) {
+    auto pexecutor = executor();
+    while(future.wait_for(std::chrono::seconds(0)) !=
+          std::future_status::ready) {
+        if(!pexecutor->run_pending_task()) {
+            future.wait();
+            break;
+        }
+    }
+    return future.get();
+}
+
+/** @brief Runs @p fxn with the result of @p future, once it is ready.
+ *
+ *  @tparam T The type of the result of @p future.
+ *  @tparam Fxn The type of the continuation. Must be callable with a T (or
+ *              with no arguments if T is void).
+ *
+ *  @param[in] future The future to continue from.
+ *  @param[in] fxn The continuation. Copied (or moved) into the task.
+ *
+ *  @return A future holding the result of @p fxn. If @p future holds an
+ *          exception, @p fxn is not called and the returned future holds
+ *          the exception instead.
+ *
+ *  @throw std::bad_alloc if creating or queuing the task fails. Strong throw
+ *                        guarantee.
+ */
+template<typename T, typename Fxn>
+auto then(std::future<T> future, Fxn&& fxn) {
+    return async([future = std::move(future),
+                  fxn    = std::forward<Fxn>(fxn)]() mutable {
+        if constexpr(std::is_void_v<T>) {
+            get(std::move(future));
+            return fxn();
+        } else {
+            return fxn(get(std::move(future)));
+        }
+    });
+}
+
+} // namespace wtf::parallel
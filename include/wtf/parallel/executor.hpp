@@ -0,0 +1,160 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <utility>
+
+namespace wtf::parallel {
+
+/** @brief The interface WTF uses to run work on other threads.
+ *
+ *  WTF's parallel kernels do not start threads of their own. They hand their
+ *  work to the executor returned by executor(), so kernels running at the
+ *  same time share one set of threads instead of oversubscribing the cores.
+ *  By default that executor is the shared ThreadPool (see
+ *  default_thread_pool()). Applications which already have a scheduler can
+ *  derive from this class and install it with set_executor().
+ *
+ *  Tasks handed to an executor never throw; WTF catches exceptions inside of
+ *  the task and reports them to whoever waits on it.
+ */
+class Executor {
+public:
+    /// Type used for counting threads
+    using size_type = std::size_t;
+
+    /// Type of a unit of work
+    using task_type = std::function<void()>;
+
+    /// Default no-throw virtual destructor
+    virtual ~Executor() noexcept = default;
+
+    /** @brief Arranges for @p task to be run.
+     *
+     *  @param[in] task The work to run. Must not throw.
+     *
+     *  @throw std::bad_alloc if queuing @p task fails. Strong throw
+     *                        guarantee.
+     */
+    void submit(task_type task) { submit_(std::move(task)); }
+
+    /** @brief Arranges for @p task to be run, preferably by thread @p hint.
+     *
+     *  WTF's kernels always hand the i-th piece of a range to the same hint,
+     *  so an executor which maps hints to fixed threads usually keeps each
+     *  piece of a buffer on the same core (and NUMA node) from one kernel to
+     *  the next. Executors are free to ignore the hint, which is what the
+     *  default implementation does.
+     *
+     *  @param[in] task The work to run. Must not throw.
+     *  @param[in] hint Which thread should run @p task. May be larger than
+     *                  concurrency().
+     *
+     *  @throw std::bad_alloc if queuing @p task fails. Strong throw
+     *                        guarantee.
+     */
+    void submit(task_type task, size_type hint) {
+        submit_to_(std::move(task), hint);
+    }
+
+    /** @brief The number of tasks *this can run at the same time.
+     *
+     *  @return The number of threads tasks are run on (at least 1).
+     *
+     *  @throw None No throw guarantee.
+     */
+    size_type concurrency() const noexcept { return concurrency_(); }
+
+    /** @brief Runs one queued task, if any, on the calling thread.
+     *
+     *  Threads which wait on tasks they submitted call this while waiting,
+     *  so that waiting never leaves a thread idle while work is queued (and
+     *  a task which waits on other tasks can not deadlock the executor).
+     *
+     *  @return True if a task was run and false if there was none to run.
+     *
+     *  @throw None No throw guarantee.
+     */
+    bool run_pending_task() noexcept { return run_pending_task_(); }
+
+protected:
+    /// Derived class should implement to queue @p task
+    virtual void submit_(task_type task) = 0;
+
+    /// Derived class may override to honor @p hint, defaults to submit_
+    virtual void submit_to_(task_type task, size_type hint) {
+        static_cast<void>(hint);
+        submit_(std::move(task));
+    }
+
+    /// Derived class should implement to return its number of threads
+    virtual size_type concurrency_() const noexcept = 0;
+
+    /// Derived class may override to run a queued task, defaults to none
+    virtual bool run_pending_task_() noexcept { return false; }
+};
+
+/** @brief An executor which runs each task immediately, on the caller.
+ *
+ *  Installing an InlineExecutor makes every WTF kernel serial, which is
+ *  useful for debugging and for applications which parallelize at a coarser
+ *  level themselves.
+ */
+class InlineExecutor : public Executor {
+protected:
+    /// Runs @p task
+    void submit_(task_type task) override { task(); }
+
+    /// Tasks only ever run on the caller
+    size_type concurrency_() const noexcept override { return 1; }
+};
+
+/** @brief The executor WTF's parallel kernels currently run on.
+ *
+ *  @return The executor installed with set_executor(), or the default
+ *          ThreadPool if none is installed.
+ *
+ *  @throw std::system_error if the default ThreadPool has to be created and
+ *                           its threads can not be started. Strong throw
+ *                           guarantee.
+ */
+std::shared_ptr<Executor> executor();
+
+/** @brief Makes WTF's parallel kernels run on @p pexecutor.
+ *
+ *  Kernels already running finish on the executor they started on.
+ *
+ *  @param[in] pexecutor The executor to use. A null pointer reinstates the
+ *                       default ThreadPool.
+ *
+ *  @throw None No throw guarantee.
+ */
+void set_executor(std::shared_ptr<Executor> pexecutor) noexcept;
+
+/** @brief The number of threads WTF's kernels split work over by default.
+ *
+ *  Unlike executor() this never creates the default ThreadPool.
+ *
+ *  @return The concurrency() of the current executor.
+ *
+ *  @throw None No throw guarantee.
+ */
+std::size_t max_threads() noexcept;
+
+} // namespace wtf::parallel
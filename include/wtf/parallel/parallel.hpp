@@ -0,0 +1,27 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <wtf/parallel/async.hpp>
+#include <wtf/parallel/executor.hpp>
+#include <wtf/parallel/thread_pool.hpp>
+
+/** @brief The thread pool and executors WTF's parallel kernels run on.
+ *
+ *  Every parallel kernel in WTF submits its work to executor(), so kernels
+ *  running concurrently (or started with async()) share one set of threads.
+ */
+namespace wtf::parallel {}
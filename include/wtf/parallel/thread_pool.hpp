@@ -0,0 +1,144 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <wtf/parallel/executor.hpp>
+
+namespace wtf::parallel {
+namespace detail_ {
+class PoolState;
+}
+
+/// Options controlling how a ThreadPool is set up
+struct ThreadPoolOptions {
+    /// Type used for counting threads
+    using size_type = std::size_t;
+
+    /// Number of worker threads, 0 means one per hardware thread
+    size_type n_threads = 0;
+
+    /// Should worker i be pinned to the i-th CPU the process may run on?
+    bool pin_threads = false;
+
+    /// The number of worker threads these options ask for (at least 1)
+    size_type resolved_n_threads() const noexcept;
+
+    /// Are all options the same?
+    bool operator==(const ThreadPoolOptions&) const = default;
+};
+
+/** @brief A fixed set of worker threads which share work by stealing it.
+ *
+ *  Each worker owns a queue of tasks. A worker runs the newest task of its
+ *  own queue first (a task submitted from inside of a task is likely to use
+ *  data which is still in cache) and, once its queue is empty, steals the
+ *  oldest task from another worker's queue. Tasks submitted with a hint go
+ *  to the queue of worker hint % size(); other tasks submitted from outside
+ *  of the pool go to an idle worker if there is one. Together with
+ *  pin_threads this tends to keep the i-th piece of each kernel on the same
+ *  core, while stealing still balances uneven work (and may move a piece).
+ *
+ *  The destructor runs every task still queued before joining the workers.
+ */
+class ThreadPool : public Executor {
+public:
+    /// Type of the options used to set up *this
+    using options_type = ThreadPoolOptions;
+
+    /** @brief Starts the worker threads.
+     *
+     *  @param[in] options How many workers to start and whether to pin them.
+     *
+     *  @throw std::system_error if a thread can not be started. Strong throw
+     *                           guarantee.
+     */
+    explicit ThreadPool(options_type options = {});
+
+    /// Deleted, the workers refer to *this
+    ThreadPool(const ThreadPool&) = delete;
+
+    /// Deleted, the workers refer to *this
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /// Runs the queued tasks, then joins the workers
+    ~ThreadPool() noexcept override;
+
+    /// The number of worker threads. No throw guarantee.
+    size_type size() const noexcept;
+
+    /// Were all workers pinned to a CPU? No throw guarantee.
+    bool is_pinned() const noexcept;
+
+    /// The options *this was set up with. No throw guarantee.
+    const options_type& options() const noexcept;
+
+    /// Is the calling thread one of the workers of *this? No throw guarantee.
+    bool is_worker() const noexcept;
+
+protected:
+    /// Queues @p task with the calling worker, or with an idle worker
+    void submit_(task_type task) override;
+
+    /// Queues @p task with worker @p hint % size()
+    void submit_to_(task_type task, size_type hint) override;
+
+    /// Returns size()
+    size_type concurrency_() const noexcept override;
+
+    /// Pops from the caller's own queue if it is a worker, else steals
+    bool run_pending_task_() noexcept override;
+
+private:
+    /// The queues and threads, shared with the workers
+    std::unique_ptr<detail_::PoolState> m_pstate_;
+};
+
+/** @brief The ThreadPool WTF's kernels run on unless told otherwise.
+ *
+ *  The pool is created the first time it is needed, using the options from
+ *  set_default_thread_pool_options().
+ *
+ *  @return The default pool.
+ *
+ *  @throw std::system_error if the pool has to be created and its threads
+ *                           can not be started. Strong throw guarantee.
+ */
+std::shared_ptr<ThreadPool> default_thread_pool();
+
+/** @brief The options the default ThreadPool is (or will be) created with.
+ *
+ *  @return The current options.
+ *
+ *  @throw None No throw guarantee.
+ */
+ThreadPoolOptions default_thread_pool_options() noexcept;
+
+/** @brief Sets the options used for the default ThreadPool.
+ *
+ *  If the options differ from the current ones, the current default pool is
+ *  released and a new one is created the next time it is needed. Work
+ *  already queued on the old pool still runs. Must not be called from a
+ *  task running on the default pool.
+ *
+ *  @param[in] options The new options.
+ *
+ *  @throw None No throw guarantee.
+ */
+void set_default_thread_pool_options(ThreadPoolOptions options) noexcept;
+
+} // namespace wtf::parallel
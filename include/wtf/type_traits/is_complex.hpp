@@ -0,0 +1,65 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <complex>
+#include <type_traits>
+
+namespace wtf::type_traits {
+
+/** @brief Is @p T a complex floating-point type?
+ *
+ *  @tparam T The type to inspect.
+ *
+ *  The primary template is true for specializations of std::complex and false
+ *  otherwise. Users with their own complex types may specialize this struct.
+ */
+template<typename T>
+struct IsComplex : std::false_type {};
+
+/// Specializes IsComplex for std::complex
+template<typename T>
+struct IsComplex<std::complex<T>> : std::true_type {};
+
+/// Convenience variable template for grabbing `IsComplex<T>::value`
+template<typename T>
+constexpr bool is_complex_v = IsComplex<T>::value;
+
+/** @brief Works out the type of the real (and imaginary) part of @p T.
+ *
+ *  @tparam T The type to inspect.
+ *
+ *  For real types the member `type` is @p T itself. For std::complex<U> it is
+ *  U. Users with their own complex types may specialize this struct.
+ */
+template<typename T>
+struct RealType {
+    /// The type of the real part of a T
+    using type = T;
+};
+
+/// Specializes RealType for std::complex
+template<typename T>
+struct RealType<std::complex<T>> {
+    /// The type of the real part of a std::complex<T>
+    using type = T;
+};
+
+/// Convenience type alias for grabbing `RealType<T>::type`
+template<typename T>
+using real_type_t = typename RealType<T>::type;
+
+} // namespace wtf::type_traits
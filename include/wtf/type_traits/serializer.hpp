@@ -0,0 +1,94 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <cstddef>
+#include <iosfwd>
+#include <type_traits>
+#include <wtf/concepts/modifiers.hpp>
+
+namespace wtf::type_traits {
+
+/** @brief Describes how objects of type @p T are serialized.
+ *
+ *  @tparam T A floating-point type without any type modifiers.
+ *
+ *  The primary template handles trivially copyable types, which are
+ *  serialized by copying their bytes (is_bitwise is true). This is what is
+ *  used for C++'s built-in floating-point types.
+ *
+ *  Types which are not trivially copyable must specialize this template (most
+ *  easily via WTF_REGISTER_FP_SERIALIZER) to be serializable. Specializations
+ *  must set is_bitwise to false and provide:
+ *
+ *  ```cpp
+ *  static void write(std::ostream& os, const T& value);
+ *  static void read(std::istream& is, T& value);
+ *  ```
+ *
+ *  where read must consume exactly the bytes written by write.
+ */
+template<concepts::Unmodified T>
+struct Serializer {
+    /// Can objects of type T be serialized by copying their bytes?
+    static constexpr bool is_bitwise = std::is_trivially_copyable_v<T>;
+};
+
+/** @brief Determines if @p T has a custom serializer.
+ *
+ *  @tparam T The type to inspect.
+ *
+ *  True if Serializer<T> provides the write and read functions needed to
+ *  serialize objects which can not be copied bitwise, false otherwise.
+ */
+template<typename T>
+constexpr bool has_custom_serializer_v =
+  requires(std::ostream& os, std::istream& is, const T& cvalue, T& value) {
+      Serializer<T>::write(os, cvalue);
+      Serializer<T>::read(is, value);
+  };
+
+/** @brief Can objects of type @p T be serialized?
+ *
+ *  @tparam T The type to inspect.
+ *
+ *  True if @p T can be serialized bitwise or has a custom serializer, false
+ *  otherwise.
+ */
+template<typename T>
+constexpr bool is_serializable_v =
+  Serializer<T>::is_bitwise || has_custom_serializer_v<T>;
+
+/** @brief The size of the pieces of @p T whose bytes are in native order.
+ *
+ *  @tparam T The type to inspect.
+ *
+ *  Changing the byte order of a bitwise-serialized @p T reverses the bytes of
+ *  each piece of this size. The primary template treats all of @p T as one
+ *  piece, which is right for scalars. Aggregates of scalars (e.g.,
+ *  std::complex) specialize this struct with the size of one scalar.
+ */
+template<typename T>
+struct WordSize {
+    /// Number of bytes in each piece of a T
+    static constexpr std::size_t value = sizeof(T);
+};
+
+/// Convenience variable template for grabbing `WordSize<T>::value`
+template<typename T>
+constexpr std::size_t word_size_v = WordSize<T>::value;
+
+} // namespace wtf::type_traits
@@ -16,9 +16,11 @@
 
 #pragma once
 #include <wtf/type_traits/float_traits.hpp>
+#include <wtf/type_traits/is_complex.hpp>
 #include <wtf/type_traits/is_convertible.hpp>
 #include <wtf/type_traits/is_floating_point.hpp>
 #include <wtf/type_traits/precision.hpp>
+#include <wtf/type_traits/serializer.hpp>
 #include <wtf/type_traits/tuple_append.hpp>
 #include <wtf/type_traits/type_name.hpp>
 
@@ -44,5 +46,35 @@
     };                                             \
     } // namespace wtf::type_traits
 
+/** @brief Macro for registering how a custom @p T is serialized.
+ *
+ *  Types which are trivially copyable are serialized by copying their bytes
+ *  and do not need this macro. Other types (e.g., types holding pointers)
+ *  must use this macro, after WTF_REGISTER_FP_TYPE, to be serializable.
+ *
+ *  @param[in] T The unqualified type being registered.
+ *  @param[in] write_fxn A callable with the signature
+ *                       `void(std::ostream&, const T&)` which writes a T.
+ *  @param[in] read_fxn A callable with the signature
+ *                      `void(std::istream&, T&)` which reads back a T
+ *                      written by @p write_fxn.
+ *
+ *  @note This macro should be used in the global namespace.
+ *  @note This macro should be used only once per type.
+ */
+#define WTF_REGISTER_FP_SERIALIZER(T, write_fxn, read_fxn)        \
+    namespace wtf::type_traits {                                  \
+    template<>                                                    \
+    struct Serializer<T> {                                        \
+        static constexpr bool is_bitwise = false;                 \
+        static void write(std::ostream& os, const T& value) {     \
+            write_fxn(os, value);                                 \
+        }                                                         \
+        static void read(std::istream& is, T& value) {            \
+            read_fxn(is, value);                                  \
+        }                                                         \
+    };                                                            \
+    } // namespace wtf::type_traits
+
 /// @brief Namespace for type traits provided by WTF.
 namespace wtf::type_traits {}
@@ -15,10 +15,29 @@
  */
 
 #pragma once
+#include <complex>
 #include <tuple>
+#include <wtf/fp/bfloat16.hpp>
+#include <wtf/fp/complex.hpp>
+#include <wtf/fp/float128.hpp>
+#include <wtf/fp/half.hpp>
 
 namespace wtf {
 
 /// A tuple holding C++'s default, real, floating-point types
 using default_fp_types = std::tuple<float, double, long double>;
+
+/// default_fp_types plus __float128 when the compiler supports it
+#ifdef WTF_HAS_FLOAT128
+using extended_fp_types = std::tuple<float, double, long double, __float128>;
+#else
+using extended_fp_types = default_fp_types;
+#endif
+
+/// A tuple holding the std::complex types of default_fp_types
+using complex_fp_types = std::tuple<std::complex<float>, std::complex<double>,
+                                    std::complex<long double>>;
+
+/// A tuple holding the 16-bit floating-point types WTF provides
+using narrow_fp_types = std::tuple<fp::Half, fp::BFloat16>;
 } // namespace wtf
@@ -17,7 +17,10 @@
 #pragma once
 #include <wtf/buffer/buffer.hpp>
 #include <wtf/concepts/concepts.hpp>
+#include <wtf/expr/expr.hpp>
 #include <wtf/fp/fp.hpp>
+#include <wtf/io/io.hpp>
+#include <wtf/parallel/parallel.hpp>
 #include <wtf/rtti/rtti.hpp>
 #include <wtf/type_traits/type_traits.hpp>
 #include <wtf/types.hpp>
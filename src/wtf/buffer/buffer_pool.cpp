@@ -0,0 +1,184 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <algorithm>
+#include <bit>
+#include <map>
+#include <mutex>
+#include <utility>
+#include <wtf/buffer/buffer_pool.hpp>
+
+namespace wtf::buffer {
+namespace detail_ {
+
+/** @brief Implements BufferPool.
+ *
+ *  Retained buffers live in one stack per (type, size class). Stacks keep
+ *  their capacity, so once every key has been seen pushing and popping does
+ *  not allocate. A single mutex guards everything; it is only held while
+ *  moving buffers in and out of the stacks, never while freeing memory.
+ */
+class PoolState {
+public:
+    using size_type = BufferPool::size_type;
+
+    /// Identifies a stack of buffers
+    using key_type = std::pair<std::type_index, size_type>;
+
+    /// A retained buffer and its size in bytes
+    struct Entry {
+        FloatBuffer buffer;
+        size_type nbytes;
+    };
+
+    explicit PoolState(BufferPoolOptions options) : m_options_(options) {}
+
+    FloatBuffer pop(std::type_index type, size_type size_class) {
+        std::scoped_lock lock(m_mutex_);
+        ++m_stats_.acquires;
+        auto it = m_stacks_.find(key_type(type, size_class));
+        if(it == m_stacks_.end() || it->second.empty()) return FloatBuffer{};
+
+        auto entry = std::move(it->second.back());
+        it->second.pop_back();
+        ++m_stats_.hits;
+        --m_stats_.buffers_retained;
+        m_stats_.bytes_retained -= entry.nbytes;
+        return std::move(entry.buffer);
+    }
+
+    /// Returns @p buffer if it could not be retained, so it is freed unlocked
+    FloatBuffer push(std::type_index type, size_type size_class,
+                     size_type nbytes, FloatBuffer&& buffer) {
+        std::scoped_lock lock(m_mutex_);
+        const auto limit = m_options_.max_retained_bytes;
+        if(nbytes > limit || m_stats_.bytes_retained > limit - nbytes) {
+            ++m_stats_.discards;
+            return std::move(buffer);
+        }
+        auto& stack = m_stacks_[key_type(type, size_class)];
+        stack.push_back(Entry{std::move(buffer), nbytes});
+        ++m_stats_.releases;
+        ++m_stats_.buffers_retained;
+        m_stats_.bytes_retained += nbytes;
+        return FloatBuffer{};
+    }
+
+    void count_discard() noexcept {
+        std::scoped_lock lock(m_mutex_);
+        ++m_stats_.discards;
+    }
+
+    /// Moves buffers into @p freed until at most @p max_bytes are retained
+    void trim(size_type max_bytes, std::vector<Entry>& freed) {
+        std::scoped_lock lock(m_mutex_);
+        // Stacks are sorted by type, then class; visit the classes largest
+        // first regardless of type
+        std::vector<std::pair<size_type, std::vector<Entry>*>> order;
+        order.reserve(m_stacks_.size());
+        freed.reserve(m_stats_.buffers_retained);
+        for(auto& [key, stack] : m_stacks_)
+            order.emplace_back(key.second, &stack);
+        auto by_class = [](const auto& a, const auto& b) {
+            return a.first > b.first;
+        };
+        std::sort(order.begin(), order.end(), by_class);
+
+        for(auto& [size_class, pstack] : order) {
+            while(m_stats_.bytes_retained > max_bytes && !pstack->empty()) {
+                freed.push_back(std::move(pstack->back()));
+                pstack->pop_back();
+                ++m_stats_.discards;
+                --m_stats_.buffers_retained;
+                m_stats_.bytes_retained -= freed.back().nbytes;
+            }
+        }
+    }
+
+    BufferPoolStats stats() const noexcept {
+        std::scoped_lock lock(m_mutex_);
+        return m_stats_;
+    }
+
+private:
+    /// What the pool may retain
+    BufferPoolOptions m_options_;
+
+    /// The retained buffers
+    std::map<key_type, std::vector<Entry>> m_stacks_;
+
+    /// The counters
+    BufferPoolStats m_stats_;
+
+    /// Guards the stacks and counters
+    mutable std::mutex m_mutex_;
+};
+
+} // namespace detail_
+
+BufferPool::BufferPool(options_type options) :
+  m_pstate_(std::make_unique<detail_::PoolState>(options)) {}
+
+BufferPool::BufferPool(BufferPool&& other) noexcept = default;
+
+BufferPool& BufferPool::operator=(BufferPool&& other) noexcept = default;
+
+BufferPool::~BufferPool() noexcept = default;
+
+// A moved-from pool has no state and retains nothing
+
+void BufferPool::trim(size_type max_bytes) {
+    if(!m_pstate_) return;
+    // Declared first, so the buffers are freed after the lock is released
+    std::vector<detail_::PoolState::Entry> freed;
+    m_pstate_->trim(max_bytes, freed);
+}
+
+BufferPoolStats BufferPool::stats() const noexcept {
+    return m_pstate_ ? m_pstate_->stats() : BufferPoolStats{};
+}
+
+BufferPool::size_type BufferPool::request_class(size_type n) noexcept {
+    return static_cast<size_type>(std::bit_width(n - 1));
+}
+
+BufferPool::size_type BufferPool::capacity_class(size_type capacity) noexcept {
+    return static_cast<size_type>(std::bit_width(capacity)) - 1;
+}
+
+FloatBuffer BufferPool::pop_(std::type_index type, size_type size_class) {
+    if(!m_pstate_) return FloatBuffer{};
+    return m_pstate_->pop(type, size_class);
+}
+
+void BufferPool::push_(std::type_index type, size_type size_class,
+                       size_type nbytes, FloatBuffer&& buffer) {
+    if(!m_pstate_) {
+        discard_(std::move(buffer));
+        return;
+    }
+    // A buffer which is handed back is freed here, after the lock is released
+    auto rejected = m_pstate_->push(type, size_class, nbytes,
+                                    std::move(buffer));
+}
+
+void BufferPool::discard_(FloatBuffer&& buffer) noexcept {
+    FloatBuffer temp(std::move(buffer));
+    if(m_pstate_) m_pstate_->count_discard();
+}
+
+} // namespace wtf::buffer
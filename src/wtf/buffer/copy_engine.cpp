@@ -0,0 +1,173 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <unistd.h>
+#include <wtf/buffer/copy_engine.hpp>
+#include <wtf/detail_/parallel_for.hpp>
+#include <wtf/parallel/executor.hpp>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+namespace wtf::buffer {
+namespace {
+
+/// The size of the last level cache in bytes, or 0 if unknown
+std::size_t llc_size_() noexcept {
+    long rv = 0;
+#ifdef _SC_LEVEL3_CACHE_SIZE
+    rv = ::sysconf(_SC_LEVEL3_CACHE_SIZE);
+#endif
+#ifdef _SC_LEVEL2_CACHE_SIZE
+    if(rv <= 0) rv = ::sysconf(_SC_LEVEL2_CACHE_SIZE);
+#endif
+    return rv > 0 ? static_cast<std::size_t>(rv) : 0;
+}
+
+/// Process-wide options, each member is read and written independently
+struct AtomicCopyOptions {
+    explicit AtomicCopyOptions(const CopyOptions& options) :
+      parallel_threshold(options.parallel_threshold),
+      streaming_threshold(options.streaming_threshold),
+      min_bytes_per_thread(options.min_bytes_per_thread),
+      max_threads(options.max_threads) {}
+
+    std::atomic<std::size_t> parallel_threshold;
+    std::atomic<std::size_t> streaming_threshold;
+    std::atomic<std::size_t> min_bytes_per_thread;
+    std::atomic<std::size_t> max_threads;
+};
+
+AtomicCopyOptions& options_() {
+    static AtomicCopyOptions options(default_copy_options());
+    return options;
+}
+
+/// Copies with non-temporal stores, then fences so the stores are visible
+void stream_copy_(std::byte* dst, const std::byte* src, std::size_t n) {
+#ifdef __SSE2__
+    // Non-temporal stores must be 16 byte aligned, the loads need not be
+    const auto misalign = reinterpret_cast<std::uintptr_t>(dst) % 16;
+    const auto head     = misalign == 0 ? 0 : std::min(n, 16 - misalign);
+    std::memcpy(dst, src, head);
+
+    std::size_t i = head;
+    for(; i + 64 <= n; i += 64) {
+        for(std::size_t j = 0; j < 64; j += 16) {
+            auto* pin  = reinterpret_cast<const __m128i*>(src + i + j);
+            auto* pout = reinterpret_cast<__m128i*>(dst + i + j);
+            _mm_stream_si128(pout, _mm_loadu_si128(pin));
+        }
+    }
+    for(; i + 16 <= n; i += 16) {
+        auto* pin  = reinterpret_cast<const __m128i*>(src + i);
+        auto* pout = reinterpret_cast<__m128i*>(dst + i);
+        _mm_stream_si128(pout, _mm_loadu_si128(pin));
+    }
+    std::memcpy(dst + i, src + i, n - i);
+    _mm_sfence();
+#else
+    std::memcpy(dst, src, n);
+#endif
+}
+
+} // namespace
+
+CopyOptions default_copy_options() noexcept {
+    CopyOptions rv;
+    rv.streaming_threshold = std::max(rv.streaming_threshold, llc_size_());
+    return rv;
+}
+
+CopyOptions copy_options() noexcept {
+    const auto& options  = options_();
+    constexpr auto order = std::memory_order_relaxed;
+    CopyOptions rv;
+    rv.parallel_threshold   = options.parallel_threshold.load(order);
+    rv.streaming_threshold  = options.streaming_threshold.load(order);
+    rv.min_bytes_per_thread = options.min_bytes_per_thread.load(order);
+    rv.max_threads          = options.max_threads.load(order);
+    return rv;
+}
+
+void set_copy_options(const CopyOptions& new_options) noexcept {
+    auto& options        = options_();
+    constexpr auto order = std::memory_order_relaxed;
+    options.parallel_threshold.store(new_options.parallel_threshold, order);
+    options.streaming_threshold.store(new_options.streaming_threshold, order);
+    options.min_bytes_per_thread.store(new_options.min_bytes_per_thread,
+                                       order);
+    options.max_threads.store(new_options.max_threads, order);
+}
+
+std::size_t copy_threads(std::size_t n_bytes) noexcept {
+    const auto& options  = options_();
+    auto max_threads     = options.max_threads.load(std::memory_order_relaxed);
+    const auto per_chunk = std::max<std::size_t>(
+      options.min_bytes_per_thread.load(std::memory_order_relaxed), 1);
+    if(max_threads == 0) max_threads = parallel::max_threads();
+    return std::clamp<std::size_t>(n_bytes / per_chunk, 1,
+                                   std::max<std::size_t>(max_threads, 1));
+}
+
+CopyStrategy copy_strategy(std::size_t n_bytes) noexcept {
+    const auto options = copy_options();
+    const auto big     = std::min(options.parallel_threshold,
+                                  options.streaming_threshold);
+    // A single thread gains nothing over std::memcpy
+    if(n_bytes < big || copy_threads(n_bytes) == 1) {
+        return CopyStrategy::serial;
+    }
+#ifdef __SSE2__
+    if(n_bytes >= options.streaming_threshold) return CopyStrategy::streaming;
+#endif
+    return CopyStrategy::parallel;
+}
+
+void copy_bytes(void* dst, const void* src, std::size_t n_bytes) noexcept {
+    if(n_bytes == 0 || dst == src) return;
+    auto* pout      = static_cast<std::byte*>(dst);
+    const auto* pin = static_cast<const std::byte*>(src);
+
+    const auto strategy = copy_strategy(n_bytes);
+    if(strategy == CopyStrategy::serial) {
+        std::memcpy(pout, pin, n_bytes);
+        return;
+    }
+
+    const bool stream = strategy == CopyStrategy::streaming;
+    auto chunk        = [=](std::size_t begin, std::size_t end) {
+        if(stream)
+            stream_copy_(pout + begin, pin + begin, end - begin);
+        else
+            std::memcpy(pout + begin, pin + begin, end - begin);
+    };
+    try {
+        wtf::detail_::parallel_for(n_bytes, copy_threads(n_bytes), chunk);
+    } catch(...) {
+        // E.g., the default ThreadPool could not be created (system_error or
+        // bad_alloc). Some chunks may be done, but copying them again is
+        // harmless.
+        std::memcpy(pout, pin, n_bytes);
+    }
+}
+
+} // namespace wtf::buffer
@@ -0,0 +1,165 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <stdexcept>
+#include <wtf/buffer/detail_/block_codec.hpp>
+
+namespace wtf::buffer::detail_ {
+namespace {
+
+/// First byte of a block, records how the rest of the block is stored
+enum class Format : unsigned char { raw = 0, shuffled_rle = 1 };
+
+/// Control bytes with this bit set introduce a run, otherwise literals
+constexpr unsigned run_bit = 0x80;
+
+/// Shortest run worth encoding as a run
+constexpr std::size_t min_run = 3;
+
+/// Longest run a control byte can describe
+constexpr std::size_t max_run = min_run + 127;
+
+/// Most literal bytes a control byte can describe
+constexpr std::size_t max_literals = 128;
+
+/// Throws if @p element_size can not describe @p n bytes
+void check_element_size(std::size_t n, std::size_t element_size) {
+    if(element_size == 0 || n % element_size != 0) {
+        throw std::invalid_argument(
+          "Element size must be non-zero and divide the block size");
+    }
+}
+
+/// Throws because a compressed block is corrupt
+[[noreturn]] void throw_corrupt() {
+    throw std::runtime_error("Compressed block is corrupt");
+}
+
+/// Length of the run of equal bytes starting at @p first (capped at max_run)
+std::size_t run_length(std::span<const std::byte> bytes, std::size_t first) {
+    const auto end = std::min(bytes.size(), first + max_run);
+    auto i         = first + 1;
+    while(i < end && bytes[i] == bytes[first]) ++i;
+    return i - first;
+}
+
+/// Appends the RLE encoding of @p bytes to @p out
+void rle_encode(std::span<const std::byte> bytes, byte_vector& out) {
+    std::size_t i = 0;
+    while(i < bytes.size()) {
+        const auto run = run_length(bytes, i);
+        if(run >= min_run) {
+            out.push_back(static_cast<std::byte>(run_bit | (run - min_run)));
+            out.push_back(bytes[i]);
+            i += run;
+            continue;
+        }
+
+        // Gather literals until the next run worth encoding starts
+        auto end = i + run;
+        while(end < bytes.size() && end - i < max_literals &&
+              run_length(bytes, end) < min_run)
+            ++end;
+        end = std::min(end, i + max_literals);
+        out.push_back(static_cast<std::byte>(end - i - 1));
+        out.insert(out.end(), bytes.begin() + i, bytes.begin() + end);
+        i = end;
+    }
+}
+
+/// Decodes @p packed, which must expand to exactly out.size() bytes
+void rle_decode(std::span<const std::byte> packed, std::span<std::byte> out) {
+    std::size_t i = 0, o = 0;
+    while(i < packed.size()) {
+        const auto control = std::to_integer<unsigned>(packed[i++]);
+        if(control & run_bit) {
+            const auto n = (control & ~run_bit) + min_run;
+            if(i >= packed.size() || n > out.size() - o) throw_corrupt();
+            std::fill_n(out.begin() + o, n, packed[i++]);
+            o += n;
+        } else {
+            const auto n = control + 1;
+            if(n > packed.size() - i || n > out.size() - o) throw_corrupt();
+            std::copy_n(packed.begin() + i, n, out.begin() + o);
+            i += n;
+            o += n;
+        }
+    }
+    if(o != out.size()) throw_corrupt();
+}
+
+} // namespace
+
+byte_vector compress_block(std::span<const std::byte> raw,
+                           std::size_t element_size) {
+    check_element_size(raw.size(), element_size);
+    const auto n = raw.size() / element_size;
+
+    // Delta + shuffle in one pass: plane k holds byte k of each delta
+    byte_vector shuffled(raw.size());
+    for(std::size_t k = 0; k < element_size; ++k) {
+        auto* plane     = shuffled.data() + k * n;
+        std::byte prior = {};
+        for(std::size_t i = 0; i < n; ++i) {
+            const auto value = raw[i * element_size + k];
+            plane[i]         = value ^ prior;
+            prior            = value;
+        }
+    }
+
+    byte_vector packed{static_cast<std::byte>(Format::shuffled_rle)};
+    packed.reserve(raw.size() + 1);
+    rle_encode(shuffled, packed);
+    if(packed.size() <= raw.size()) {
+        packed.shrink_to_fit();
+        return packed;
+    }
+
+    byte_vector stored{static_cast<std::byte>(Format::raw)};
+    stored.insert(stored.end(), raw.begin(), raw.end());
+    return stored;
+}
+
+void decompress_block(std::span<const std::byte> packed,
+                      std::span<std::byte> raw, std::size_t element_size) {
+    check_element_size(raw.size(), element_size);
+    if(packed.empty()) throw_corrupt();
+    const auto format = static_cast<Format>(packed[0]);
+    const auto body   = packed.subspan(1);
+
+    if(format == Format::raw) {
+        if(body.size() != raw.size()) throw_corrupt();
+        std::copy(body.begin(), body.end(), raw.begin());
+        return;
+    }
+    if(format != Format::shuffled_rle) throw_corrupt();
+
+    byte_vector shuffled(raw.size());
+    rle_decode(body, shuffled);
+
+    const auto n = raw.size() / element_size;
+    for(std::size_t k = 0; k < element_size; ++k) {
+        const auto* plane = shuffled.data() + k * n;
+        std::byte prior   = {};
+        for(std::size_t i = 0; i < n; ++i) {
+            prior                      = plane[i] ^ prior;
+            raw[i * element_size + k] = prior;
+        }
+    }
+}
+
+} // namespace wtf::buffer::detail_
@@ -0,0 +1,46 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <wtf/buffer/mapped_buffer.hpp>
+
+namespace wtf::buffer {
+namespace {
+
+/// Cross-casts the holder of @p buffer to MappedStorage, throwing if it fails
+detail_::MappedStorage& mapped_storage(FloatBuffer::holder_type* pholder) {
+    auto* pstorage = dynamic_cast<detail_::MappedStorage*>(pholder);
+    if(pstorage == nullptr) {
+        throw std::runtime_error("FloatBuffer is not memory mapped");
+    }
+    return *pstorage;
+}
+
+} // namespace
+
+bool is_mapped(const FloatBuffer& buffer) noexcept {
+    const auto* pholder = buffer.m_pholder_.get();
+    return dynamic_cast<const detail_::MappedStorage*>(pholder) != nullptr;
+}
+
+void flush(FloatBuffer& buffer) {
+    mapped_storage(buffer.m_pholder_.get()).memory_map().flush();
+}
+
+void advise(FloatBuffer& buffer, io::MemoryMap::Advice advice) {
+    mapped_storage(buffer.m_pholder_.get()).memory_map().advise(advice);
+}
+
+} // namespace wtf::buffer
@@ -0,0 +1,233 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <cerrno>
+#include <cstdint>
+#include <exception>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <sys/syscall.h>
+#include <sys/mman.h>
+#include <system_error>
+#include <unistd.h>
+#include <utility>
+#include <vector>
+#include <wtf/buffer/page_allocation.hpp>
+
+namespace wtf::buffer {
+namespace {
+
+using size_type = PageAllocation::size_type;
+using PageSize  = PageAllocation::PageSize;
+
+/// Size of a 2 MiB page, also the alignment used for transparent huge pages
+constexpr size_type bytes_2mb = size_type{1} << 21;
+
+/// Size of a 1 GiB page
+constexpr size_type bytes_1gb = size_type{1} << 30;
+
+/// The OS's (normal) page size
+size_type os_page_size() {
+    static const auto size = static_cast<size_type>(::sysconf(_SC_PAGESIZE));
+    return size;
+}
+
+/// Rounds @p n up to a multiple of @p alignment (a power of 2)
+size_type round_up(size_type n, size_type alignment) {
+    return (n + alignment - 1) & ~(alignment - 1);
+}
+
+/// Writes to one byte of every page, so the OS allocates them all now
+void touch_pages(std::byte* p, size_type length) {
+#ifdef MADV_POPULATE_WRITE
+    if(::madvise(p, length, MADV_POPULATE_WRITE) == 0) return;
+#endif
+    // The memory is zero already, so writing zeros changes nothing
+    auto* q = static_cast<volatile std::byte*>(p);
+    for(size_type i = 0; i < length; i += os_page_size()) q[i] = std::byte{0};
+}
+
+/// Maps @p length bytes of explicit huge pages, 2^@p log2 bytes each
+void* map_hugetlb(size_type length, [[maybe_unused]] int log2) {
+#ifdef MAP_HUGETLB
+    int flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB;
+#ifdef MAP_HUGE_SHIFT
+    flags |= log2 << MAP_HUGE_SHIFT;
+#endif
+    // Huge pages are reserved by mmap, so failure shows up here, not later
+    void* p = ::mmap(nullptr, length, PROT_READ | PROT_WRITE, flags, -1, 0);
+    return p == MAP_FAILED ? nullptr : p;
+#else
+    return nullptr;
+#endif
+}
+
+/// Maps @p length bytes, aligned to 2 MiB, and asks for huge pages
+void* map_transparent(size_type length, bool& is_huge) {
+    const auto padded = length + bytes_2mb;
+    void* p = ::mmap(nullptr, padded, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if(p == MAP_FAILED) return nullptr;
+
+    // Give back the unaligned head and the unused tail
+    auto* begin      = static_cast<std::byte*>(p);
+    const auto first = reinterpret_cast<std::uintptr_t>(begin);
+    const auto head  = round_up(first, bytes_2mb) - first;
+    if(head > 0) ::munmap(begin, head);
+    ::munmap(begin + head + length, bytes_2mb - head);
+    begin += head;
+
+    is_huge = false;
+#ifdef MADV_HUGEPAGE
+    is_huge = ::madvise(begin, length, MADV_HUGEPAGE) == 0;
+#endif
+    return begin;
+}
+
+/// Parses the NUMA nodes listed in @p list (e.g., "0-1,4") into a bit mask
+std::vector<unsigned long> parse_node_list(const std::string& list) {
+    constexpr std::size_t bits = 8 * sizeof(unsigned long);
+    std::vector<unsigned long> mask;
+    std::istringstream is(list);
+    std::string range;
+    while(std::getline(is, range, ',')) {
+        if(range.empty() || range == "\n") continue;
+        const auto dash  = range.find('-');
+        const auto first = std::stoul(range.substr(0, dash));
+        const auto last  = dash == std::string::npos ?
+                             first :
+                             std::stoul(range.substr(dash + 1));
+        for(auto node = first; node <= last; ++node) {
+            if(mask.size() <= node / bits) mask.resize(node / bits + 1, 0);
+            mask[node / bits] |= 1UL << (node % bits);
+        }
+    }
+    return mask;
+}
+
+/// Asks the OS to place the pages of [@p p, @p p + @p length) round-robin
+bool interleave_pages([[maybe_unused]] void* p,
+                      [[maybe_unused]] size_type length) {
+#if defined(__linux__) && defined(SYS_mbind)
+    std::ifstream file("/sys/devices/system/node/online");
+    std::string list;
+    if(!std::getline(file, list)) return false;
+
+    std::vector<unsigned long> mask;
+    try {
+        mask = parse_node_list(list);
+    } catch(const std::exception&) { return false; }
+    if(mask.empty()) return false;
+
+    // The raw syscall avoids depending on libnuma; 3 is MPOL_INTERLEAVE, and
+    // maxnode is one more than the number of bits, as libnuma passes it
+    constexpr long mpol_interleave = 3;
+    const auto maxnode = mask.size() * 8 * sizeof(unsigned long) + 1;
+    return ::syscall(SYS_mbind, p, length, mpol_interleave, mask.data(),
+                     maxnode, 0) == 0;
+#else
+    return false;
+#endif
+}
+
+} // namespace
+
+PageAllocation::PageAllocation(size_type size, Options options) {
+    if(size == 0) return;
+    const auto want = options.page_size;
+
+    void* p = nullptr;
+    if(want == PageSize::huge_1gb) {
+        m_length_    = round_up(size, bytes_1gb);
+        p            = map_hugetlb(m_length_, 30);
+        m_page_size_ = PageSize::huge_1gb;
+    }
+    if(p == nullptr && want >= PageSize::huge_2mb) {
+        m_length_    = round_up(size, bytes_2mb);
+        p            = map_hugetlb(m_length_, 21);
+        m_page_size_ = PageSize::huge_2mb;
+    }
+    if(p == nullptr && want >= PageSize::transparent_huge &&
+       size >= bytes_2mb) {
+        bool is_huge = false;
+        m_length_    = round_up(size, bytes_2mb);
+        p            = map_transparent(m_length_, is_huge);
+        m_page_size_ = is_huge ? PageSize::transparent_huge : PageSize::normal;
+    }
+    if(p == nullptr) {
+        const int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+        m_length_       = round_up(size, os_page_size());
+        m_page_size_    = PageSize::normal;
+        p = ::mmap(nullptr, m_length_, PROT_READ | PROT_WRITE, flags, -1, 0);
+        if(p == MAP_FAILED) {
+            m_length_ = 0;
+            throw std::system_error(errno, std::generic_category(),
+                                    "PageAllocation: could not map memory");
+        }
+    }
+
+    m_pdata_ = static_cast<pointer>(p);
+    m_size_  = size;
+
+    // Nothing has been touched yet, so placement applies to every page
+    if(options.interleave) m_is_interleaved_ = interleave_pages(p, m_length_);
+    if(options.populate) touch_pages(m_pdata_, m_length_);
+    if(options.lock) lock();
+}
+
+bool PageAllocation::lock() noexcept {
+    if(m_pdata_ != nullptr && !m_is_locked_)
+        m_is_locked_ = ::mlock(m_pdata_, m_length_) == 0;
+    return m_is_locked_;
+}
+
+PageAllocation::PageAllocation(PageAllocation&& other) noexcept :
+  m_pdata_(std::exchange(other.m_pdata_, nullptr)),
+  m_size_(std::exchange(other.m_size_, 0)),
+  m_length_(std::exchange(other.m_length_, 0)),
+  m_page_size_(std::exchange(other.m_page_size_, PageSize::normal)),
+  m_is_locked_(std::exchange(other.m_is_locked_, false)),
+  m_is_interleaved_(std::exchange(other.m_is_interleaved_, false)) {}
+
+PageAllocation& PageAllocation::operator=(PageAllocation&& other) noexcept {
+    if(this != &other) {
+        unmap_();
+        m_pdata_          = std::exchange(other.m_pdata_, nullptr);
+        m_size_           = std::exchange(other.m_size_, 0);
+        m_length_         = std::exchange(other.m_length_, 0);
+        m_page_size_      = std::exchange(other.m_page_size_, PageSize::normal);
+        m_is_locked_      = std::exchange(other.m_is_locked_, false);
+        m_is_interleaved_ = std::exchange(other.m_is_interleaved_, false);
+    }
+    return *this;
+}
+
+PageAllocation::~PageAllocation() noexcept { unmap_(); }
+
+void PageAllocation::unmap_() noexcept {
+    // Unmapping also unlocks the memory
+    if(m_pdata_ != nullptr) ::munmap(m_pdata_, m_length_);
+    m_pdata_          = nullptr;
+    m_size_           = 0;
+    m_length_         = 0;
+    m_page_size_      = PageSize::normal;
+    m_is_locked_      = false;
+    m_is_interleaved_ = false;
+}
+
+} // namespace wtf::buffer
@@ -0,0 +1,37 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <stdexcept>
+#include <wtf/buffer/paged_buffer.hpp>
+
+namespace wtf::buffer {
+
+bool is_paged(const FloatBuffer& buffer) noexcept {
+    const auto* pholder = buffer.m_pholder_.get();
+    return dynamic_cast<const detail_::PagedStorage*>(pholder) != nullptr;
+}
+
+const PageAllocation& page_allocation(const FloatBuffer& buffer) {
+    const auto* pholder  = buffer.m_pholder_.get();
+    const auto* pstorage = dynamic_cast<const detail_::PagedStorage*>(pholder);
+    if(pstorage == nullptr) {
+        throw std::runtime_error("FloatBuffer is not paged");
+    }
+    return pstorage->page_allocation();
+}
+
+} // namespace wtf::buffer
@@ -0,0 +1,126 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
+#include <wtf/buffer/statistics.hpp>
+
+namespace wtf::buffer {
+namespace {
+
+/// Number of values whose bins are worked out at a time
+constexpr std::size_t slot_block_size = 1024;
+
+} // namespace
+
+void Statistics::add(double x) noexcept {
+    if(std::isnan(x)) {
+        ++nan_count;
+    } else if(std::isinf(x)) {
+        ++inf_count;
+    } else {
+        ++count;
+        const auto delta = x - mean;
+        mean += delta / static_cast<double>(count);
+        m2 += delta * (x - mean);
+        min = std::min(min, x);
+        max = std::max(max, x);
+    }
+}
+
+Statistics& Statistics::merge(const Statistics& other) noexcept {
+    nan_count += other.nan_count;
+    inf_count += other.inf_count;
+    if(other.count == 0) return *this;
+    if(count == 0) {
+        count = other.count;
+        mean  = other.mean;
+        m2    = other.m2;
+        min   = other.min;
+        max   = other.max;
+        return *this;
+    }
+
+    const auto n_a   = static_cast<double>(count);
+    const auto n_b   = static_cast<double>(other.count);
+    const auto n     = n_a + n_b;
+    const auto delta = other.mean - mean;
+    mean += delta * (n_b / n);
+    m2 += other.m2 + delta * delta * (n_a * n_b / n);
+    count += other.count;
+    min = std::min(min, other.min);
+    max = std::max(max, other.max);
+    return *this;
+}
+
+Histogram::Histogram(double lower, double upper, size_type n_bins) :
+  m_lower_(lower), m_upper_(upper) {
+    if(n_bins == 0 || n_bins > max_bins) {
+        throw std::invalid_argument(
+          "Histogram: number of bins must be in [1, max_bins]");
+    }
+    m_scale_ = static_cast<double>(n_bins) / (upper - lower);
+    if(!std::isfinite(lower) || !std::isfinite(upper) || !(lower < upper) ||
+       !std::isfinite(m_scale_)) {
+        throw std::invalid_argument(
+          "Histogram: range must be finite and non-empty");
+    }
+    m_counts_.assign(n_bins + 3, 0);
+}
+
+Histogram::size_type Histogram::size() const noexcept {
+    return std::accumulate(m_counts_.begin(), m_counts_.end(), size_type{0});
+}
+
+void Histogram::add(double x) noexcept { add(std::span(&x, 1)); }
+
+void Histogram::add(std::span<const double> values) noexcept {
+    const auto last     = static_cast<double>(n_bins());
+    const auto overflow = last + 1.0;
+    const auto nan      = last + 2.0;
+    std::array<std::int32_t, slot_block_size> slots;
+    for(std::size_t i = 0; i < values.size(); i += slot_block_size) {
+        const auto n  = std::min(slot_block_size, values.size() - i);
+        const auto* x = values.data() + i;
+        // Slot 0 is underflow; NaN ends up there before its own select
+        for(std::size_t j = 0; j < n; ++j) {
+            auto t   = (x[j] - m_lower_) * m_scale_ + 1.0;
+            t        = t > 0.0 ? t : 0.0;
+            t        = std::min(t, last);
+            t        = x[j] >= m_upper_ ? overflow : t;
+            t        = x[j] != x[j] ? nan : t;
+            slots[j] = static_cast<std::int32_t>(t);
+        }
+        for(std::size_t j = 0; j < n; ++j) ++m_counts_[slots[j]];
+    }
+}
+
+Histogram& Histogram::merge(const Histogram& other) {
+    if(m_lower_ != other.m_lower_ || m_upper_ != other.m_upper_ ||
+       m_counts_.size() != other.m_counts_.size()) {
+        throw std::invalid_argument("Histogram: binnings differ");
+    }
+    for(std::size_t i = 0; i < m_counts_.size(); ++i)
+        m_counts_[i] += other.m_counts_[i];
+    return *this;
+}
+
+} // namespace wtf::buffer
@@ -0,0 +1,205 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <wtf/expr/detail_/graph_plan.hpp>
+
+namespace wtf::expr::detail_ {
+namespace {
+
+/// Marks nodes which are not kernels
+constexpr auto no_kernel = std::numeric_limits<std::size_t>::max();
+
+/// Is @p op a leaf of the graph?
+bool is_leaf(OpCode op) noexcept {
+    return op == OpCode::input || op == OpCode::scalar;
+}
+
+/// Does @p op take two operands?
+bool is_binary(OpCode op) noexcept {
+    return !is_leaf(op) && op != OpCode::negate;
+}
+
+/** @brief Builds the instructions of one kernel.
+ *
+ *  Temporaries are handed out from a free list. An instruction's operands are
+ *  dead once it has run, so their temporaries can hold its result.
+ */
+class KernelBuilder {
+public:
+    KernelBuilder(std::span<const GraphNode> nodes,
+                  const std::vector<std::size_t>& kernel_of, Kernel& kernel) :
+      m_nodes_(nodes), m_kernel_of_(kernel_of), m_kernel_(kernel) {}
+
+    /// Emits the instructions computing @p root
+    void build(std::size_t root) {
+        const auto& node = m_nodes_[root];
+        if(is_leaf(node.op)) {
+            m_kernel_.instructions.push_back({node.op, leaf_(node), {}, 0});
+        } else {
+            emit_(root);
+        }
+    }
+
+private:
+    /// Returns the argument for reading leaf @p node
+    static Argument leaf_(const GraphNode& node) noexcept {
+        const auto kind = node.op == OpCode::input ? Argument::Kind::input :
+                                                     Argument::Kind::scalar;
+        return {kind, node.lhs};
+    }
+
+    /// Returns the argument for reading operand @p i, emitting code if needed
+    Argument operand_(std::size_t i) {
+        const auto& node = m_nodes_[i];
+        if(m_kernel_of_[i] != no_kernel) {
+            m_kernel_.dependencies.push_back(m_kernel_of_[i]);
+            return {Argument::Kind::slot, m_kernel_of_[i]};
+        }
+        if(is_leaf(node.op)) return leaf_(node);
+        return emit_(i);
+    }
+
+    /// Emits the instruction for non-leaf node @p i, after its operands
+    Argument emit_(std::size_t i) {
+        const auto& node = m_nodes_[i];
+        auto lhs         = operand_(node.lhs);
+        Argument rhs;
+        if(is_binary(node.op)) rhs = operand_(node.rhs);
+        release_(lhs);
+        release_(rhs);
+
+        std::size_t temp;
+        if(m_free_.empty()) {
+            temp = m_kernel_.n_temps++;
+        } else {
+            temp = m_free_.back();
+            m_free_.pop_back();
+        }
+        m_kernel_.instructions.push_back({node.op, lhs, rhs, temp});
+        return {Argument::Kind::temp, temp};
+    }
+
+    /// Returns @p arg's temporary, if it has one, to the free list
+    void release_(const Argument& arg) {
+        if(arg.kind == Argument::Kind::temp) m_free_.push_back(arg.index);
+    }
+
+    /// The recorded nodes
+    std::span<const GraphNode> m_nodes_;
+
+    /// The kernel computing each node (or no_kernel if it is fused)
+    const std::vector<std::size_t>& m_kernel_of_;
+
+    /// The kernel being built
+    Kernel& m_kernel_;
+
+    /// Temporaries which are no longer in use
+    std::vector<std::size_t> m_free_;
+};
+
+} // namespace
+
+GraphPlan make_plan(std::span<const GraphNode> nodes,
+                    std::span<const std::size_t> outputs) {
+    const auto n_nodes = nodes.size();
+    std::vector<bool> is_needed(n_nodes, false), is_output(n_nodes, false);
+    for(auto i : outputs) {
+        if(i >= n_nodes) throw std::out_of_range("Graph: node does not exist");
+        is_needed[i] = is_output[i] = true;
+    }
+
+    // Operands precede users, so one backwards sweep finds all needed nodes
+    std::vector<std::size_t> n_uses(n_nodes, 0);
+    for(auto i = n_nodes; i-- > 0;) {
+        const auto& node = nodes[i];
+        if(!is_needed[i] || is_leaf(node.op)) continue;
+        is_needed[node.lhs] = true;
+        ++n_uses[node.lhs];
+        if(is_binary(node.op)) {
+            is_needed[node.rhs] = true;
+            ++n_uses[node.rhs];
+        }
+    }
+
+    // Requested nodes and shared operations are kernels, the rest are fused
+    GraphPlan plan;
+    std::vector<std::size_t> kernel_of(n_nodes, no_kernel);
+    std::vector<std::size_t> level_of;
+    for(std::size_t i = 0; i < n_nodes; ++i) {
+        const bool is_shared = !is_leaf(nodes[i].op) && n_uses[i] > 1;
+        if(!is_output[i] && !(is_needed[i] && is_shared)) continue;
+
+        auto& kernel = plan.kernels.emplace_back();
+        KernelBuilder(nodes, kernel_of, kernel).build(i);
+        plan.max_temps = std::max(plan.max_temps, kernel.n_temps);
+        kernel_of[i]   = plan.kernels.size() - 1;
+
+        std::size_t level = 0;
+        for(auto k : kernel.dependencies)
+            level = std::max(level, level_of[k] + 1);
+        level_of.push_back(level);
+        if(plan.levels.size() <= level) plan.levels.resize(level + 1);
+        plan.levels[level].push_back(kernel_of[i]);
+    }
+
+    // The last level at which each kernel's slot is read
+    const auto n_kernels = plan.kernels.size();
+    std::vector<std::size_t> last_read(level_of);
+    for(std::size_t k = 0; k < n_kernels; ++k)
+        for(auto d : plan.kernels[k].dependencies)
+            last_read[d] = std::max(last_read[d], level_of[k]);
+
+    std::vector<bool> is_output_kernel(n_kernels, false);
+    for(auto i : outputs) is_output_kernel[kernel_of[i]] = true;
+
+    // Kernels of a level run concurrently, so a slot read at level l can only
+    // be handed to a kernel at a level after l
+    std::vector<std::vector<std::size_t>> released(plan.levels.size() + 1);
+    std::vector<std::size_t> free_slots;
+    for(std::size_t l = 0; l < plan.levels.size(); ++l) {
+        for(auto k : released[l]) free_slots.push_back(plan.kernels[k].slot);
+        for(auto k : plan.levels[l]) {
+            auto& kernel = plan.kernels[k];
+            if(is_output_kernel[k] || free_slots.empty()) {
+                kernel.slot = plan.n_slots++;
+            } else {
+                kernel.slot = free_slots.back();
+                free_slots.pop_back();
+            }
+            if(!is_output_kernel[k]) released[last_read[k] + 1].push_back(k);
+        }
+    }
+
+    // Arguments were recorded as kernel indices, point them at the slots
+    for(auto& kernel : plan.kernels) {
+        for(auto& instruction : kernel.instructions) {
+            for(auto* arg : {&instruction.lhs, &instruction.rhs}) {
+                if(arg->kind == Argument::Kind::slot)
+                    arg->index = plan.kernels[arg->index].slot;
+            }
+        }
+    }
+
+    for(auto i : outputs)
+        plan.output_slots.push_back(plan.kernels[kernel_of[i]].slot);
+    return plan;
+}
+
+} // namespace wtf::expr::detail_
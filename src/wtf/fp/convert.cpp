@@ -0,0 +1,230 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+#include <wtf/buffer/copy_engine.hpp>
+#include <wtf/detail_/parallel_for.hpp>
+#include <wtf/detail_/philox.hpp>
+#include <wtf/fp/convert.hpp>
+#include <wtf/fp/detail_/narrow_rounding.hpp>
+
+namespace wtf::fp {
+namespace {
+
+/** @brief Applies @p fxn element-wise to @p n elements from @p pin to
+ *         @p pout.
+ *
+ *  If @p fxn also takes an index, it is given the index of the element in
+ *  the whole conversion, i.e., @p first + i.
+ */
+template<typename From, typename To, typename Fxn>
+void convert_range_(const From* __restrict pin, To* __restrict pout,
+                    std::size_t first, std::size_t n, Fxn fxn) {
+    if constexpr(std::is_invocable_v<Fxn, From, std::size_t>) {
+        for(std::size_t i = 0; i < n; ++i) pout[i] = fxn(pin[i], first + i);
+    } else {
+        for(std::size_t i = 0; i < n; ++i) pout[i] = fxn(pin[i]);
+    }
+}
+
+/** @brief Checks the sizes, then applies @p fxn element-wise from @p in to
+ *         @p out.
+ *
+ *  Large conversions are split over threads exactly like a copy of the
+ *  output would be (see buffer::copy_strategy). If the parallel conversion
+ *  can not be started (e.g., a thread can not be created or memory for it
+ *  allocated), the conversion is finished serially.
+ */
+template<typename From, typename To, typename Fxn>
+void convert_(std::span<const From> in, std::span<To> out, Fxn fxn) {
+    if(in.size() != out.size()) {
+        throw std::invalid_argument(
+          "convert: input and output are different sizes");
+    }
+    const From* pin = in.data();
+    To* pout        = out.data();
+    const auto size = out.size_bytes();
+    if(buffer::copy_strategy(size) == buffer::CopyStrategy::serial) {
+        convert_range_(pin, pout, 0, in.size(), fxn);
+        return;
+    }
+    auto chunk = [=](std::size_t begin, std::size_t end) {
+        convert_range_(pin + begin, pout + begin, begin, end - begin, fxn);
+    };
+    try {
+        wtf::detail_::parallel_for(in.size(), buffer::copy_threads(size),
+                                   chunk);
+    } catch(...) {
+        // Some chunks may be done, but converting them again is harmless
+        convert_range_(pin, pout, 0, in.size(), fxn);
+    }
+}
+
+/// Narrows a double to float so that a second rounding is still correct
+float narrow_(double value) { return detail_::round_to_odd(value); }
+
+/** @brief Converts @p in to @p out, rounding and saturating as set by
+ *         @p options.
+ *
+ *  @tparam Format The format of @p To.
+ *
+ *  Each combination of options gets its own loop, so the options are not
+ *  tested per element. @p narrow rounds a double to the nearest @p To.
+ *  @p exact converts a float which is already representable as a @p To (up
+ *  to overflowing to infinity); stochastically rounded values go through it,
+ *  which skips the round-to-odd step of narrowing from double.
+ */
+template<detail_::NarrowFormat Format, typename From, typename To,
+         typename Narrow, typename Exact>
+void convert_rounded_(std::span<const From> in, std::span<To> out,
+                      const ConvertOptions& options, Narrow narrow,
+                      Exact exact) {
+    const auto key    = wtf::detail_::philox2x32_key(options.seed);
+    const auto offset = options.offset;
+    auto round        = [=](double x, std::size_t i) {
+        const auto random = wtf::detail_::philox2x32(offset + i, key)[0];
+        return detail_::stochastic_round<Format>(x, random);
+    };
+    auto saturate = [](double x) { return detail_::saturate<Format>(x); };
+
+    if(options.stochastic && options.saturate) {
+        convert_(in, out, [=](From x, std::size_t i) {
+            return exact(static_cast<float>(saturate(round(x, i))));
+        });
+    } else if(options.stochastic) {
+        convert_(in, out, [=](From x, std::size_t i) {
+            return exact(static_cast<float>(round(x, i)));
+        });
+    } else if(options.saturate) {
+        // Without the random numbers the loop is cheap enough that a
+        // (scalar) clamp beats the select-based saturate
+        convert_(in, out, [=](From x) {
+            return narrow(std::clamp<double>(x, -Format.max, Format.max));
+        });
+    } else {
+        convert_(in, out, [=](From x) { return narrow(x); });
+    }
+}
+
+/// Rounds a double to the nearest Half
+Half to_half_(double value) {
+    return Half::from_bits(detail_::float_to_half_bits(narrow_(value)));
+}
+
+/// Rounds a double to the nearest BFloat16
+BFloat16 to_bfloat16_(double value) {
+    return BFloat16::from_bits(detail_::float_to_bfloat16_bits(narrow_(value)));
+}
+
+/// Rounds a float to the nearest Half
+Half float_to_half_(float value) {
+    return Half::from_bits(detail_::float_to_half_bits(value));
+}
+
+/// Rounds a float to the nearest BFloat16
+BFloat16 float_to_bfloat16_(float value) {
+    return BFloat16::from_bits(detail_::float_to_bfloat16_bits(value));
+}
+
+} // namespace
+
+void convert(std::span<const Half> in, std::span<float> out) {
+    convert_(in, out,
+             [](Half x) { return detail_::half_bits_to_float(x.bits()); });
+}
+
+void convert(std::span<const Half> in, std::span<double> out) {
+    convert_(in, out, [](Half x) {
+        return static_cast<double>(detail_::half_bits_to_float(x.bits()));
+    });
+}
+
+void convert(std::span<const float> in, std::span<Half> out) {
+    convert_(in, out, [](float x) {
+        return Half::from_bits(detail_::float_to_half_bits(x));
+    });
+}
+
+void convert(std::span<const double> in, std::span<Half> out) {
+    convert_(in, out, [](double x) {
+        return Half::from_bits(detail_::float_to_half_bits(narrow_(x)));
+    });
+}
+
+void convert(std::span<const BFloat16> in, std::span<float> out) {
+    convert_(in, out, [](BFloat16 x) {
+        return detail_::bfloat16_bits_to_float(x.bits());
+    });
+}
+
+void convert(std::span<const BFloat16> in, std::span<double> out) {
+    convert_(in, out, [](BFloat16 x) {
+        return static_cast<double>(detail_::bfloat16_bits_to_float(x.bits()));
+    });
+}
+
+void convert(std::span<const float> in, std::span<BFloat16> out) {
+    convert_(in, out, [](float x) {
+        return BFloat16::from_bits(detail_::float_to_bfloat16_bits(x));
+    });
+}
+
+void convert(std::span<const double> in, std::span<BFloat16> out) {
+    convert_(in, out, [](double x) {
+        return BFloat16::from_bits(detail_::float_to_bfloat16_bits(narrow_(x)));
+    });
+}
+
+void convert(std::span<const double> in, std::span<float> out,
+             const ConvertOptions& options) {
+    convert_rounded_<detail_::binary32_format>(
+      in, out, options, [](double x) { return static_cast<float>(x); },
+      [](float x) { return x; });
+}
+
+void convert(std::span<const float> in, std::span<Half> out,
+             const ConvertOptions& options) {
+    if(!options.stochastic && !options.saturate) return convert(in, out);
+    convert_rounded_<detail_::binary16_format>(
+      in, out, options, [](double x) { return to_half_(x); },
+      [](float x) { return float_to_half_(x); });
+}
+
+void convert(std::span<const double> in, std::span<Half> out,
+             const ConvertOptions& options) {
+    convert_rounded_<detail_::binary16_format>(
+      in, out, options, [](double x) { return to_half_(x); },
+      [](float x) { return float_to_half_(x); });
+}
+
+void convert(std::span<const float> in, std::span<BFloat16> out,
+             const ConvertOptions& options) {
+    if(!options.stochastic && !options.saturate) return convert(in, out);
+    convert_rounded_<detail_::bfloat16_format>(
+      in, out, options, [](double x) { return to_bfloat16_(x); },
+      [](float x) { return float_to_bfloat16_(x); });
+}
+
+void convert(std::span<const double> in, std::span<BFloat16> out,
+             const ConvertOptions& options) {
+    convert_rounded_<detail_::bfloat16_format>(
+      in, out, options, [](double x) { return to_bfloat16_(x); },
+      [](float x) { return float_to_bfloat16_(x); });
+}
+
+} // namespace wtf::fp
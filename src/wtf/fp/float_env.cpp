@@ -0,0 +1,110 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cfenv>
+#include <cstdint>
+#include <wtf/fp/float_env.hpp>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <xmmintrin.h>
+#define WTF_FLOAT_ENV_MXCSR 1
+#elif defined(__aarch64__)
+#define WTF_FLOAT_ENV_FPCR 1
+#endif
+
+namespace wtf::fp {
+namespace {
+
+#if defined(WTF_FLOAT_ENV_MXCSR)
+/// MXCSR bit which flushes subnormal results to zero
+constexpr unsigned int ftz_bit = 1u << 15;
+
+/// MXCSR bit which reads subnormal operands as zero
+constexpr unsigned int daz_bit = 1u << 6;
+#elif defined(WTF_FLOAT_ENV_FPCR)
+/// FPCR bit which flushes subnormal operands and results to zero
+constexpr std::uint64_t fz_bit = std::uint64_t{1} << 24;
+
+std::uint64_t get_fpcr() noexcept {
+    std::uint64_t fpcr;
+    __asm__ __volatile__("mrs %0, fpcr" : "=r"(fpcr));
+    return fpcr;
+}
+
+void set_fpcr(std::uint64_t fpcr) noexcept {
+    __asm__ __volatile__("msr fpcr, %0" : : "r"(fpcr));
+}
+#endif
+
+/// Maps @p mode to the <cfenv> macro for it
+int to_fenv(RoundingMode mode) noexcept {
+    switch(mode) {
+        case RoundingMode::downward: return FE_DOWNWARD;
+        case RoundingMode::upward: return FE_UPWARD;
+        case RoundingMode::toward_zero: return FE_TOWARDZERO;
+        default: return FE_TONEAREST;
+    }
+}
+
+/// Maps the <cfenv> macro @p mode to a RoundingMode
+RoundingMode from_fenv(int mode) noexcept {
+    switch(mode) {
+        case FE_DOWNWARD: return RoundingMode::downward;
+        case FE_UPWARD: return RoundingMode::upward;
+        case FE_TOWARDZERO: return RoundingMode::toward_zero;
+        default: return RoundingMode::to_nearest;
+    }
+}
+
+} // namespace
+
+FloatEnv FloatEnv::current() noexcept {
+    FloatEnv rv;
+    rv.rounding = from_fenv(std::fegetround());
+#if defined(WTF_FLOAT_ENV_MXCSR)
+    const auto csr        = _mm_getcsr();
+    rv.flush_to_zero      = (csr & ftz_bit) != 0;
+    rv.denormals_are_zero = (csr & daz_bit) != 0;
+#elif defined(WTF_FLOAT_ENV_FPCR)
+    rv.flush_to_zero      = (get_fpcr() & fz_bit) != 0;
+    rv.denormals_are_zero = rv.flush_to_zero;
+#endif
+    return rv;
+}
+
+bool supports_flush_to_zero() noexcept {
+#if defined(WTF_FLOAT_ENV_MXCSR) || defined(WTF_FLOAT_ENV_FPCR)
+    return true;
+#else
+    return false;
+#endif
+}
+
+void set_float_env(const FloatEnv& env) noexcept {
+    std::fesetround(to_fenv(env.rounding));
+#if defined(WTF_FLOAT_ENV_MXCSR)
+    auto csr = _mm_getcsr() & ~(ftz_bit | daz_bit);
+    if(env.flush_to_zero) csr |= ftz_bit;
+    if(env.denormals_are_zero) csr |= daz_bit;
+    _mm_setcsr(csr);
+#elif defined(WTF_FLOAT_ENV_FPCR)
+    auto fpcr = get_fpcr() & ~fz_bit;
+    if(env.flush_to_zero || env.denormals_are_zero) fpcr |= fz_bit;
+    set_fpcr(fpcr);
+#endif
+}
+
+} // namespace wtf::fp
@@ -0,0 +1,280 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cerrno>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <fcntl.h>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <unistd.h>
+#include <utility>
+#include <wtf/io/async_writer.hpp>
+#include <wtf/io/detail_/errno_error.hpp>
+
+namespace wtf::io {
+namespace detail_ {
+namespace {
+
+/// Opens @p path for writing, with O_DIRECT if possible and @p direct is set
+int open_for_writing(const std::filesystem::path& path, bool direct,
+                     bool& is_direct) {
+    const int flags = O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC;
+    is_direct       = false;
+#ifdef O_DIRECT
+    if(direct) {
+        const int fd = ::open(path.c_str(), flags | O_DIRECT, 0644);
+        if(fd >= 0) {
+            is_direct = true;
+            return fd;
+        }
+        // Not all file systems (e.g., tmpfs) support O_DIRECT
+        if(errno != EINVAL) throw_errno("AsyncWriter: could not open " +
+                                        path.string());
+    }
+#endif
+    const int fd = ::open(path.c_str(), flags, 0644);
+    if(fd < 0) throw_errno("AsyncWriter: could not open " + path.string());
+    return fd;
+}
+
+} // namespace
+
+/** @brief Implements AsyncWriter.
+ *
+ *  Jobs are kept in a FIFO queue which a single background thread drains in
+ *  order, so records land in the file in the order they were submitted.
+ *  m_in_flight_ counts the reserved bytes of queued and running jobs; it only
+ *  drops once a job's record has been handed to the OS.
+ */
+class WriteQueue {
+public:
+    using size_type   = AsyncWriter::size_type;
+    using handle_type = AsyncWriter::handle_type;
+    using job_type    = AsyncWriter::job_type;
+
+    WriteQueue(const std::filesystem::path& path, AsyncWriteOptions options) :
+      m_options_(std::move(options)) {
+        m_fd_ = open_for_writing(path, m_options_.direct_io, m_is_direct_);
+        try {
+            if(m_options_.direct_io) {
+                m_psink_ = std::make_unique<AlignedFileSink>(
+                  m_fd_, m_options_.alignment, m_options_.staging_size);
+            } else {
+                m_psink_ = std::make_unique<FileDescriptorSink>(m_fd_);
+            }
+            m_thread_ = std::thread([this]() { worker_(); });
+        } catch(...) {
+            ::close(m_fd_);
+            throw;
+        }
+    }
+
+    ~WriteQueue() noexcept {
+        try {
+            close();
+        } catch(...) {}
+    }
+
+    void reserve(size_type nbytes) {
+        std::unique_lock lock(m_mutex_);
+        m_cv_.wait(lock, [&]() {
+            return m_closed_ || m_in_flight_ == 0 ||
+                   m_in_flight_ + nbytes <= m_options_.max_in_flight_bytes;
+        });
+        if(m_closed_) throw std::runtime_error("AsyncWriter is closed");
+        m_in_flight_ += nbytes;
+    }
+
+    void release(size_type nbytes) noexcept {
+        {
+            std::lock_guard lock(m_mutex_);
+            m_in_flight_ -= nbytes;
+        }
+        m_cv_.notify_all();
+    }
+
+    handle_type enqueue(job_type job, size_type nbytes) {
+        Task task{std::move(job), {}, nbytes};
+        auto handle = task.done.get_future();
+        {
+            std::lock_guard lock(m_mutex_);
+            if(m_closed_) throw std::runtime_error("AsyncWriter is closed");
+            m_tasks_.push_back(std::move(task));
+        }
+        m_cv_.notify_all();
+        return handle;
+    }
+
+    void wait() noexcept {
+        std::unique_lock lock(m_mutex_);
+        m_cv_.wait(lock, [this]() { return m_tasks_.empty() && !m_busy_; });
+    }
+
+    void close() {
+        {
+            std::lock_guard lock(m_mutex_);
+            if(m_closed_) return;
+            m_closed_ = true;
+        }
+        m_cv_.notify_all();
+        m_thread_.join();
+
+        std::exception_ptr error = m_error_;
+        if(!error) {
+            try {
+                if(auto* paligned = dynamic_cast<AlignedFileSink*>(
+                     m_psink_.get()))
+                    paligned->finish();
+            } catch(...) { error = std::current_exception(); }
+        }
+        if(::close(m_fd_) != 0 && !error) {
+            error = std::make_exception_ptr(std::system_error(
+              errno, std::generic_category(), "AsyncWriter: close failed"));
+        }
+        if(error) std::rethrow_exception(error);
+    }
+
+    size_type in_flight_bytes() const noexcept {
+        std::lock_guard lock(m_mutex_);
+        return m_in_flight_;
+    }
+
+    bool is_direct() const noexcept { return m_is_direct_; }
+
+private:
+    /// A queued job and the promise used to report its completion
+    struct Task {
+        job_type job;
+        std::promise<void> done;
+        size_type nbytes;
+    };
+
+    /// Body of the background thread, runs until closed and drained
+    void worker_() {
+        std::unique_lock lock(m_mutex_);
+        while(true) {
+            m_cv_.wait(lock,
+                       [this]() { return m_closed_ || !m_tasks_.empty(); });
+            if(m_tasks_.empty()) return;
+            auto task = std::move(m_tasks_.front());
+            m_tasks_.pop_front();
+            m_busy_    = true;
+            auto error = m_error_;
+            lock.unlock();
+
+            // Once a write fails the file is corrupt, so skip the rest
+            if(!error) {
+                try {
+                    task.job(*m_psink_, m_options_.record_options);
+                } catch(...) { error = std::current_exception(); }
+            }
+            task.job = nullptr; // Frees the buffer before the budget is freed
+
+            lock.lock();
+            m_error_ = error;
+            m_in_flight_ -= task.nbytes;
+            m_cv_.notify_all();
+            lock.unlock();
+
+            // Signaled after the budget is updated, but before wait() returns
+            if(error)
+                task.done.set_exception(error);
+            else
+                task.done.set_value();
+
+            lock.lock();
+            m_busy_ = false;
+            m_cv_.notify_all();
+        }
+    }
+
+    /// How the file is written
+    AsyncWriteOptions m_options_;
+
+    /// The file being written
+    int m_fd_ = -1;
+
+    /// Was the file opened with O_DIRECT?
+    bool m_is_direct_ = false;
+
+    /// Where records are written, only used by the background thread
+    std::unique_ptr<ByteSink> m_psink_;
+
+    /// Guards everything below
+    mutable std::mutex m_mutex_;
+
+    /// Signals changes to the queue, the budget, or m_closed_
+    std::condition_variable m_cv_;
+
+    /// Jobs waiting to be run
+    std::deque<Task> m_tasks_;
+
+    /// Bytes reserved by queued and running jobs
+    size_type m_in_flight_ = 0;
+
+    /// Is the background thread running a job?
+    bool m_busy_ = false;
+
+    /// Has close() been called?
+    bool m_closed_ = false;
+
+    /// The first error raised by a job
+    std::exception_ptr m_error_;
+
+    /// The background thread
+    std::thread m_thread_;
+};
+
+} // namespace detail_
+
+AsyncWriter::AsyncWriter(const path_type& path, AsyncWriteOptions options) :
+  m_pqueue_(std::make_unique<detail_::WriteQueue>(path, std::move(options))) {}
+
+AsyncWriter::AsyncWriter(AsyncWriter&& other) noexcept = default;
+
+AsyncWriter& AsyncWriter::operator=(AsyncWriter&& other) noexcept = default;
+
+AsyncWriter::~AsyncWriter() noexcept = default;
+
+void AsyncWriter::wait() noexcept { m_pqueue_->wait(); }
+
+void AsyncWriter::close() { m_pqueue_->close(); }
+
+AsyncWriter::size_type AsyncWriter::in_flight_bytes() const noexcept {
+    return m_pqueue_->in_flight_bytes();
+}
+
+bool AsyncWriter::is_direct() const noexcept {
+    return m_pqueue_->is_direct();
+}
+
+void AsyncWriter::reserve_(size_type nbytes) { m_pqueue_->reserve(nbytes); }
+
+void AsyncWriter::release_(size_type nbytes) noexcept {
+    m_pqueue_->release(nbytes);
+}
+
+AsyncWriter::handle_type AsyncWriter::enqueue_(job_type job,
+                                               size_type nbytes) {
+    return m_pqueue_->enqueue(std::move(job), nbytes);
+}
+
+} // namespace wtf::io
@@ -0,0 +1,78 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <bit>
+#include <cstring>
+#include <wtf/io/checksum.hpp>
+
+namespace wtf::io {
+namespace {
+
+/// Multipliers from the xxHash family of hashes
+///@{
+constexpr std::uint64_t prime1 = 0x9E3779B185EBCA87ULL;
+constexpr std::uint64_t prime2 = 0xC2B2AE3D27D4EB4FULL;
+constexpr std::uint64_t prime3 = 0x165667B19E3779F9ULL;
+///@}
+
+/// Reads 8 bytes as a little endian integer, regardless of the native order
+std::uint64_t load_le(const std::byte* p) noexcept {
+    std::uint64_t word;
+    std::memcpy(&word, p, sizeof(word));
+    if constexpr(std::endian::native == std::endian::big) {
+        std::uint64_t swapped = 0;
+        for(int i = 0; i < 8; ++i)
+            swapped |= ((word >> (8 * i)) & 0xFF) << (56 - 8 * i);
+        word = swapped;
+    }
+    return word;
+}
+
+/// Mixes one word into the running hash
+std::uint64_t mix(std::uint64_t hash, std::uint64_t word) noexcept {
+    hash ^= std::rotl(word * prime2, 31) * prime1;
+    return std::rotl(hash, 27) * prime1 + prime3;
+}
+
+} // namespace
+
+std::uint64_t checksum(std::span<const std::byte> bytes) noexcept {
+    const auto n  = bytes.size();
+    const auto* p = bytes.data();
+
+    // Four independent lanes keep the multipliers busy
+    std::uint64_t lanes[4] = {prime1, prime2, prime3, n};
+    std::size_t i          = 0;
+    for(; i + 32 <= n; i += 32) {
+        for(std::size_t j = 0; j < 4; ++j)
+            lanes[j] = mix(lanes[j], load_le(p + i + 8 * j));
+    }
+
+    std::uint64_t hash = n * prime1;
+    for(auto lane : lanes) hash = mix(hash, lane);
+    for(; i + 8 <= n; i += 8) hash = mix(hash, load_le(p + i));
+    for(; i < n; ++i) hash = mix(hash, std::to_integer<std::uint64_t>(p[i]));
+
+    // Final avalanche so every input bit affects every output bit
+    hash ^= hash >> 33;
+    hash *= prime2;
+    hash ^= hash >> 29;
+    hash *= prime3;
+    hash ^= hash >> 32;
+    return hash;
+}
+
+} // namespace wtf::io
@@ -0,0 +1,315 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <fcntl.h>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <unistd.h>
+#include <utility>
+#include <vector>
+#include <wtf/io/chunked_reader.hpp>
+#include <wtf/io/detail_/errno_error.hpp>
+#include <wtf/io/detail_/record.hpp>
+
+namespace wtf::io {
+namespace detail_ {
+namespace {
+
+/// Fills @p bytes with the bytes of @p fd starting at @p offset
+void pread_all(int fd, std::span<std::byte> bytes, std::size_t offset) {
+    while(!bytes.empty()) {
+        const auto rv = ::pread(fd, bytes.data(), bytes.size(),
+                                static_cast<off_t>(offset));
+        if(rv < 0) {
+            if(errno == EINTR) continue;
+            throw_errno("ChunkedReader: read failed");
+        }
+        if(rv == 0) throw std::runtime_error("ChunkedReader: file truncated");
+        bytes = bytes.subspan(static_cast<std::size_t>(rv));
+        offset += static_cast<std::size_t>(rv);
+    }
+}
+
+} // namespace
+
+/** @brief Implements ChunkedReader.
+ *
+ *  Chunk i is always read into slot i % 2. A single background thread reads
+ *  chunks on request; the main thread requests chunk i + 1 right after
+ *  handing out chunk i, so at most one read is ever in flight and it never
+ *  targets the slot the caller is looking at.
+ */
+class ChunkPipeline {
+public:
+    using size_type    = ChunkedReader::size_type;
+    using chunk_type   = ChunkedReader::chunk_type;
+    using path_type    = ChunkedReader::path_type;
+    using view_factory = ChunkedReader::view_factory;
+    using byte_buffer  = FileHeader::byte_buffer;
+
+    ChunkPipeline(const path_type& path, FileHeader header,
+                  size_type chunk_size, view_factory make_view,
+                  size_type word_size) :
+      m_header_(std::move(header)),
+      m_chunk_size_(chunk_size),
+      m_make_view_(make_view),
+      m_word_size_(word_size == 0 ? m_header_.element_size : word_size) {
+        if(chunk_size == 0) {
+            throw std::invalid_argument("ChunkedReader: chunk size is 0");
+        }
+        if(m_header_.size > 0 && m_header_.element_size == 0) {
+            throw std::invalid_argument(
+              "ChunkedReader: elements written by a Serializer can not be "
+              "streamed");
+        }
+        const auto element_size = m_header_.element_size;
+        if(element_size != 0 &&
+           chunk_size > std::numeric_limits<size_type>::max() / element_size) {
+            throw std::invalid_argument("ChunkedReader: chunk size is too big");
+        }
+        const auto block       = m_header_.checksum_block_size;
+        const auto chunk_bytes = chunk_size * element_size;
+        if(block != 0 && n_chunks() > 1 && chunk_bytes % block != 0) {
+            throw std::invalid_argument(
+              "ChunkedReader: chunks must span whole checksum blocks");
+        }
+
+        // Small files only need small (and possibly only one) slots
+        const auto n_elements = std::min(chunk_size, m_header_.size);
+        for(size_type i = 0; i < std::min<size_type>(n_chunks(), 2); ++i) {
+            m_slots_[i].resize(n_elements * m_header_.element_size);
+            if(block != 0) m_sums_[i].resize(n_sums_(n_elements));
+        }
+
+        m_fd_ = ::open(path.c_str(), O_RDONLY);
+        if(m_fd_ < 0)
+            throw_errno("ChunkedReader: could not open " + path.string());
+        try {
+            m_thread_ = std::thread([this]() { worker_(); });
+        } catch(...) {
+            ::close(m_fd_);
+            throw;
+        }
+        if(n_chunks() > 0) submit_(0);
+    }
+
+    ~ChunkPipeline() noexcept {
+        {
+            std::lock_guard lock(m_mutex_);
+            m_stop_ = true;
+        }
+        m_cv_.notify_all();
+        m_thread_.join();
+        ::close(m_fd_);
+    }
+
+    std::optional<chunk_type> next() {
+        if(m_next_ >= n_chunks()) return std::nullopt;
+        try {
+            wait_();
+        } catch(...) {
+            m_next_ = n_chunks();
+            throw;
+        }
+        const auto i = m_next_++;
+        if(m_next_ < n_chunks()) submit_(m_next_);
+        return m_make_view_(m_slots_[i % 2].data(), count_(i));
+    }
+
+    void rewind() noexcept {
+        {
+            std::unique_lock lock(m_mutex_);
+            m_cv_.wait(lock, [this]() { return !m_request_.has_value(); });
+            m_error_ = nullptr;
+        }
+        m_next_ = 0;
+        if(n_chunks() > 0) submit_(0);
+    }
+
+    size_type chunk_size() const noexcept { return m_chunk_size_; }
+
+    size_type n_chunks() const noexcept {
+        return (m_header_.size + m_chunk_size_ - 1) / m_chunk_size_;
+    }
+
+    const FileHeader& header() const noexcept { return m_header_; }
+
+private:
+    /// Number of elements in chunk @p i
+    size_type count_(size_type i) const noexcept {
+        return std::min(m_chunk_size_, m_header_.size - i * m_chunk_size_);
+    }
+
+    /// Number of bytes of checksums covering @p n elements
+    size_type n_sums_(size_type n) const noexcept {
+        const auto block  = m_header_.checksum_block_size;
+        const auto nbytes = n * m_header_.element_size;
+        return (nbytes + block - 1) / block * sizeof(std::uint64_t);
+    }
+
+    /// Asks the background thread to read chunk @p i
+    void submit_(size_type i) {
+        {
+            std::lock_guard lock(m_mutex_);
+            m_request_ = i;
+        }
+        m_cv_.notify_all();
+    }
+
+    /// Blocks until the requested chunk is read, rethrowing any error
+    void wait_() {
+        std::unique_lock lock(m_mutex_);
+        m_cv_.wait(lock, [this]() { return !m_request_.has_value(); });
+        if(m_error_) std::rethrow_exception(std::exchange(m_error_, nullptr));
+    }
+
+    /// Reads chunk @p i into its slot, called on the background thread
+    void read_chunk_(size_type i) {
+        const auto esize  = m_header_.element_size;
+        const auto block  = m_header_.checksum_block_size;
+        const auto offset = i * m_chunk_size_ * esize;
+        auto bytes = std::span(m_slots_[i % 2]).first(count_(i) * esize);
+        pread_all(m_fd_, bytes, m_header_.data_offset() + offset);
+        if(block != 0) {
+            const auto first = offset / block;
+            auto sums = std::span(m_sums_[i % 2]).first(n_sums_(count_(i)));
+            pread_all(m_fd_, sums,
+                      m_header_.data_offset() + m_header_.data_size() +
+                        first * sizeof(std::uint64_t));
+            check_checksums(bytes, block, sums, first);
+        }
+        if(m_header_.endianness != FileHeader::native_endianness())
+            byte_swap(bytes, m_word_size_);
+    }
+
+    /// Body of the background thread
+    void worker_() {
+        std::unique_lock lock(m_mutex_);
+        while(true) {
+            m_cv_.wait(lock, [this]() { return m_stop_ || m_request_; });
+            if(m_stop_) return;
+            const auto i = *m_request_;
+            lock.unlock();
+            std::exception_ptr error;
+            try {
+                read_chunk_(i);
+            } catch(...) { error = std::current_exception(); }
+            lock.lock();
+            m_error_ = error;
+            m_request_.reset();
+            m_cv_.notify_all();
+        }
+    }
+
+    /// The header of the file being read
+    FileHeader m_header_;
+
+    /// The maximum number of elements per chunk
+    size_type m_chunk_size_;
+
+    /// Wraps a slot in a chunk_type
+    view_factory m_make_view_;
+
+    /// The number of bytes reversed together when swapping byte order
+    size_type m_word_size_;
+
+    /// The two reusable chunk buffers
+    std::array<byte_buffer, 2> m_slots_;
+
+    /// The stored checksums of the chunk in the corresponding slot
+    std::array<byte_buffer, 2> m_sums_;
+
+    /// The index of the chunk next() will return
+    size_type m_next_ = 0;
+
+    /// The file being read
+    int m_fd_ = -1;
+
+    /// Guards m_request_, m_error_, and m_stop_
+    std::mutex m_mutex_;
+
+    /// Signals changes to m_request_ and m_stop_
+    std::condition_variable m_cv_;
+
+    /// The chunk the background thread should read (reset once it is read)
+    std::optional<size_type> m_request_;
+
+    /// The error, if any, raised reading the last chunk
+    std::exception_ptr m_error_;
+
+    /// Should the background thread exit?
+    bool m_stop_ = false;
+
+    /// The background thread
+    std::thread m_thread_;
+};
+
+} // namespace detail_
+
+ChunkedReader::ChunkedReader(const path_type& path, FileHeader header,
+                             size_type chunk_size, view_factory make_view,
+                             size_type word_size) :
+  m_ppipeline_(std::make_unique<detail_::ChunkPipeline>(
+    path, std::move(header), chunk_size, make_view, word_size)) {}
+
+ChunkedReader::ChunkedReader(ChunkedReader&& other) noexcept = default;
+
+ChunkedReader& ChunkedReader::operator=(ChunkedReader&& other) noexcept =
+  default;
+
+ChunkedReader::~ChunkedReader() noexcept = default;
+
+// A moved-from reader has no pipeline and acts like an empty file
+
+std::optional<ChunkedReader::chunk_type> ChunkedReader::next() {
+    if(!m_ppipeline_) return std::nullopt;
+    return m_ppipeline_->next();
+}
+
+void ChunkedReader::rewind() noexcept {
+    if(m_ppipeline_) m_ppipeline_->rewind();
+}
+
+ChunkedReader::size_type ChunkedReader::size() const noexcept {
+    return header().size;
+}
+
+ChunkedReader::size_type ChunkedReader::chunk_size() const noexcept {
+    return m_ppipeline_ ? m_ppipeline_->chunk_size() : 0;
+}
+
+ChunkedReader::size_type ChunkedReader::n_chunks() const noexcept {
+    return m_ppipeline_ ? m_ppipeline_->n_chunks() : 0;
+}
+
+const FileHeader& ChunkedReader::header() const noexcept {
+    static const FileHeader empty;
+    return m_ppipeline_ ? m_ppipeline_->header() : empty;
+}
+
+} // namespace wtf::io
@@ -0,0 +1,186 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstdlib>
+#include <istream>
+#include <new>
+#include <ostream>
+#include <stdexcept>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <system_error>
+#include <unistd.h>
+#include <vector>
+#include <wtf/io/detail_/byte_stream.hpp>
+#include <wtf/io/detail_/errno_error.hpp>
+
+namespace wtf::io::detail_ {
+namespace {
+
+/// Throws because the source ran out of bytes
+[[noreturn]] void throw_eof() {
+    throw std::runtime_error("Unexpected end of serialized data");
+}
+
+} // namespace
+
+void StreamSink::write(gather_list pieces) {
+    for(const auto& piece : pieces) {
+        const auto* p = reinterpret_cast<const char*>(piece.data());
+        const auto n  = static_cast<std::streamsize>(piece.size());
+        if(!m_os_.write(p, n)) {
+            throw std::system_error(std::make_error_code(std::errc::io_error),
+                                    "StreamSink: write failed");
+        }
+    }
+}
+
+void FileDescriptorSink::write(gather_list pieces) {
+    std::vector<iovec> iov;
+    iov.reserve(pieces.size());
+    for(const auto& piece : pieces) {
+        if(piece.empty()) continue;
+        auto* p = const_cast<std::byte*>(piece.data());
+        iov.push_back(iovec{p, piece.size()});
+    }
+
+    // writev may write fewer bytes than asked, so loop until all are written
+    std::size_t first = 0;
+    while(first < iov.size()) {
+        const auto n  = std::min<std::size_t>(iov.size() - first, IOV_MAX);
+        const auto rv = ::writev(m_fd_, &iov[first], static_cast<int>(n));
+        if(rv < 0) {
+            if(errno == EINTR) continue;
+            throw_errno("FileDescriptorSink: writev failed");
+        }
+
+        auto written = static_cast<std::size_t>(rv);
+        while(first < iov.size() && written >= iov[first].iov_len) {
+            written -= iov[first].iov_len;
+            ++first;
+        }
+        if(written > 0) {
+            iov[first].iov_base = static_cast<char*>(iov[first].iov_base) +
+                                  written;
+            iov[first].iov_len -= written;
+        }
+    }
+}
+
+AlignedFileSink::AlignedFileSink(int fd, size_type alignment,
+                                 size_type capacity) :
+  m_fd_(fd), m_alignment_(alignment), m_capacity_(capacity) {
+    if(alignment == 0 || (alignment & (alignment - 1)) != 0) {
+        throw std::invalid_argument("Alignment must be a power of 2");
+    }
+    if(capacity == 0 || capacity % alignment != 0) {
+        throw std::invalid_argument(
+          "Capacity must be a non-zero multiple of the alignment");
+    }
+    auto* p = static_cast<std::byte*>(std::aligned_alloc(alignment, capacity));
+    if(p == nullptr) throw std::bad_alloc();
+    m_buffer_.reset(p);
+}
+
+void AlignedFileSink::write(gather_list pieces) {
+    for(auto piece : pieces) {
+        while(!piece.empty()) {
+            const auto n = std::min(piece.size(), m_capacity_ - m_fill_);
+            std::copy_n(piece.begin(), n, m_buffer_.get() + m_fill_);
+            m_fill_ += n;
+            piece = piece.subspan(n);
+            if(m_fill_ == m_capacity_) write_staged_(m_capacity_);
+        }
+    }
+}
+
+void AlignedFileSink::finish() {
+    if(m_fill_ == 0) return;
+    const auto size   = m_written_ + m_fill_;
+    const auto padded = (m_fill_ + m_alignment_ - 1) / m_alignment_ *
+                        m_alignment_;
+    std::fill(m_buffer_.get() + m_fill_, m_buffer_.get() + padded,
+              std::byte{0});
+    write_staged_(padded);
+    if(::ftruncate(m_fd_, static_cast<off_t>(size)) != 0)
+        throw_errno("AlignedFileSink: ftruncate failed");
+    m_written_ = size;
+}
+
+void AlignedFileSink::write_staged_(size_type n) {
+    const auto* p = m_buffer_.get();
+    size_type done = 0;
+    while(done < n) {
+        const auto rv = ::write(m_fd_, p + done, n - done);
+        if(rv < 0) {
+            if(errno == EINTR) continue;
+            throw_errno("AlignedFileSink: write failed");
+        }
+        done += static_cast<size_type>(rv);
+    }
+    m_written_ += n;
+    m_fill_ = 0;
+}
+
+void StreamSource::read(std::span<std::byte> bytes) {
+    auto* p      = reinterpret_cast<char*>(bytes.data());
+    const auto n = static_cast<std::streamsize>(bytes.size());
+    if(!m_is_.read(p, n)) throw_eof();
+}
+
+std::optional<std::size_t> StreamSource::remaining() noexcept {
+    try {
+        const auto here = m_is_.tellg();
+        if(here == std::istream::pos_type(-1)) return std::nullopt;
+        m_is_.seekg(0, std::ios::end);
+        const auto end = m_is_.tellg();
+        m_is_.seekg(here);
+        if(!m_is_ || end == std::istream::pos_type(-1) || end < here) {
+            m_is_.clear();
+            return std::nullopt;
+        }
+        return static_cast<std::size_t>(end - here);
+    } catch(...) { return std::nullopt; }
+}
+
+void FileDescriptorSource::read(std::span<std::byte> bytes) {
+    auto* p          = bytes.data();
+    std::size_t left = bytes.size();
+    while(left > 0) {
+        const auto rv = ::read(m_fd_, p, left);
+        if(rv < 0) {
+            if(errno == EINTR) continue;
+            throw_errno("FileDescriptorSource: read failed");
+        }
+        if(rv == 0) throw_eof();
+        p += rv;
+        left -= static_cast<std::size_t>(rv);
+    }
+}
+
+std::optional<std::size_t> FileDescriptorSource::remaining() noexcept {
+    struct stat info;
+    if(::fstat(m_fd_, &info) != 0 || !S_ISREG(info.st_mode))
+        return std::nullopt;
+    const auto here = ::lseek(m_fd_, 0, SEEK_CUR);
+    if(here < 0 || here > info.st_size) return std::nullopt;
+    return static_cast<std::size_t>(info.st_size - here);
+}
+
+} // namespace wtf::io::detail_
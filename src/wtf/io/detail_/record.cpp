@@ -0,0 +1,177 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <wtf/io/checksum.hpp>
+#include <wtf/io/detail_/record.hpp>
+
+namespace wtf::io::detail_ {
+namespace {
+
+using byte_buffer = FileHeader::byte_buffer;
+
+/// Number of bytes used to store one integer (checksums and byte counts)
+constexpr std::size_t word_size = 8;
+
+/// Writes @p value as a little endian 8 byte integer starting at @p out
+void write_word(std::byte* out, std::uint64_t value) noexcept {
+    for(std::size_t i = 0; i < word_size; ++i)
+        out[i] = static_cast<std::byte>((value >> (8 * i)) & 0xFF);
+}
+
+/// Reads a little endian 8 byte integer starting at @p in
+std::uint64_t read_word(const std::byte* in) noexcept {
+    std::uint64_t value = 0;
+    for(std::size_t i = 0; i < word_size; ++i)
+        value |= std::to_integer<std::uint64_t>(in[i]) << (8 * i);
+    return value;
+}
+
+/// Number of checksums covering @p n bytes with blocks of @p block bytes
+std::size_t n_blocks(std::size_t n, std::size_t block) noexcept {
+    return block == 0 ? 0 : (n + block - 1) / block;
+}
+
+/// Throws unless @p n more bytes can be read from @p source
+void check_readable(ByteSource& source, std::size_t n) {
+    const auto left  = source.remaining();
+    const auto limit = left ? *left : max_unsized_payload_bytes;
+    if(n > limit) {
+        throw std::runtime_error("Record claims " + std::to_string(n) +
+                                 " bytes, but at most " +
+                                 std::to_string(limit) + " can be read");
+    }
+}
+
+/// @p n bytes plus their checksums, or throws if that overflows
+std::size_t with_checksums(std::uint64_t n, std::size_t block) {
+    constexpr auto max = std::numeric_limits<std::size_t>::max();
+    // Each block of at least one byte adds word_size bytes of checksum
+    const auto factor = block == 0 ? 1 : 1 + word_size;
+    if(n > max / factor) throw std::runtime_error("Record size overflows");
+    return n + n_blocks(n, block) * word_size;
+}
+
+/// Reads the checksums of @p payload from @p source and compares them
+void verify_checksums(ByteSource& source, std::span<const std::byte> payload,
+                      std::size_t block) {
+    if(block == 0) return;
+    byte_buffer stored(n_blocks(payload.size(), block) * word_size);
+    source.read(stored);
+    check_checksums(payload, block, stored);
+}
+
+} // namespace
+
+byte_buffer make_checksums(std::span<const std::byte> payload,
+                           std::size_t block) {
+    byte_buffer sums(n_blocks(payload.size(), block) * word_size);
+    if(block == 0) return sums;
+    for(std::size_t i = 0, offset = 0; offset < payload.size(); ++i) {
+        const auto n = std::min(block, payload.size() - offset);
+        write_word(sums.data() + i * word_size,
+                   checksum(payload.subspan(offset, n)));
+        offset += n;
+    }
+    return sums;
+}
+
+void check_checksums(std::span<const std::byte> payload, std::size_t block,
+                     std::span<const std::byte> stored,
+                     std::size_t first_block) {
+    const auto computed = make_checksums(payload, block);
+    if(stored.size() != computed.size()) {
+        throw std::runtime_error("Wrong number of checksums");
+    }
+    for(std::size_t i = 0; i < computed.size(); i += word_size) {
+        if(read_word(stored.data() + i) != read_word(computed.data() + i)) {
+            throw std::runtime_error("Checksum mismatch in block " +
+                                     std::to_string(first_block +
+                                                    i / word_size));
+        }
+    }
+}
+
+FileHeader read_header(ByteSource& source) {
+    byte_buffer bytes(FileHeader::fixed_size);
+    source.read(bytes);
+    bytes.resize(FileHeader::total_size(bytes));
+    source.read(std::span(bytes).subspan(FileHeader::fixed_size));
+    return FileHeader::from_bytes(bytes);
+}
+
+void check_payload_size(ByteSource& source, const FileHeader& header) {
+    constexpr auto max = std::numeric_limits<std::size_t>::max();
+    const bool custom  = header.element_size == 0;
+    const auto element = custom ? 1 : header.element_size;
+    if(header.size > (max - word_size) / element)
+        throw std::runtime_error("Record size overflows");
+    const auto n = header.size * element + (custom ? word_size : 0);
+    check_readable(source, with_checksums(n, header.checksum_block_size));
+}
+
+void write_record(ByteSink& sink, const FileHeader& header,
+                  std::span<const std::byte> payload) {
+    const auto head = header.to_bytes();
+    const auto sums = make_checksums(payload, header.checksum_block_size);
+    const std::array<ByteSink::piece_type, 3> pieces{head, payload, sums};
+    sink.write(pieces);
+}
+
+void read_payload(ByteSource& source, const FileHeader& header,
+                  std::span<std::byte> payload) {
+    source.read(payload);
+    verify_checksums(source, payload, header.checksum_block_size);
+}
+
+byte_buffer make_custom_payload(std::string_view blob) {
+    byte_buffer payload(word_size + blob.size());
+    write_word(payload.data(), blob.size());
+    std::transform(blob.begin(), blob.end(), payload.begin() + word_size,
+                   [](char c) { return static_cast<std::byte>(c); });
+    return payload;
+}
+
+std::string read_custom_payload(ByteSource& source, const FileHeader& header) {
+    byte_buffer payload(word_size);
+    source.read(payload);
+    const auto blob_size = read_word(payload.data());
+    if(blob_size > std::numeric_limits<std::size_t>::max() - word_size)
+        throw std::runtime_error("Record size overflows");
+    // The length word has been read, so only the rest must still be there
+    const auto size = with_checksums(word_size + blob_size,
+                                     header.checksum_block_size);
+    check_readable(source, size - word_size);
+    payload.resize(word_size + blob_size);
+    source.read(std::span(payload).subspan(word_size));
+    verify_checksums(source, payload, header.checksum_block_size);
+
+    const auto* p = reinterpret_cast<const char*>(payload.data());
+    return std::string(p + word_size, blob_size);
+}
+
+void byte_swap(std::span<std::byte> bytes, std::size_t element_size) noexcept {
+    if(element_size < 2) return;
+    for(std::size_t i = 0; i + element_size <= bytes.size(); i += element_size)
+        std::reverse(bytes.begin() + i, bytes.begin() + i + element_size);
+}
+
+} // namespace wtf::io::detail_
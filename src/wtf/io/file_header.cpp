@@ -0,0 +1,166 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <array>
+#include <cerrno>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <wtf/io/file_header.hpp>
+
+namespace wtf::io {
+namespace {
+
+/// The first four bytes of every WTF buffer file
+constexpr std::array<char, 4> magic{'W', 'T', 'F', 'B'};
+
+/// Bit of the flags byte which is set if the data is checksummed
+constexpr std::uint64_t checksum_flag = 1;
+
+/// Longer type names are assumed to come from a corrupt header
+constexpr std::size_t max_name_size = 1024;
+
+/// Writes the low @p n bytes of @p value, little endian, starting at @p out
+void write_le(std::byte* out, std::uint64_t value, std::size_t n) {
+    for(std::size_t i = 0; i < n; ++i)
+        out[i] = static_cast<std::byte>((value >> (8 * i)) & 0xFF);
+}
+
+/// Reads an @p n byte little endian integer starting at @p in
+std::uint64_t read_le(const std::byte* in, std::size_t n) {
+    std::uint64_t value = 0;
+    for(std::size_t i = 0; i < n; ++i)
+        value |= std::to_integer<std::uint64_t>(in[i]) << (8 * i);
+    return value;
+}
+
+/// Rounds @p n up to the next multiple of @p alignment
+std::size_t round_up(std::size_t n, std::size_t alignment) {
+    return (n + alignment - 1) / alignment * alignment;
+}
+
+/// Throws a std::runtime_error explaining why a header is invalid
+[[noreturn]] void bad_header(const std::string& why) {
+    throw std::runtime_error("FileHeader: " + why);
+}
+
+} // namespace
+
+FileHeader::size_type FileHeader::data_offset() const noexcept {
+    return round_up(fixed_size + type_name.size(), data_alignment);
+}
+
+FileHeader::byte_buffer FileHeader::to_bytes() const {
+    byte_buffer buffer(data_offset(), std::byte{0});
+    auto* p = buffer.data();
+    for(std::size_t i = 0; i < magic.size(); ++i)
+        p[i] = static_cast<std::byte>(magic[i]);
+    write_le(p + 4, version, 2);
+    write_le(p + 6, static_cast<std::uint8_t>(endianness), 1);
+    write_le(p + 7, checksum_block_size != 0 ? checksum_flag : 0, 1);
+    write_le(p + 8, element_size, 4);
+    write_le(p + 12, type_name.size(), 4);
+    write_le(p + 16, size, 8);
+    write_le(p + 24, data_offset(), 8);
+    write_le(p + 32, checksum_block_size, 4);
+    for(std::size_t i = 0; i < type_name.size(); ++i)
+        p[fixed_size + i] = static_cast<std::byte>(type_name[i]);
+    return buffer;
+}
+
+FileHeader::size_type FileHeader::total_size(
+  std::span<const std::byte> prefix) {
+    if(prefix.size() < fixed_size) bad_header("too few bytes for a header");
+    for(std::size_t i = 0; i < magic.size(); ++i) {
+        if(prefix[i] != static_cast<std::byte>(magic[i]))
+            bad_header("bad magic");
+    }
+
+    const auto size = read_le(prefix.data() + 24, 8);
+    if(size < fixed_size || size > fixed_size + max_name_size + data_alignment)
+        bad_header("bad data offset");
+    return size;
+}
+
+FileHeader FileHeader::from_bytes(std::span<const std::byte> bytes) {
+    const auto header_size = total_size(bytes);
+    const auto* p          = bytes.data();
+
+    FileHeader header;
+    header.version = static_cast<std::uint16_t>(read_le(p + 4, 2));
+    if(header.version != current_version)
+        bad_header("unsupported version " + std::to_string(header.version));
+
+    const auto endianness = read_le(p + 6, 1);
+    if(endianness != 1 && endianness != 2) bad_header("bad endianness");
+    header.endianness = static_cast<Endianness>(endianness);
+
+    const auto flags = read_le(p + 7, 1);
+    if((flags & ~checksum_flag) != 0) bad_header("unknown flags");
+
+    header.element_size  = read_le(p + 8, 4);
+    const auto name_size = read_le(p + 12, 4);
+    header.size          = read_le(p + 16, 8);
+
+    if(flags & checksum_flag) {
+        header.checksum_block_size = read_le(p + 32, 4);
+        if(header.checksum_block_size == 0) bad_header("bad checksum block");
+    }
+
+    if(name_size > max_name_size) bad_header("type name is too long");
+    if(bytes.size() < fixed_size + name_size) bad_header("truncated type name");
+    const auto* pname = reinterpret_cast<const char*>(p + fixed_size);
+    header.type_name.assign(pname, name_size);
+
+    if(header_size != header.data_offset()) bad_header("bad data offset");
+    return header;
+}
+
+FileHeader FileHeader::read(const std::filesystem::path& path) {
+    std::ifstream file(path, std::ios::binary);
+    if(!file) {
+        throw std::system_error(errno, std::generic_category(),
+                                "FileHeader: could not open " + path.string());
+    }
+
+    byte_buffer buffer(fixed_size);
+    auto* p = reinterpret_cast<char*>(buffer.data());
+    if(!file.read(p, fixed_size)) bad_header("too few bytes for a header");
+
+    const auto header_size = total_size(buffer);
+    buffer.resize(header_size);
+    p = reinterpret_cast<char*>(buffer.data());
+    if(!file.read(p + fixed_size, header_size - fixed_size))
+        bad_header("truncated header");
+    return from_bytes(buffer);
+}
+
+void FileHeader::create_file(const std::filesystem::path& path) const {
+    const auto bytes = to_bytes();
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        const auto* p = reinterpret_cast<const char*>(bytes.data());
+        if(!file || !file.write(p, bytes.size()).flush()) {
+            throw std::system_error(errno, std::generic_category(),
+                                    "FileHeader: could not write " +
+                                      path.string());
+        }
+    }
+    std::filesystem::resize_file(path, bytes.size() + data_size());
+}
+
+} // namespace wtf::io
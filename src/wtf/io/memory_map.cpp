@@ -0,0 +1,147 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cerrno>
+#include <fcntl.h>
+#include <stdexcept>
+#include <string>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <system_error>
+#include <unistd.h>
+#include <utility>
+#include <wtf/io/detail_/errno_error.hpp>
+#include <wtf/io/memory_map.hpp>
+
+namespace wtf::io {
+namespace {
+
+using detail_::throw_errno;
+
+/// Maps our Advice enum onto the POSIX constants
+int posix_advice(MemoryMap::Advice advice) {
+    switch(advice) {
+        case MemoryMap::Advice::sequential: return POSIX_MADV_SEQUENTIAL;
+        case MemoryMap::Advice::random: return POSIX_MADV_RANDOM;
+        case MemoryMap::Advice::will_need: return POSIX_MADV_WILLNEED;
+        case MemoryMap::Advice::dont_need: return POSIX_MADV_DONTNEED;
+        default: return POSIX_MADV_NORMAL;
+    }
+}
+
+/// The OS's page size
+std::size_t page_size() {
+    static const auto size = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+    return size;
+}
+
+/// Closes a file descriptor when it goes out of scope
+struct FileCloser {
+    ~FileCloser() {
+        if(fd >= 0) ::close(fd);
+    }
+    int fd;
+};
+
+} // namespace
+
+MemoryMap::MemoryMap(const path_type& path, Mode mode, size_type offset,
+                     size_type length) :
+  m_mode_(mode) {
+    const bool writable = mode == Mode::read_write;
+    FileCloser file{::open(path.c_str(), writable ? O_RDWR : O_RDONLY)};
+    if(file.fd < 0) throw_errno("MemoryMap: could not open " + path.string());
+
+    struct stat info;
+    if(::fstat(file.fd, &info) != 0)
+        throw_errno("MemoryMap: could not stat " + path.string());
+
+    const auto file_size = static_cast<size_type>(info.st_size);
+    if(offset > file_size || length > file_size - offset) {
+        throw std::out_of_range("MemoryMap: region [" + std::to_string(offset) +
+                                ", " + std::to_string(offset + length) +
+                                ") is not in file of size " +
+                                std::to_string(file_size));
+    }
+    if(length == 0) return;
+
+    const auto aligned_offset = offset - offset % page_size();
+    const auto shift          = offset - aligned_offset;
+
+    // read_only mappings are private so that in-memory writes never reach the
+    // file, but are still allowed (the FloatBuffer API assumes mutability)
+    const int flags = writable ? MAP_SHARED : MAP_PRIVATE;
+    void* p = ::mmap(nullptr, length + shift, PROT_READ | PROT_WRITE, flags,
+                     file.fd, static_cast<off_t>(aligned_offset));
+    if(p == MAP_FAILED)
+        throw_errno("MemoryMap: could not map " + path.string());
+
+    m_pbase_  = static_cast<pointer>(p);
+    m_shift_  = shift;
+    m_length_ = length;
+}
+
+MemoryMap::MemoryMap(MemoryMap&& other) noexcept :
+  m_pbase_(std::exchange(other.m_pbase_, nullptr)),
+  m_shift_(std::exchange(other.m_shift_, 0)),
+  m_length_(std::exchange(other.m_length_, 0)),
+  m_mode_(other.m_mode_) {}
+
+MemoryMap& MemoryMap::operator=(MemoryMap&& other) noexcept {
+    if(this != &other) {
+        unmap_();
+        m_pbase_  = std::exchange(other.m_pbase_, nullptr);
+        m_shift_  = std::exchange(other.m_shift_, 0);
+        m_length_ = std::exchange(other.m_length_, 0);
+        m_mode_   = other.m_mode_;
+    }
+    return *this;
+}
+
+MemoryMap::~MemoryMap() noexcept { unmap_(); }
+
+void MemoryMap::advise(Advice advice, size_type offset, size_type length) {
+    if(offset > m_length_ || length > m_length_ - offset) {
+        throw std::out_of_range("MemoryMap::advise: region is not mapped");
+    }
+    if(length == 0) return;
+
+    // madvise wants a page-aligned start; widen the range to the page start
+    const auto begin   = m_shift_ + offset;
+    const auto aligned = begin - begin % page_size();
+    const auto n       = length + begin - aligned;
+    const auto rv      = ::posix_madvise(m_pbase_ + aligned, n,
+                                         posix_advice(advice));
+    if(rv != 0) {
+        throw std::system_error(rv, std::generic_category(),
+                                "MemoryMap::advise");
+    }
+}
+
+void MemoryMap::flush() {
+    if(m_pbase_ == nullptr || m_mode_ != Mode::read_write) return;
+    if(::msync(m_pbase_, m_length_ + m_shift_, MS_SYNC) != 0)
+        throw_errno("MemoryMap::flush");
+}
+
+void MemoryMap::unmap_() noexcept {
+    if(m_pbase_ != nullptr) ::munmap(m_pbase_, m_length_ + m_shift_);
+    m_pbase_  = nullptr;
+    m_shift_  = 0;
+    m_length_ = 0;
+}
+
+} // namespace wtf::io
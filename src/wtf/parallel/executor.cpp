@@ -0,0 +1,64 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <mutex>
+#include <utility>
+#include <wtf/parallel/executor.hpp>
+#include <wtf/parallel/thread_pool.hpp>
+
+namespace wtf::parallel {
+namespace {
+
+/// The executor installed with set_executor()
+struct InstalledExecutor {
+    std::mutex mutex;
+    std::shared_ptr<Executor> pexecutor;
+};
+
+InstalledExecutor& installed_() {
+    static InstalledExecutor installed;
+    return installed;
+}
+
+/// The installed executor, or a null pointer
+std::shared_ptr<Executor> installed_executor() noexcept {
+    auto& installed = installed_();
+    std::lock_guard lock(installed.mutex);
+    return installed.pexecutor;
+}
+
+} // namespace
+
+std::shared_ptr<Executor> executor() {
+    if(auto pexecutor = installed_executor()) return pexecutor;
+    return default_thread_pool();
+}
+
+void set_executor(std::shared_ptr<Executor> pexecutor) noexcept {
+    auto& installed = installed_();
+    {
+        std::lock_guard lock(installed.mutex);
+        installed.pexecutor.swap(pexecutor);
+    }
+    // The old executor is released here, without the lock
+}
+
+std::size_t max_threads() noexcept {
+    if(auto pexecutor = installed_executor()) return pexecutor->concurrency();
+    return default_thread_pool_options().resolved_n_threads();
+}
+
+} // namespace wtf::parallel
@@ -0,0 +1,337 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <pthread.h>
+#include <sched.h>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <wtf/parallel/thread_pool.hpp>
+
+namespace wtf::parallel {
+namespace detail_ {
+namespace {
+
+/// The pool the calling thread is a worker of, if any
+thread_local const PoolState* t_pstate = nullptr;
+
+/// Which worker of t_pstate the calling thread is
+thread_local std::size_t t_index = 0;
+
+/// The CPUs the process may run on, in increasing order
+std::vector<int> allowed_cpus() {
+    std::vector<int> cpus;
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if(::sched_getaffinity(0, sizeof(set), &set) != 0) return cpus;
+    for(int cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+        if(CPU_ISSET(cpu, &set)) cpus.push_back(cpu);
+#endif
+    return cpus;
+}
+
+/// Pins @p thread to @p cpu, returns false if that is not possible
+bool pin_thread(std::thread& thread, int cpu) noexcept {
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    const auto handle = thread.native_handle();
+    return ::pthread_setaffinity_np(handle, sizeof(set), &set) == 0;
+#else
+    static_cast<void>(thread);
+    static_cast<void>(cpu);
+    return false;
+#endif
+}
+
+} // namespace
+
+/** @brief Implements ThreadPool.
+ *
+ *  Each worker's queue is guarded by its own mutex, so workers only contend
+ *  when one steals from another. An idle worker sleeps on its own condition
+ *  variable until there is a task anywhere in the pool. A task pushed to a
+ *  busy worker's queue also wakes one idle worker, which steals it unless
+ *  the owner gets to it first.
+ */
+class PoolState {
+public:
+    using size_type = ThreadPool::size_type;
+    using task_type = ThreadPool::task_type;
+
+    explicit PoolState(ThreadPoolOptions options) :
+      m_options_(options), m_workers_(options.resolved_n_threads()) {
+        try {
+            for(size_type i = 0; i < m_workers_.size(); ++i)
+                m_workers_[i].thread = std::thread([this, i]() { work_(i); });
+        } catch(...) {
+            stop();
+            throw;
+        }
+
+        if(!m_options_.pin_threads) return;
+        const auto cpus = allowed_cpus();
+        m_is_pinned_    = !cpus.empty();
+        for(size_type i = 0; m_is_pinned_ && i < m_workers_.size(); ++i)
+            m_is_pinned_ = pin_thread(m_workers_[i].thread,
+                                      cpus[i % cpus.size()]);
+    }
+
+    ~PoolState() noexcept { stop(); }
+
+    /// Queues @p task with worker @p i
+    void push(size_type i, task_type task) {
+        auto& worker = m_workers_[i];
+        {
+            std::lock_guard lock(worker.mutex);
+            worker.tasks.push_back(std::move(task));
+            m_n_queued_.fetch_add(1, std::memory_order_relaxed);
+        }
+        worker.cv.notify_one();
+        if(worker.idle.load(std::memory_order_relaxed)) return;
+
+        for(auto& thief : m_workers_) {
+            if(!thief.idle.load(std::memory_order_relaxed)) continue;
+            // Taking the lock orders this with the thief's predicate check
+            {
+                std::lock_guard lock(thief.mutex);
+            }
+            thief.cv.notify_one();
+            return;
+        }
+    }
+
+    /// The worker a task without a hint should go to
+    size_type pick_worker() noexcept {
+        if(is_worker()) return t_index;
+        const auto n     = m_workers_.size();
+        const auto first = m_next_.fetch_add(1, std::memory_order_relaxed);
+        for(size_type j = 0; j < n; ++j) {
+            const auto i = (first + j) % n;
+            if(m_workers_[i].idle.load(std::memory_order_relaxed)) return i;
+        }
+        return first % n;
+    }
+
+    /// Runs one queued task on the calling thread, if there is one
+    bool run_one() noexcept {
+        auto task = is_worker() ? pop_(t_index) : steal_(0);
+        if(!task) return false;
+        (*task)();
+        return true;
+    }
+
+    /// Stops and joins the workers, then runs anything still queued
+    void stop() noexcept {
+        for(auto& worker : m_workers_) {
+            {
+                std::lock_guard lock(worker.mutex);
+                worker.stop = true;
+            }
+            worker.cv.notify_one();
+        }
+        for(auto& worker : m_workers_)
+            if(worker.thread.joinable()) worker.thread.join();
+        while(auto task = steal_(0)) (*task)();
+    }
+
+    bool is_worker() const noexcept { return t_pstate == this; }
+
+    size_type size() const noexcept { return m_workers_.size(); }
+
+    bool is_pinned() const noexcept { return m_is_pinned_; }
+
+    const ThreadPoolOptions& options() const noexcept { return m_options_; }
+
+private:
+    /// The state of one worker thread
+    struct Worker {
+        /// Guards tasks and stop
+        std::mutex mutex;
+
+        /// Signals that tasks or stop changed
+        std::condition_variable cv;
+
+        /// The worker's own queue, it pops from the back, thieves the front
+        std::deque<task_type> tasks;
+
+        /// Should the worker exit once its queue is empty?
+        bool stop = false;
+
+        /// Is the worker sleeping (or about to)?
+        std::atomic<bool> idle = false;
+
+        /// The worker itself
+        std::thread thread;
+    };
+
+    /// Pops the newest task of worker @p i, or steals one
+    std::optional<task_type> pop_(size_type i) noexcept {
+        auto& worker = m_workers_[i];
+        {
+            std::lock_guard lock(worker.mutex);
+            if(!worker.tasks.empty()) {
+                auto task = std::move(worker.tasks.back());
+                worker.tasks.pop_back();
+                m_n_queued_.fetch_sub(1, std::memory_order_relaxed);
+                return task;
+            }
+        }
+        return steal_(i + 1);
+    }
+
+    /// Takes the oldest task of the first non-empty queue after @p first
+    std::optional<task_type> steal_(size_type first) noexcept {
+        const auto n = m_workers_.size();
+        for(size_type j = 0; j < n; ++j) {
+            auto& victim = m_workers_[(first + j) % n];
+            std::lock_guard lock(victim.mutex);
+            if(victim.tasks.empty()) continue;
+            auto task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+            m_n_queued_.fetch_sub(1, std::memory_order_relaxed);
+            return task;
+        }
+        return std::nullopt;
+    }
+
+    /// Body of worker @p i
+    void work_(size_type i) {
+        t_pstate     = this;
+        t_index      = i;
+        auto& worker = m_workers_[i];
+        while(true) {
+            if(auto task = pop_(i)) {
+                (*task)();
+                continue;
+            }
+            std::unique_lock lock(worker.mutex);
+            worker.idle = true;
+            worker.cv.wait(lock, [&]() {
+                return worker.stop ||
+                       m_n_queued_.load(std::memory_order_relaxed) > 0;
+            });
+            worker.idle = false;
+            if(worker.stop && worker.tasks.empty()) return;
+        }
+    }
+
+    /// The options *this was set up with
+    ThreadPoolOptions m_options_;
+
+    /// Were all workers pinned?
+    bool m_is_pinned_ = false;
+
+    /// Round-robin counter for tasks submitted from outside the pool
+    std::atomic<size_type> m_next_ = 0;
+
+    /// Number of tasks sitting in the queues
+    std::atomic<size_type> m_n_queued_ = 0;
+
+    /// The workers
+    std::vector<Worker> m_workers_;
+};
+
+} // namespace detail_
+namespace {
+
+/// The default pool and the options it is created with
+struct DefaultPool {
+    std::mutex mutex;
+    ThreadPoolOptions options;
+    std::shared_ptr<ThreadPool> ppool;
+};
+
+DefaultPool& default_pool_() {
+    static DefaultPool pool;
+    return pool;
+}
+
+} // namespace
+
+ThreadPoolOptions::size_type ThreadPoolOptions::resolved_n_threads()
+  const noexcept {
+    if(n_threads > 0) return n_threads;
+    return std::max<size_type>(std::thread::hardware_concurrency(), 1);
+}
+
+ThreadPool::ThreadPool(options_type options) :
+  m_pstate_(std::make_unique<detail_::PoolState>(options)) {}
+
+ThreadPool::~ThreadPool() noexcept = default;
+
+ThreadPool::size_type ThreadPool::size() const noexcept {
+    return m_pstate_->size();
+}
+
+bool ThreadPool::is_pinned() const noexcept { return m_pstate_->is_pinned(); }
+
+const ThreadPool::options_type& ThreadPool::options() const noexcept {
+    return m_pstate_->options();
+}
+
+bool ThreadPool::is_worker() const noexcept {
+    return m_pstate_->is_worker();
+}
+
+void ThreadPool::submit_(task_type task) {
+    m_pstate_->push(m_pstate_->pick_worker(), std::move(task));
+}
+
+void ThreadPool::submit_to_(task_type task, size_type hint) {
+    m_pstate_->push(hint % m_pstate_->size(), std::move(task));
+}
+
+ThreadPool::size_type ThreadPool::concurrency_() const noexcept {
+    return size();
+}
+
+bool ThreadPool::run_pending_task_() noexcept { return m_pstate_->run_one(); }
+
+std::shared_ptr<ThreadPool> default_thread_pool() {
+    auto& pool = default_pool_();
+    std::lock_guard lock(pool.mutex);
+    if(!pool.ppool) pool.ppool = std::make_shared<ThreadPool>(pool.options);
+    return pool.ppool;
+}
+
+ThreadPoolOptions default_thread_pool_options() noexcept {
+    auto& pool = default_pool_();
+    std::lock_guard lock(pool.mutex);
+    return pool.options;
+}
+
+void set_default_thread_pool_options(ThreadPoolOptions options) noexcept {
+    auto& pool = default_pool_();
+    std::shared_ptr<ThreadPool> old;
+    {
+        std::lock_guard lock(pool.mutex);
+        if(pool.options == options) return;
+        pool.options = options;
+        old.swap(pool.ppool);
+    }
+    // Joins the old workers (if this was the last reference) without the lock
+}
+
+} // namespace wtf::parallel
@@ -0,0 +1,66 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "../../../test_wtf.hpp"
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <cstring>
+#include <limits>
+#include <wtf/buffer/copy_engine.hpp>
+#include <wtf/buffer/float_buffer.hpp>
+
+/* These benchmarks copy a 256 MiB buffer, i.e., a buffer which does not fit
+ * in cache. The serial case is what a plain std::memcpy (and hence the
+ * std::vector copy) achieves. The parallel and streaming cases should get
+ * closer to memory bandwidth on machines with several cores; streaming also
+ * avoids reading the destination into cache before overwriting it. The
+ * clone cases include allocating the destination. On a single core every
+ * case is a plain std::memcpy.
+ */
+
+using namespace wtf::buffer;
+
+TEST_CASE("Copying large buffers", "[benchmark]") {
+    const std::size_t n = std::size_t{1} << 25;
+    std::vector<double> src(n, 1.0);
+    std::vector<double> dst(n, 0.0);
+    const auto n_bytes  = n * sizeof(double);
+    const auto defaults = copy_options();
+
+    BENCHMARK("std::memcpy") {
+        std::memcpy(dst.data(), src.data(), n_bytes);
+        return dst[n - 1];
+    };
+
+    auto huge = std::numeric_limits<std::size_t>::max();
+    set_copy_options({.parallel_threshold = 0, .streaming_threshold = huge});
+    BENCHMARK("copy_bytes (parallel)") {
+        copy_bytes(dst.data(), src.data(), n_bytes);
+        return dst[n - 1];
+    };
+
+    set_copy_options({.parallel_threshold = 0, .streaming_threshold = 0});
+    BENCHMARK("copy_bytes (streaming)") {
+        copy_bytes(dst.data(), src.data(), n_bytes);
+        return dst[n - 1];
+    };
+    set_copy_options(defaults);
+
+    BENCHMARK("clone (std::vector)") { return std::vector<double>(src); };
+
+    FloatBuffer buffer(src);
+    BENCHMARK("clone (FloatBuffer)") { return FloatBuffer(buffer); };
+}
@@ -0,0 +1,74 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "../../../test_wtf.hpp"
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <random>
+#include <wtf/buffer/paged_buffer.hpp>
+
+/* These benchmarks gather randomly chosen elements from a 256 MiB buffer.
+ * With 4 KiB pages nearly every access misses the TLB. Huge pages cover the
+ * buffer with far fewer TLB entries, so the difference between the cases is
+ * the cost of the page walks. The indices are precomputed, so only the
+ * gather itself is timed. If huge pages are unavailable the buffers fall
+ * back to normal pages and the timings should match.
+ */
+
+using namespace wtf::buffer;
+using PageSize = PageAllocation::PageSize;
+
+namespace {
+
+/// Sums the elements of @p buffer at @p indices
+double gather(const FloatBuffer& buffer,
+              const std::vector<std::uint32_t>& indices) {
+    auto values = buffer.value<double>();
+    double rv   = 0.0;
+    for(auto i : indices) rv += values[i];
+    return rv;
+}
+
+} // namespace
+
+TEST_CASE("Random access with and without huge pages", "[benchmark]") {
+    const std::size_t n = std::size_t{1} << 25;
+
+    std::mt19937 engine(42);
+    std::uniform_int_distribution<std::uint32_t> dist(0, n - 1);
+    std::vector<std::uint32_t> indices(std::size_t{1} << 20);
+    for(auto& i : indices) i = dist(engine);
+
+    FloatBuffer vector_backed(std::vector<double>(n, 1.0));
+    BENCHMARK("gather (std::vector)") {
+        return gather(vector_backed, indices);
+    };
+
+    for(auto want : {PageSize::normal, PageSize::transparent_huge,
+                     PageSize::huge_2mb, PageSize::huge_1gb}) {
+        auto buffer = make_paged_float_buffer<double>(
+          n, {.page_size = want, .populate = true});
+        std::fill_n(buffer.value<double>().data(), n, 1.0);
+
+        const auto got = page_allocation(buffer).page_size();
+        const std::string names[] = {"normal", "transparent_huge", "huge_2mb",
+                                     "huge_1gb"};
+        BENCHMARK("gather (" + names[static_cast<int>(want)] + ", got " +
+                  names[static_cast<int>(got)] + ")") {
+            return gather(buffer, indices);
+        };
+    }
+}
@@ -0,0 +1,86 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "../../../test_wtf.hpp"
+#include <algorithm>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <random>
+#include <vector>
+#include <wtf/buffer/random_fill.hpp>
+
+/* These benchmarks fill a 256 MiB buffer of doubles and a 128 MiB buffer of
+ * floats. std::fill is the yardstick: it only writes memory, so a uniform
+ * fill at about its speed is bound by memory bandwidth, not by the random
+ * number generation. The std::mt19937_64 loop is the scalar, sequential fill
+ * random_fill replaces. The normal fills also evaluate a log, a square root
+ * and a sine/cosine pair per two values, which is the cost they add.
+ */
+
+using namespace wtf::buffer;
+
+TEST_CASE("Random fills", "[benchmark]") {
+    using tuple_type = wtf::default_fp_types;
+
+    const std::size_t n = std::size_t{1} << 25;
+    std::vector<double> values(n);
+    std::vector<float> fvalues(n);
+    BufferView view(values.data(), n);
+    BufferView fview(fvalues.data(), n);
+
+    BENCHMARK("std::fill (double)") {
+        std::fill(values.begin(), values.end(), 1.0);
+        return values[n / 2];
+    };
+
+    BENCHMARK("std::mt19937_64 loop (double)") {
+        std::mt19937_64 engine(42);
+        std::uniform_real_distribution<double> dist;
+        for(auto& x : values) x = dist(engine);
+        return values[n / 2];
+    };
+
+    BENCHMARK("uniform (double)") {
+        random_fill<tuple_type>(view, UniformDistribution{}, 42);
+        return values[n / 2];
+    };
+
+    BENCHMARK("uniform (double, seq)") {
+        random_fill<tuple_type>(view, UniformDistribution{}, 42,
+                                execution::seq);
+        return values[n / 2];
+    };
+
+    BENCHMARK("normal (double)") {
+        random_fill<tuple_type>(view, NormalDistribution{}, 42);
+        return values[n / 2];
+    };
+
+    BENCHMARK("std::fill (float)") {
+        std::fill(fvalues.begin(), fvalues.end(), 1.0f);
+        return fvalues[n / 2];
+    };
+
+    BENCHMARK("uniform (float)") {
+        random_fill<tuple_type>(fview, UniformDistribution{}, 42);
+        return fvalues[n / 2];
+    };
+
+    BENCHMARK("normal (float)") {
+        random_fill<tuple_type>(fview, NormalDistribution{}, 42);
+        return fvalues[n / 2];
+    };
+}
@@ -0,0 +1,92 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "../../../test_wtf.hpp"
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+#include <wtf/buffer/reductions.hpp>
+
+/* These benchmarks sum a 256 MiB buffer of doubles, i.e., a buffer which does
+ * not fit in cache, so every mode should be limited by memory bandwidth. The
+ * std::accumulate case is a strictly sequential loop, which the compiler can
+ * not vectorize. The reproducible mode additionally stores one partial sum
+ * per 4096 elements and adds them up at the end; its cost relative to the
+ * fast mode is what bitwise reproducibility costs. The "in cache" cases
+ * repeat the comparison for a 256 KiB buffer, where the reductions are
+ * limited by the adds instead.
+ *
+ * The accumulation cases compare the Accumulation modes on the in-cache
+ * buffer, where their extra arithmetic is not hidden behind memory traffic.
+ * Pairwise should cost about the same as naive, neumaier and double_double
+ * a small multiple of it.
+ */
+
+using namespace wtf::buffer;
+
+TEST_CASE("Summing buffers", "[benchmark]") {
+    using tuple_type = wtf::default_fp_types;
+
+    const std::size_t n = std::size_t{1} << 25;
+    std::vector<double> values(n);
+    for(std::size_t i = 0; i < n; ++i) values[i] = 1.0 / (1.0 + i % 1000);
+    FloatBuffer buffer(values);
+
+    BENCHMARK("std::accumulate") {
+        return std::accumulate(values.begin(), values.end(), 0.0);
+    };
+
+    BENCHMARK("sum (fast)") {
+        return sum<tuple_type>(buffer, ReductionMode::fast);
+    };
+
+    BENCHMARK("sum (reproducible)") {
+        return sum<tuple_type>(buffer, ReductionMode::reproducible);
+    };
+
+    BENCHMARK("sum (reproducible, seq)") {
+        return sum<tuple_type>(buffer, ReductionMode::reproducible,
+                               execution::seq);
+    };
+
+    FloatBuffer small(std::vector<double>(values.begin(),
+                                          values.begin() + (1 << 15)));
+
+    BENCHMARK("sum in cache (fast)") {
+        return sum<tuple_type>(small, ReductionMode::fast);
+    };
+
+    BENCHMARK("sum in cache (reproducible)") {
+        return sum<tuple_type>(small, ReductionMode::reproducible);
+    };
+
+    for(auto [name, acc] :
+        {std::pair{"naive", Accumulation::naive},
+         std::pair{"pairwise", Accumulation::pairwise},
+         std::pair{"neumaier", Accumulation::neumaier},
+         std::pair{"double_double", Accumulation::double_double}}) {
+        const ReductionOptions opts(ReductionMode::reproducible, acc);
+        BENCHMARK(std::string("sum in cache (") + name + ")") {
+            return sum<tuple_type>(small, opts);
+        };
+        BENCHMARK(std::string("dot in cache (") + name + ")") {
+            return dot<tuple_type>(small, small, opts);
+        };
+    }
+}
@@ -0,0 +1,71 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "../../../test_wtf.hpp"
+#include <algorithm>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <cmath>
+#include <numeric>
+#include <vector>
+#include <wtf/buffer/reductions.hpp>
+#include <wtf/buffer/statistics.hpp>
+
+/* These benchmarks describe a 256 MiB buffer of doubles. "sum (fast)" is one
+ * parallel read pass and is the yardstick for statistics, which reads the
+ * buffer once too. "separate passes" is what statistics replaces: a scalar
+ * pass each for the mean, the variance, the range and the histogram. The
+ * histogram has 100 bins; counting is a scatter, so it adds a scalar
+ * increment per element to the vectorized statistics.
+ */
+
+using namespace wtf::buffer;
+
+TEST_CASE("Describing buffers", "[benchmark]") {
+    using tuple_type = wtf::default_fp_types;
+
+    const std::size_t n = std::size_t{1} << 25;
+    std::vector<double> values(n);
+    for(std::size_t i = 0; i < n; ++i) values[i] = 1.0 / (1.0 + i % 1000);
+    FloatBuffer buffer(values);
+
+    BENCHMARK("sum (fast)") { return sum<tuple_type>(buffer); };
+
+    BENCHMARK("separate passes") {
+        const auto mean = std::accumulate(values.begin(), values.end(), 0.0) /
+                          static_cast<double>(n);
+        double m2 = 0.0;
+        for(auto x : values) m2 += (x - mean) * (x - mean);
+        auto [min, max] = std::minmax_element(values.begin(), values.end());
+        std::vector<std::size_t> bins(100);
+        for(auto x : values) {
+            const auto bin = static_cast<std::size_t>(x * 100.0);
+            ++bins[std::min<std::size_t>(bin, 99)];
+        }
+        return m2 + *min + *max + static_cast<double>(bins[0]);
+    };
+
+    BENCHMARK("statistics") { return statistics<tuple_type>(buffer).m2; };
+
+    BENCHMARK("statistics (seq)") {
+        return statistics<tuple_type>(buffer, execution::seq).m2;
+    };
+
+    BENCHMARK("statistics with histogram") {
+        Histogram histogram(0.0, 1.0, 100);
+        return statistics<tuple_type>(buffer, histogram).m2;
+    };
+}
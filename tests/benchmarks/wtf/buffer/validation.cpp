@@ -0,0 +1,67 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../../test_wtf.hpp"
+#include <algorithm>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <cmath>
+#include <vector>
+#include <wtf/buffer/reductions.hpp>
+#include <wtf/buffer/validation.hpp>
+
+/* These benchmarks scan a 256 MiB buffer of finite doubles, so no scan can
+ * stop early. "sum (fast)" is one parallel read pass and is the yardstick:
+ * the checks classify elements with integer operations on their bits, so
+ * they should run at about the same speed (i.e., be bound by memory
+ * bandwidth, not by the checks). The std::isfinite loop is the scalar check
+ * the validation functions replace.
+ */
+
+using namespace wtf::buffer;
+
+TEST_CASE("Validating buffers", "[benchmark]") {
+    using tuple_type = wtf::default_fp_types;
+
+    const std::size_t n = std::size_t{1} << 25;
+    std::vector<double> values(n);
+    for(std::size_t i = 0; i < n; ++i) values[i] = 1.0 / (1.0 + i % 1000);
+    FloatBuffer buffer(values);
+
+    BENCHMARK("sum (fast)") { return sum<tuple_type>(buffer); };
+
+    BENCHMARK("std::isfinite loop") {
+        return std::all_of(values.begin(), values.end(),
+                           [](double x) { return std::isfinite(x); });
+    };
+
+    BENCHMARK("has_nonfinite") { return has_nonfinite<tuple_type>(buffer); };
+
+    BENCHMARK("has_nonfinite (seq)") {
+        return has_nonfinite<tuple_type>(buffer, execution::seq);
+    };
+
+    BENCHMARK("count_nonfinite") {
+        return count_nonfinite<tuple_type>(buffer);
+    };
+
+    BENCHMARK("find_first_nonfinite") {
+        return find_first_nonfinite<tuple_type>(buffer);
+    };
+
+    BENCHMARK("count_subnormal") {
+        return count_subnormal<tuple_type>(buffer);
+    };
+}
@@ -0,0 +1,72 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../../test_wtf.hpp"
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <cmath>
+#include <span>
+#include <vector>
+#include <wtf/fp/convert.hpp>
+
+/* These benchmarks narrow 1 Mi doubles to float and to Half, rounding to
+ * nearest, saturating, and rounding stochastically. Round-to-nearest is the
+ * baseline; double -> float is a single instruction per element, so it runs
+ * at memory speed. Saturation adds a clamp per element and should cost
+ * little over the baseline. Stochastic rounding also computes a
+ * Philox2x32-10 random number per element (ten 32x32->64-bit multiplies), so
+ * it is compute-bound. That cost is the price of the random numbers and is
+ * about the same for every output type.
+ */
+
+using namespace wtf::fp;
+
+TEST_CASE("Narrowing conversions", "[benchmark]") {
+    const std::size_t n = std::size_t{1} << 20;
+    std::vector<double> values(n);
+    for(std::size_t i = 0; i < n; ++i)
+        values[i] = std::sin(static_cast<double>(i)) * 100.0;
+    std::span<const double> in(values);
+    std::vector<float> floats(n);
+    std::vector<Half> halves(n);
+
+    const ConvertOptions saturate{.saturate = true};
+    const ConvertOptions stochastic{.stochastic = true, .seed = 1};
+
+    BENCHMARK("double -> float (nearest)") {
+        convert(in, std::span(floats), ConvertOptions{});
+        return floats[0];
+    };
+
+    BENCHMARK("double -> float (stochastic)") {
+        convert(in, std::span(floats), stochastic);
+        return floats[0];
+    };
+
+    BENCHMARK("double -> Half (nearest)") {
+        convert(in, std::span(halves));
+        return halves[0].bits();
+    };
+
+    BENCHMARK("double -> Half (saturate)") {
+        convert(in, std::span(halves), saturate);
+        return halves[0].bits();
+    };
+
+    BENCHMARK("double -> Half (stochastic)") {
+        convert(in, std::span(halves), stochastic);
+        return halves[0].bits();
+    };
+}
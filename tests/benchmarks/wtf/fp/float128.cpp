@@ -0,0 +1,78 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../../test_wtf.hpp"
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <wtf/buffer/float_buffer.hpp>
+#include <wtf/fp/float128.hpp>
+
+/* These benchmarks compare the cost of the basic buffer kernels (a reduction
+ * and an element-wise update) for double, long double, and, if available,
+ * __float128. All three go through the same visit_contiguous_buffer dispatch,
+ * so the differences are the cost of the arithmetic.
+ */
+
+using wtf::buffer::FloatBuffer;
+using wtf::buffer::visit_contiguous_buffer;
+
+namespace {
+
+#ifdef WTF_HAS_FLOAT128
+using benchmark_types = std::tuple<double, long double, __float128>;
+#else
+using benchmark_types = std::tuple<double, long double>;
+#endif
+
+/// Sums the elements, returning the result as a long double
+struct Sum {
+    template<typename SpanType>
+    long double operator()(SpanType&& values) const {
+        using value_type = std::decay_t<decltype(values[0])>;
+        value_type rv{0};
+        for(const auto& x : values) rv += x;
+        return static_cast<long double>(rv);
+    }
+};
+
+/// Computes y = a * y + 1 element-wise
+struct Update {
+    template<typename SpanType>
+    void operator()(SpanType&& values) const {
+        using reference = decltype(values[0]);
+        if constexpr(!std::is_const_v<std::remove_reference_t<reference>>) {
+            using value_type = std::decay_t<reference>;
+            for(auto& x : values) x = value_type{0.5} * x + value_type{1};
+        }
+    }
+};
+
+} // namespace
+
+TEMPLATE_LIST_TEST_CASE("float128 vs long double", "[benchmark]",
+                        benchmark_types) {
+    const std::size_t n = 1 << 14;
+    FloatBuffer buffer(std::vector<TestType>(n, TestType{1.0001}));
+    const auto name = std::string(wtf::type_traits::type_name_v<TestType>);
+
+    BENCHMARK("sum (" + name + ")") {
+        return visit_contiguous_buffer<benchmark_types>(Sum{}, buffer);
+    };
+
+    BENCHMARK("update (" + name + ")") {
+        visit_contiguous_buffer<benchmark_types>(Update{}, buffer);
+        return buffer.size();
+    };
+}
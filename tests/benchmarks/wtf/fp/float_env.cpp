@@ -0,0 +1,71 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../../test_wtf.hpp"
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <vector>
+#include <wtf/buffer/reductions.hpp>
+#include <wtf/fp/float_env.hpp>
+
+/* These benchmarks run reductions over 1 Mi doubles whose arithmetic
+ * underflows, with and without flushing denormals to zero. "dot" squares
+ * values around 1e-160, so every product is subnormal; "sum" adds values
+ * around 1e-310, so every operand is. The "normal" case is the same dot over
+ * values around 1, i.e., what the kernel costs without subnormals. On x86 a
+ * multiplication with a subnormal result takes a microcode assist of order
+ * 100 cycles, and flushing should bring dot back to the normal case. Recent
+ * x86 cores add subnormals at full speed, so the sum cases show whether the
+ * machine at hand does.
+ */
+
+using namespace wtf::buffer;
+
+TEST_CASE("Subnormal arithmetic", "[benchmark]") {
+    using tuple_type = wtf::default_fp_types;
+
+    const std::size_t n = std::size_t{1} << 20;
+    std::vector<double> values(n), tiny(n), denormal(n);
+    for(std::size_t i = 0; i < n; ++i) {
+        values[i]   = 1.0 + static_cast<double>(i % 1000) / 1000.0;
+        tiny[i]     = values[i] * 1.0e-160;
+        denormal[i] = values[i] * 1.0e-310;
+    }
+    FloatBuffer normal_buffer(values), tiny_buffer(tiny);
+    FloatBuffer denormal_buffer(denormal);
+
+    const ExecutionPolicy plain = execution::par;
+    const ExecutionPolicy flush(0, 0, wtf::fp::FloatEnv::flush_denormals());
+
+    BENCHMARK("dot (normal)") {
+        return dot<tuple_type>(normal_buffer, normal_buffer, {}, plain);
+    };
+
+    BENCHMARK("dot (subnormal products)") {
+        return dot<tuple_type>(tiny_buffer, tiny_buffer, {}, plain);
+    };
+
+    BENCHMARK("dot (subnormal products, flushed)") {
+        return dot<tuple_type>(tiny_buffer, tiny_buffer, {}, flush);
+    };
+
+    BENCHMARK("sum (subnormal operands)") {
+        return sum<tuple_type>(denormal_buffer, {}, plain);
+    };
+
+    BENCHMARK("sum (subnormal operands, flushed)") {
+        return sum<tuple_type>(denormal_buffer, {}, flush);
+    };
+}
@@ -17,7 +17,11 @@
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_template_test_macros.hpp>
 #include <catch2/catch_test_macros.hpp>
+#include <filesystem>
+#include <memory>
 #include <string>
+#include <wtf/buffer/copy_engine.hpp>
+#include <wtf/parallel/executor.hpp>
 #include <wtf/type_traits/type_traits.hpp>
 #include <wtf/types.hpp>
 
@@ -29,6 +33,42 @@ using default_fp_types = wtf::default_fp_types;
 /// Some types that C++20 by default does not consider floating point types
 using not_fp_types = std::tuple<char, bool, std::string>;
 
+/// Routes even tiny copies through the threaded copy engine while alive
+class ForceCopyEngine {
+public:
+    explicit ForceCopyEngine(std::size_t streaming_threshold = 0) :
+      m_old_(wtf::buffer::copy_options()) {
+        wtf::buffer::CopyOptions options;
+        options.parallel_threshold   = 0;
+        options.streaming_threshold  = streaming_threshold;
+        options.min_bytes_per_thread = 1;
+        options.max_threads          = 2;
+        wtf::buffer::set_copy_options(options);
+    }
+    ForceCopyEngine(const ForceCopyEngine&)            = delete;
+    ForceCopyEngine& operator=(const ForceCopyEngine&) = delete;
+    ~ForceCopyEngine() { wtf::buffer::set_copy_options(m_old_); }
+
+private:
+    wtf::buffer::CopyOptions m_old_;
+};
+
+/// Makes WTF's kernels run on the given executor while alive
+class UseExecutor {
+public:
+    explicit UseExecutor(std::shared_ptr<wtf::parallel::Executor> pexecutor) {
+        wtf::parallel::set_executor(std::move(pexecutor));
+    }
+    UseExecutor(const UseExecutor&)            = delete;
+    UseExecutor& operator=(const UseExecutor&) = delete;
+    ~UseExecutor() { wtf::parallel::set_executor(nullptr); }
+};
+
+/// Path to a scratch file for tests which need to do I/O
+inline std::filesystem::path scratch_file(const std::string& name) {
+    return std::filesystem::temp_directory_path() / ("wtf_test_" + name);
+}
+
 /// To test custom floating point support we will define a simple FP type
 class MyCustomFloat {
 public:
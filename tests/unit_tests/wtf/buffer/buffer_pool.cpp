@@ -0,0 +1,166 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "../../../test_wtf.hpp"
+#include <thread>
+#include <wtf/buffer/buffer_pool.hpp>
+#include <wtf/buffer/compressed_buffer.hpp>
+
+using namespace wtf::buffer;
+
+TEMPLATE_LIST_TEST_CASE("BufferPool", "[wtf]", test_wtf::default_fp_types) {
+    using tuple_type  = test_wtf::default_fp_types;
+    using vector_type = std::vector<TestType>;
+    constexpr auto nbytes = 128 * sizeof(TestType);
+
+    BufferPool pool;
+
+    SECTION("acquire") {
+        FloatBuffer buffer = pool.acquire<TestType>(100);
+        REQUIRE(buffer == FloatBuffer(vector_type(100)));
+        REQUIRE(pool.stats().acquires == 1);
+        REQUIRE(pool.stats().hits == 0);
+
+        REQUIRE(pool.acquire<TestType>(0).size() == 0);
+        REQUIRE(pool.stats().acquires == 1);
+    }
+
+    SECTION("release/acquire reuses the memory") {
+        FloatBuffer buffer = pool.acquire<TestType>(100);
+        auto* p     = buffer.value<TestType>().data();
+        buffer.value<TestType>()[0] = TestType{1.0};
+        pool.release<tuple_type>(std::move(buffer));
+
+        auto stats = pool.stats();
+        REQUIRE(stats.releases == 1);
+        REQUIRE(stats.buffers_retained == 1);
+        REQUIRE(stats.bytes_retained == nbytes);
+
+        SECTION("Same size class, zeroed") {
+            FloatBuffer reused = pool.acquire<TestType>(128);
+            REQUIRE(reused.value<TestType>().data() == p);
+            REQUIRE(reused == FloatBuffer(vector_type(128)));
+            stats = pool.stats();
+            REQUIRE(stats.hits == 1);
+            REQUIRE(stats.hit_rate() == 0.5);
+            REQUIRE(stats.buffers_retained == 0);
+            REQUIRE(stats.bytes_retained == 0);
+        }
+
+        SECTION("Without zeroing") {
+            FloatBuffer reused = pool.acquire<TestType>(65, false);
+            REQUIRE(reused.value<TestType>().data() == p);
+            REQUIRE(reused.size() == 65);
+            REQUIRE(reused.value<TestType>()[0] == TestType{1.0});
+        }
+
+        SECTION("Other size classes and types miss") {
+            FloatBuffer larger = pool.acquire<TestType>(129);
+            REQUIRE(larger.value<TestType>().data() != p);
+            FloatBuffer smaller = pool.acquire<TestType>(64);
+            REQUIRE(smaller.value<TestType>().data() != p);
+            constexpr bool is_float = std::is_same_v<TestType, float>;
+            using other_t = std::conditional_t<is_float, double, float>;
+            pool.acquire<other_t>(100);
+            REQUIRE(pool.stats().hits == 0);
+        }
+    }
+
+    SECTION("Steady state does not allocate") {
+        for(std::size_t i = 0; i < 10; ++i) {
+            FloatBuffer buffer = pool.acquire<TestType>(1000, false);
+            pool.release<tuple_type>(std::move(buffer));
+        }
+        auto stats = pool.stats();
+        REQUIRE(stats.hits == 9);
+        REQUIRE(stats.buffers_retained == 1);
+    }
+
+    SECTION("Buffers which do not own their memory are discarded") {
+        pool.release<tuple_type>(FloatBuffer{});
+        FloatBuffer buffer(vector_type(10));
+        auto compressed = compress_float_buffer<tuple_type>(buffer);
+        pool.release<tuple_type>(std::move(compressed));
+        REQUIRE(pool.stats().discards == 2);
+        REQUIRE(pool.stats().buffers_retained == 0);
+    }
+
+    SECTION("max_retained_bytes") {
+        BufferPool small({.max_retained_bytes = nbytes});
+        small.release<tuple_type>(small.acquire<TestType>(100));
+        small.release<tuple_type>(small.acquire<TestType>(100));
+        small.release<tuple_type>(small.acquire<TestType>(100));
+        // The second acquire hit, the third had to allocate
+        auto stats = small.stats();
+        REQUIRE(stats.buffers_retained == 1);
+        REQUIRE(stats.bytes_retained == nbytes);
+    }
+
+    SECTION("trim") {
+        pool.release<tuple_type>(pool.acquire<TestType>(100));
+        pool.release<tuple_type>(pool.acquire<TestType>(1000));
+        pool.trim(nbytes);
+        auto stats = pool.stats();
+        REQUIRE(stats.buffers_retained == 1);
+        REQUIRE(stats.bytes_retained == nbytes);
+        REQUIRE(stats.discards == 1);
+
+        pool.trim();
+        REQUIRE(pool.stats().bytes_retained == 0);
+    }
+
+    SECTION("Move") {
+        pool.release<tuple_type>(pool.acquire<TestType>(100));
+        BufferPool moved(std::move(pool));
+        REQUIRE(moved.stats().buffers_retained == 1);
+
+        // The moved-from pool retains nothing, but still works
+        REQUIRE(pool.stats().buffers_retained == 0);
+        FloatBuffer buffer = pool.acquire<TestType>(100);
+        REQUIRE(buffer == FloatBuffer(vector_type(100)));
+        pool.release<tuple_type>(std::move(buffer));
+        REQUIRE(pool.stats().acquires == 0);
+        REQUIRE(pool.stats().buffers_retained == 0);
+        REQUIRE_NOTHROW(pool.trim());
+
+        pool = std::move(moved);
+        REQUIRE(pool.stats().buffers_retained == 1);
+        REQUIRE(moved.stats().buffers_retained == 0);
+    }
+
+    SECTION("Thread safety") {
+        auto worker = [&]() {
+            for(std::size_t i = 0; i < 100; ++i)
+                pool.release<tuple_type>(pool.acquire<TestType>(100));
+        };
+        {
+            std::jthread t0(worker), t1(worker);
+        }
+        auto stats = pool.stats();
+        REQUIRE(stats.acquires == 200);
+        REQUIRE(stats.releases == 200);
+        REQUIRE(stats.buffers_retained <= 2);
+    }
+
+    SECTION("Size classes") {
+        REQUIRE(BufferPool::request_class(1) == 0);
+        REQUIRE(BufferPool::request_class(128) == 7);
+        REQUIRE(BufferPool::request_class(129) == 8);
+        REQUIRE(BufferPool::capacity_class(128) == 7);
+        REQUIRE(BufferPool::capacity_class(255) == 7);
+    }
+}
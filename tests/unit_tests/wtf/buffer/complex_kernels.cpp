@@ -0,0 +1,167 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../../test_wtf.hpp"
+#include <limits>
+#include <span>
+#include <wtf/buffer/complex_kernels.hpp>
+#include <wtf/types.hpp>
+
+using namespace wtf::buffer;
+
+namespace {
+
+using tuple_type = wtf::type_traits::tuple_append_t<wtf::default_fp_types,
+                                                     wtf::complex_fp_types>;
+
+} // namespace
+
+TEMPLATE_LIST_TEST_CASE("complex_kernels", "[wtf]",
+                        test_wtf::default_fp_types) {
+    using complex_type = std::complex<TestType>;
+    using real_vector  = std::vector<TestType>;
+    using complex_vec  = std::vector<complex_type>;
+
+    FloatBuffer real(real_vector{-1.0, 2.0, -3.0});
+    FloatBuffer cmplx(complex_vec{{3.0, 4.0}, {0.0, -1.0}, {-2.0, 0.0}});
+
+    SECTION("conj") {
+        conj<tuple_type>(cmplx);
+        REQUIRE(cmplx ==
+                FloatBuffer(complex_vec{{3.0, -4.0}, {0.0, 1.0}, {-2.0, 0.0}}));
+
+        conj<tuple_type>(real);
+        REQUIRE(real == FloatBuffer(real_vector{-1.0, 2.0, -3.0}));
+    }
+
+    SECTION("abs") {
+        REQUIRE(abs<tuple_type>(cmplx) ==
+                FloatBuffer(real_vector{5.0, 1.0, 2.0}));
+        REQUIRE(abs<tuple_type>(real) ==
+                FloatBuffer(real_vector{1.0, 2.0, 3.0}));
+    }
+
+    SECTION("dot") {
+        // |3+4i|^2 + |-i|^2 + |-2|^2
+        const auto norm2 = dot<tuple_type>(cmplx, cmplx);
+        REQUIRE(norm2 == wtf::fp::Float(complex_type{30.0, 0.0}));
+
+        FloatBuffer other(complex_vec{{0.0, 1.0}, {1.0, 0.0}, {0.0, 0.0}});
+        // conj(3+4i) * i + conj(-i) * 1 = (4+3i) + i
+        REQUIRE(dot<tuple_type>(cmplx, other) ==
+                wtf::fp::Float(complex_type{4.0, 4.0}));
+
+        REQUIRE(dot<tuple_type>(real, real) == wtf::fp::Float(TestType{14.0}));
+
+        SECTION("Throws if types differ") {
+            REQUIRE_THROWS_AS(dot<tuple_type>(real, cmplx),
+                              std::invalid_argument);
+        }
+
+        SECTION("Throws if sizes differ") {
+            FloatBuffer shorter(real_vector{1.0});
+            REQUIRE_THROWS_AS(dot<tuple_type>(real, shorter),
+                              std::invalid_argument);
+        }
+    }
+
+    SECTION("convert_float_buffer") {
+        auto promoted = convert_float_buffer<complex_type, tuple_type>(real);
+        REQUIRE(promoted ==
+                FloatBuffer(complex_vec{{-1.0, 0.0}, {2.0, 0.0}, {-3.0, 0.0}}));
+
+        using cfloat = std::complex<float>;
+        auto narrowed = convert_float_buffer<cfloat, tuple_type>(cmplx);
+        REQUIRE(narrowed == FloatBuffer(std::vector<cfloat>{
+                              {3.0f, 4.0f}, {0.0f, -1.0f}, {-2.0f, 0.0f}}));
+
+        auto widened = convert_float_buffer<double, tuple_type>(real);
+        REQUIRE(widened == FloatBuffer(std::vector<double>{-1.0, 2.0, -3.0}));
+
+        SECTION("Throws if imaginary parts would be dropped") {
+            auto to_real = [&]() {
+                return convert_float_buffer<TestType, tuple_type>(cmplx);
+            };
+            REQUIRE_THROWS_AS(to_real(), std::invalid_argument);
+        }
+    }
+}
+
+TEST_CASE("convert_float_buffer with ConvertOptions") {
+    using wtf::fp::ConvertOptions;
+    using wtf::fp::Half;
+    using cdouble = std::complex<double>;
+    using cfloat  = std::complex<float>;
+    using tuple   = std::tuple<double, cdouble, Half, float>;
+
+    const auto big   = 1e300;
+    const auto third = 1.0 / 3.0;
+    FloatBuffer real(std::vector<double>{third, big});
+    FloatBuffer cmplx(std::vector<cdouble>{{third, -big}, {big, 1.0}});
+    const ConvertOptions saturate{.saturate = true};
+    const auto fmax   = std::numeric_limits<float>::max();
+    const auto fthird = static_cast<float>(third);
+
+    SECTION("Narrowing uses fp::convert") {
+        auto narrowed = convert_float_buffer<float, tuple>(real, saturate);
+        REQUIRE(narrowed == FloatBuffer(std::vector<float>{fthird, fmax}));
+
+        auto cnarrowed = convert_float_buffer<cfloat, tuple>(cmplx, saturate);
+        std::vector<cfloat> corr{{fthird, -fmax}, {fmax, 1.0f}};
+        REQUIRE(cnarrowed == FloatBuffer(corr));
+
+        auto half = convert_float_buffer<Half, tuple>(real, saturate);
+        std::vector<Half> half_corr{Half(third), Half(65504.0)};
+        REQUIRE(half == FloatBuffer(std::move(half_corr)));
+    }
+
+    SECTION("Stochastic rounding matches fp::convert") {
+        const ConvertOptions options{.stochastic = true, .seed = 3};
+        std::vector<cdouble> values(100, {third, -third});
+        std::vector<float> parts(200);
+        wtf::fp::convert(std::span<const double>(
+                           reinterpret_cast<const double*>(values.data()), 200),
+                         std::span(parts), options);
+
+        FloatBuffer buffer(std::move(values));
+        auto rounded = convert_float_buffer<cfloat, tuple>(buffer, options);
+        std::vector<cfloat> corr(100);
+        for(std::size_t i = 0; i < 100; ++i)
+            corr[i] = {parts[2 * i], parts[2 * i + 1]};
+        REQUIRE(rounded == FloatBuffer(std::move(corr)));
+    }
+
+    SECTION("Exact conversions ignore the options") {
+        FloatBuffer floats(std::vector<float>{1.5f, 2.0f});
+        auto widened = convert_float_buffer<double, tuple>(floats, saturate);
+        REQUIRE(widened == FloatBuffer(std::vector<double>{1.5, 2.0}));
+
+        FloatBuffer halves(std::vector<Half>{Half(1.5), Half(2.0)});
+        auto from_half = convert_float_buffer<float, tuple>(halves, saturate);
+        REQUIRE(from_half == FloatBuffer(std::vector<float>{1.5f, 2.0f}));
+    }
+
+    SECTION("Throws if the options are not supported") {
+        auto to_complex = [&]() {
+            return convert_float_buffer<cfloat, tuple>(real, saturate);
+        };
+        REQUIRE_THROWS_AS(to_complex(), std::invalid_argument);
+
+        // Without rounding options it is a plain conversion
+        auto promoted = convert_float_buffer<cfloat, tuple>(real, {});
+        REQUIRE(promoted == convert_float_buffer<cfloat, tuple>(real));
+    }
+}
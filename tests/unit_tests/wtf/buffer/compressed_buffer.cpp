@@ -0,0 +1,139 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../../test_wtf.hpp"
+#include <wtf/buffer/compressed_buffer.hpp>
+
+using namespace wtf::buffer;
+using namespace test_wtf;
+
+TEMPLATE_LIST_TEST_CASE("compressed_buffer", "[wtf]", default_fp_types) {
+    using vector_type = std::vector<TestType>;
+    vector_type values(100, TestType{1.0});
+    for(std::size_t i = 50; i < 60; ++i) values[i] = static_cast<TestType>(i);
+
+    FloatBuffer in_memory(values);
+    CompressionOptions options{.block_size = 16, .cache_capacity = 2};
+    FloatBuffer compressed =
+      compress_float_buffer<default_fp_types>(in_memory, options);
+
+    SECTION("compress_float_buffer") {
+        REQUIRE(is_compressed(compressed));
+        REQUIRE(compressed.size() == 100);
+        for(std::size_t i = 0; i < values.size(); ++i)
+            REQUIRE(compressed.at(i) == values[i]);
+
+        REQUIRE(compress_float_buffer<default_fp_types>(FloatBuffer{}) ==
+                FloatBuffer{});
+
+        SECTION("Throws if type is not in tuple") {
+            constexpr bool is_float = std::is_same_v<TestType, float>;
+            using other_t     = std::conditional_t<is_float, double, float>;
+            using other_tuple = std::tuple<other_t>;
+            REQUIRE_THROWS_AS(compress_float_buffer<other_tuple>(in_memory),
+                              std::runtime_error);
+        }
+
+        SECTION("Throws if type is not trivially copyable") {
+            using custom_tuple = std::tuple<MyCustomFloat>;
+            FloatBuffer custom(std::vector<MyCustomFloat>(3));
+            REQUIRE_THROWS_AS(compress_float_buffer<custom_tuple>(custom),
+                              std::runtime_error);
+        }
+    }
+
+    SECTION("Writes through at()") {
+        compressed.at(3) = TestType{42.0};
+        for(std::size_t i = 0; i < values.size(); ++i) compressed.at(i);
+        REQUIRE(compressed.at(3) == TestType{42.0});
+    }
+
+    SECTION("Copies are compressed") {
+        FloatBuffer copy(compressed);
+        REQUIRE(is_compressed(copy));
+        REQUIRE(copy == compressed);
+        REQUIRE_FALSE(copy == in_memory);
+    }
+
+    SECTION("Views") {
+        BufferView<const wtf::fp::Float> view(compressed);
+        REQUIRE(view.size() == 100);
+        REQUIRE(view.at(55) == TestType{55.0});
+        REQUIRE_FALSE(view.is_contiguous());
+    }
+
+    SECTION("decompress_float_buffer") {
+        FloatBuffer decompressed =
+          decompress_float_buffer<default_fp_types>(compressed);
+        REQUIRE_FALSE(is_compressed(decompressed));
+        REQUIRE(decompressed == in_memory);
+        REQUIRE(decompress_float_buffer<default_fp_types>(in_memory) ==
+                in_memory);
+        REQUIRE(decompress_float_buffer<default_fp_types>(FloatBuffer{}) ==
+                FloatBuffer{});
+    }
+
+    SECTION("visit_buffer_chunks") {
+        std::vector<std::size_t> sizes;
+        vector_type seen;
+        auto reader = [&](auto span) {
+            sizes.push_back(span.size());
+            seen.insert(seen.end(), span.begin(), span.end());
+        };
+
+        SECTION("Compressed") {
+            const auto& ccompressed = compressed;
+            visit_buffer_chunks<default_fp_types>(reader, ccompressed);
+            REQUIRE(sizes.size() == 7);
+            REQUIRE(sizes.back() == 4);
+            REQUIRE(seen == values);
+        }
+
+        SECTION("Read-only") {
+            read_buffer_chunks<default_fp_types>(reader, compressed);
+            REQUIRE(sizes.size() == 7);
+            REQUIRE(seen == values);
+        }
+
+        SECTION("Contiguous") {
+            visit_buffer_chunks<default_fp_types>(reader, in_memory);
+            REQUIRE(sizes == std::vector<std::size_t>{100});
+            REQUIRE(seen == values);
+        }
+
+        SECTION("Writes") {
+            auto doubler = [](auto span) {
+                using element_type = typename decltype(span)::element_type;
+                if constexpr(!std::is_const_v<element_type>)
+                    for(auto& x : span) x *= 2;
+            };
+            visit_buffer_chunks<default_fp_types>(doubler, compressed);
+            for(auto& x : values) x *= 2;
+            REQUIRE(decompress_float_buffer<default_fp_types>(compressed) ==
+                    FloatBuffer(values));
+        }
+    }
+
+    SECTION("compressed_size") {
+        REQUIRE(compressed_size(compressed) < values.size() * sizeof(TestType));
+        REQUIRE_THROWS_AS(compressed_size(in_memory), std::runtime_error);
+    }
+
+    SECTION("is_compressed") {
+        REQUIRE_FALSE(is_compressed(in_memory));
+        REQUIRE_FALSE(is_compressed(FloatBuffer{}));
+    }
+}
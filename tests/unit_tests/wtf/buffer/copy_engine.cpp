@@ -0,0 +1,123 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "../../../test_wtf.hpp"
+#include <limits>
+#include <numeric>
+#include <vector>
+#include <wtf/buffer/copy_engine.hpp>
+
+using namespace wtf::buffer;
+
+namespace {
+
+/// Copies @p n bytes to @p dst_offset bytes into a buffer, returns if correct
+bool copies_correctly(std::size_t n, std::size_t dst_offset) {
+    std::vector<unsigned char> src(n);
+    std::iota(src.begin(), src.end(), 0);
+    std::vector<unsigned char> dst(n + dst_offset + 1, 0);
+    copy_bytes(dst.data() + dst_offset, src.data(), n);
+    return std::equal(src.begin(), src.end(), dst.begin() + dst_offset) &&
+           dst.back() == 0;
+}
+
+} // namespace
+
+TEST_CASE("Copy engine") {
+    const auto huge = std::numeric_limits<std::size_t>::max();
+
+    SECTION("default_copy_options") {
+        auto defaults = default_copy_options();
+        CopyOptions corr;
+        REQUIRE(defaults.streaming_threshold >= corr.streaming_threshold);
+        corr.streaming_threshold = defaults.streaming_threshold;
+        REQUIRE(defaults == corr);
+    }
+
+    SECTION("copy_options/set_copy_options") {
+        const auto old = copy_options();
+        CopyOptions options{.parallel_threshold   = 1,
+                            .streaming_threshold  = 2,
+                            .min_bytes_per_thread = 3,
+                            .max_threads          = 4};
+        set_copy_options(options);
+        REQUIRE(copy_options() == options);
+        set_copy_options(old);
+        REQUIRE(copy_options() == old);
+    }
+
+    SECTION("copy_threads") {
+        test_wtf::ForceCopyEngine force;
+        REQUIRE(copy_threads(0) == 1);
+        REQUIRE(copy_threads(1) == 1);
+        REQUIRE(copy_threads(2) == 2);
+        REQUIRE(copy_threads(1000) == 2);
+    }
+
+    SECTION("copy_strategy") {
+        test_wtf::ForceCopyEngine force(100);
+        REQUIRE(copy_strategy(1) == CopyStrategy::serial);
+        REQUIRE(copy_strategy(50) == CopyStrategy::parallel);
+#ifdef __SSE2__
+        REQUIRE(copy_strategy(100) == CopyStrategy::streaming);
+#else
+        REQUIRE(copy_strategy(100) == CopyStrategy::parallel);
+#endif
+
+        // One thread is always serial
+        auto options        = copy_options();
+        options.max_threads = 1;
+        set_copy_options(options);
+        REQUIRE(copy_strategy(100) == CopyStrategy::serial);
+    }
+
+    SECTION("copy_bytes") {
+        SECTION("serial") {
+            REQUIRE(copies_correctly(100, 0));
+            REQUIRE(copies_correctly(0, 0));
+        }
+
+        SECTION("parallel") {
+            test_wtf::ForceCopyEngine force(huge);
+            REQUIRE(copies_correctly(1001, 0));
+            REQUIRE(copies_correctly(1001, 3));
+        }
+
+        SECTION("streaming") {
+            test_wtf::ForceCopyEngine force;
+            for(std::size_t offset : {0, 1, 8, 15})
+                for(std::size_t n : {1, 15, 16, 17, 63, 64, 65, 1001})
+                    REQUIRE(copies_correctly(n, offset));
+        }
+    }
+
+    SECTION("copy_elements") {
+        std::vector<double> in{1.0, 2.0, 3.0};
+        std::vector<double> out(3);
+        copy_elements<double>(in, out);
+        REQUIRE(out == in);
+
+        std::vector<test_wtf::MyCustomFloat> custom_in{1.0, 2.0};
+        std::vector<test_wtf::MyCustomFloat> custom_out(2);
+        copy_elements<test_wtf::MyCustomFloat>(custom_in, custom_out);
+        REQUIRE(custom_out == custom_in);
+
+        std::vector<double> wrong_size(2);
+        REQUIRE_THROWS_AS(copy_elements<double>(in, wrong_size),
+                          std::invalid_argument);
+    }
+}
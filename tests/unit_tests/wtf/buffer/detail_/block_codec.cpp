@@ -0,0 +1,129 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../../../test_wtf.hpp"
+#include <cmath>
+#include <cstring>
+#include <wtf/buffer/detail_/block_codec.hpp>
+
+using namespace wtf::buffer::detail_;
+
+namespace {
+
+/// Compresses and decompresses @p values, returning the compressed size
+template<typename T>
+std::size_t round_trip(const std::vector<T>& values) {
+    auto raw    = std::as_bytes(std::span(values));
+    auto packed = compress_block(raw, sizeof(T));
+    std::vector<T> out(values.size());
+    decompress_block(packed, std::as_writable_bytes(std::span(out)),
+                     sizeof(T));
+    REQUIRE(std::memcmp(out.data(), values.data(), raw.size()) == 0);
+    return packed.size();
+}
+
+/// Makes @p n copies of @p value whose padding bytes (if any) are all zero
+template<typename T>
+std::vector<T> filled(std::size_t n, T value) {
+    T padded;
+    std::memset(&padded, 0, sizeof(T));
+    padded = value;
+    std::vector<T> values(n);
+    for(auto& x : values) std::memcpy(&x, &padded, sizeof(T));
+    return values;
+}
+
+} // namespace
+
+TEMPLATE_LIST_TEST_CASE("block_codec", "[wtf]", test_wtf::default_fp_types) {
+    using vector_type = std::vector<TestType>;
+    const auto n      = std::size_t{1000};
+
+    SECTION("Constant values compress well") {
+        auto values = filled(n, TestType{3.14});
+        REQUIRE(round_trip(values) < n * sizeof(TestType) / 10);
+    }
+
+    SECTION("Zeros compress well") {
+        auto values = filled(n, TestType{0.0});
+        REQUIRE(round_trip(values) < n * sizeof(TestType) / 10);
+    }
+
+    SECTION("Smooth values compress") {
+        vector_type values(n);
+        for(std::size_t i = 0; i < n; ++i)
+            values[i] = static_cast<TestType>(i) * TestType{0.5};
+        REQUIRE(round_trip(values) < n * sizeof(TestType));
+    }
+
+    SECTION("Noisy values are stored raw") {
+        vector_type values(n);
+        for(std::size_t i = 0; i < n; ++i)
+            values[i] = std::sin(static_cast<TestType>(i * i + 1) * 1.1);
+        REQUIRE(round_trip(values) <= n * sizeof(TestType) + 1);
+    }
+
+    SECTION("Short blocks") {
+        round_trip(vector_type{});
+        round_trip(vector_type{1.0});
+        round_trip(vector_type{1.0, 2.0});
+    }
+
+    SECTION("Long literal and run sequences") {
+        // Alternate long runs with long stretches of distinct bytes
+        vector_type values;
+        for(std::size_t i = 0; i < 300; ++i) values.push_back(TestType{1.0});
+        for(std::size_t i = 0; i < 300; ++i)
+            values.push_back(static_cast<TestType>(i) + TestType{0.25});
+        round_trip(values);
+    }
+}
+
+TEST_CASE("block_codec errors", "[wtf]") {
+    std::vector<double> values{1.0, 1.0, 1.0, 2.0};
+    auto raw    = std::as_bytes(std::span(values));
+    auto packed = compress_block(raw, sizeof(double));
+    std::vector<std::byte> out(raw.size());
+
+    SECTION("Bad element size") {
+        REQUIRE_THROWS_AS(compress_block(raw, 0), std::invalid_argument);
+        REQUIRE_THROWS_AS(compress_block(raw, 3), std::invalid_argument);
+        REQUIRE_THROWS_AS(decompress_block(packed, out, 3),
+                          std::invalid_argument);
+    }
+
+    SECTION("Empty block") {
+        REQUIRE_THROWS_AS(decompress_block({}, out, 8), std::runtime_error);
+    }
+
+    SECTION("Unknown format") {
+        packed[0] = std::byte{42};
+        REQUIRE_THROWS_AS(decompress_block(packed, out, 8),
+                          std::runtime_error);
+    }
+
+    SECTION("Truncated") {
+        packed.pop_back();
+        REQUIRE_THROWS_AS(decompress_block(packed, out, 8),
+                          std::runtime_error);
+    }
+
+    SECTION("Wrong output size") {
+        std::vector<std::byte> big(raw.size() + 8);
+        REQUIRE_THROWS_AS(decompress_block(packed, big, 8),
+                          std::runtime_error);
+    }
+}
@@ -0,0 +1,159 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../../../test_wtf.hpp"
+#include <wtf/buffer/detail_/compressed_model.hpp>
+#include <wtf/buffer/detail_/contiguous_model.hpp>
+
+using namespace wtf::buffer::detail_;
+
+TEMPLATE_LIST_TEST_CASE("CompressedModel", "[wtf]",
+                        test_wtf::default_fp_types) {
+    using model_type  = CompressedModel<TestType>;
+    using vector_type = std::vector<TestType>;
+
+    // 10 elements in blocks of 3 (the last block is short), 2 cached blocks
+    vector_type values(10);
+    for(std::size_t i = 0; i < values.size(); ++i)
+        values[i] = static_cast<TestType>(i);
+    model_type model(values, 3, 2);
+
+    SECTION("Ctor") {
+        REQUIRE(model.size() == 10);
+        REQUIRE(model.n_blocks() == 4);
+        REQUIRE(model.block_size() == 3);
+        REQUIRE(model.cache_capacity() == 2);
+        REQUIRE(model.decompress() == values);
+        REQUIRE(model.type() == wtf::rtti::wtf_typeid<TestType>());
+
+        REQUIRE_THROWS_AS(model_type(values, 0, 2), std::invalid_argument);
+        REQUIRE_THROWS_AS(model_type(values, 3, 0), std::invalid_argument);
+
+        model_type empty(vector_type{}, 3, 2);
+        REQUIRE(empty.size() == 0);
+        REQUIRE(empty.n_blocks() == 0);
+    }
+
+    SECTION("get_element") {
+        for(std::size_t i = 0; i < values.size(); ++i)
+            REQUIRE(std::as_const(model).get_element(i) == values[i]);
+        REQUIRE_THROWS_AS(model.get_element(10), std::out_of_range);
+    }
+
+    SECTION("Writes survive eviction") {
+        // Touch every block so the written ones are evicted and recompressed
+        model.get_element(0) = TestType{42.0};
+        model.get_element(9) = TestType{43.0};
+        for(std::size_t i = 0; i < values.size(); ++i) model.get_element(i);
+        values[0] = TestType{42.0};
+        values[9] = TestType{43.0};
+        REQUIRE(model.decompress() == values);
+    }
+
+    SECTION("for_each_block") {
+        std::vector<std::size_t> sizes;
+        model.for_each_block([&](std::span<TestType> block) {
+            sizes.push_back(block.size());
+            for(auto& x : block) x += TestType{1.0};
+        });
+        REQUIRE(sizes == std::vector<std::size_t>{3, 3, 3, 1});
+        for(auto& x : values) x += TestType{1.0};
+        REQUIRE(model.decompress() == values);
+
+        vector_type seen;
+        std::as_const(model).for_each_block(
+          [&](std::span<const TestType> block) {
+              seen.insert(seen.end(), block.begin(), block.end());
+          });
+        REQUIRE(seen == values);
+    }
+
+    SECTION("flush/compressed_size") {
+        vector_type zeros(10, TestType{0.0});
+        model_type zero_model(zeros, 5, 2);
+        const auto before = zero_model.compressed_size();
+        REQUIRE(before < 10 * sizeof(TestType));
+
+        zero_model.get_element(3) = TestType{1.5};
+        REQUIRE(zero_model.compressed_size() == before);
+        zero_model.flush();
+        REQUIRE(zero_model.compressed_size() > before);
+        REQUIRE(zero_model.get_element(3) == TestType{1.5});
+    }
+
+    SECTION("Copy") {
+        model.get_element(4) = TestType{42.0};
+        model_type copy(model);
+        values[4] = TestType{42.0};
+        REQUIRE(copy.decompress() == values);
+        REQUIRE(copy == model);
+
+        model_type other(vector_type{1.0}, 1, 1);
+        other = model;
+        REQUIRE(other.decompress() == values);
+    }
+
+    SECTION("Move") {
+        model.get_element(4) = TestType{42.0};
+        model_type moved(std::move(model));
+        values[4] = TestType{42.0};
+        REQUIRE(moved.decompress() == values);
+
+        // The moved-from model is empty, but still usable
+        REQUIRE(model.size() == 0);
+        REQUIRE(model.n_blocks() == 0);
+        REQUIRE(model.decompress().empty());
+        REQUIRE_THROWS_AS(model.get_element(0), std::out_of_range);
+
+        model_type assigned(vector_type{}, 3, 2);
+        assigned = std::move(moved);
+        REQUIRE(assigned.decompress() == values);
+        REQUIRE(moved.size() == 0);
+        REQUIRE(moved.compressed_size() == 0);
+        model = std::move(assigned);
+        REQUIRE(model.decompress() == values);
+    }
+
+    SECTION("operator==") {
+        REQUIRE(model == model_type(values, 3, 2));
+        REQUIRE(model == model_type(values, 4, 1));
+
+        auto diff = values;
+        diff[5]   = TestType{42.0};
+        REQUIRE_FALSE(model == model_type(diff, 3, 2));
+        REQUIRE_FALSE(model == model_type(vector_type{1.0}, 3, 2));
+    }
+
+    SECTION("BufferHolder interface") {
+        REQUIRE(model.at(4) == TestType{4.0});
+        model.at(4) = TestType{42.0};
+        REQUIRE(std::as_const(model).at(4) == TestType{42.0});
+        REQUIRE_FALSE(model.is_const());
+        REQUIRE_FALSE(model.is_contiguous());
+
+        auto pclone = model.clone();
+        REQUIRE(pclone->are_equal(model));
+        REQUIRE(dynamic_cast<model_type*>(pclone.get()) != nullptr);
+
+        auto pview = model.as_view();
+        REQUIRE(pview->size() == 10);
+        REQUIRE(pview->at(4) == TestType{42.0});
+        REQUIRE(std::as_const(model).as_view()->at(3) == TestType{3.0});
+
+        ContiguousModel<TestType> contiguous(values);
+        REQUIRE_FALSE(model.are_equal(contiguous));
+    }
+}
@@ -46,6 +46,75 @@ TEMPLATE_LIST_TEST_CASE("ContiguousModel", "[wtf]", all_fp_types) {
             // Is deep copy?
             REQUIRE_FALSE(&model.get_element(0) == &model_copy.get_element(0));
         }
+
+        SECTION("copy (copy engine)") {
+            ForceCopyEngine force;
+            model_type model_copy(model);
+            REQUIRE(model == model_copy);
+            REQUIRE(model_copy.capacity() >= 3);
+
+            model_copy.resize(2);
+            REQUIRE(model_copy.get_element(1) == two);
+            model_copy.resize(3);
+            REQUIRE(model_copy.get_element(2) == TestType{});
+
+            model_copy.resize(4);
+            REQUIRE(model_copy.size() == 4);
+            REQUIRE(model_copy.get_element(1) == two);
+        }
+
+        SECTION("move") {
+            model_type moved(std::move(model));
+            REQUIRE(moved.data() == pdata);
+            REQUIRE(moved.size() == 3);
+
+            // The moved-from model no longer aliases the elements
+            REQUIRE(model.size() == 0);
+            REQUIRE_FALSE(model.data() == pdata);
+        }
+
+        SECTION("move (copy engine)") {
+            ForceCopyEngine force;
+            model_type model_copy(model);
+            const auto* pcopy = model_copy.data();
+            model_type moved(std::move(model_copy));
+            REQUIRE(moved.data() == pcopy);
+            REQUIRE(moved == model);
+            REQUIRE(model_copy.size() == 0);
+            REQUIRE(model_copy.capacity() == 0);
+        }
+    }
+
+    SECTION("copy assignment") {
+        model_type other(vector_type{three, two, one});
+        other = model;
+        REQUIRE(other == model);
+        REQUIRE_FALSE(other.data() == model.data());
+
+        SECTION("copy engine") {
+            ForceCopyEngine force;
+            model_type copy(vector_type{three, three, three});
+            copy = model;
+            REQUIRE(copy == model);
+
+            model_type too_short(vector_type{three});
+            too_short = model;
+            REQUIRE(too_short == model);
+        }
+    }
+
+    SECTION("move assignment") {
+        model_type other(vector_type{three, two, one});
+        other = std::move(model);
+        REQUIRE(other.data() == pdata);
+        REQUIRE(other.size() == 3);
+        REQUIRE(model.size() == 0);
+        REQUIRE_FALSE(model.data() == pdata);
+
+        // The moved-from model is still usable
+        model.resize(2);
+        REQUIRE(model.size() == 2);
+        REQUIRE(other.get_element(0) == one);
     }
 
     SECTION("get_element()") {
@@ -84,6 +153,19 @@ TEMPLATE_LIST_TEST_CASE("ContiguousModel", "[wtf]", all_fp_types) {
         REQUIRE(span.size() == 3);
     }
 
+    SECTION("capacity()") { REQUIRE(model.capacity() >= 3); }
+
+    SECTION("resize()") {
+        model.resize(2);
+        REQUIRE(model.size() == 2);
+        REQUIRE(model.data() == pdata);
+        REQUIRE(model.get_element(1) == two);
+
+        model.resize(3);
+        REQUIRE(model.data() == pdata);
+        REQUIRE(model.get_element(2) == TestType{});
+    }
+
     SECTION("operator==") {
         REQUIRE(model == model_type(vector_type{one, two, three}));
 
@@ -0,0 +1,73 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../../../test_wtf.hpp"
+#include <wtf/buffer/detail_/contiguous_model.hpp>
+#include <wtf/buffer/detail_/indirect_view_model.hpp>
+
+using namespace wtf::buffer::detail_;
+using wtf::fp::Float;
+
+TEMPLATE_LIST_TEST_CASE("IndirectViewModel", "[wtf]",
+                        test_wtf::default_fp_types) {
+    using model_type       = IndirectViewModel<Float>;
+    using const_model_type = IndirectViewModel<const Float>;
+    using vector_type      = std::vector<TestType>;
+
+    ContiguousModel<TestType> buffer(vector_type{1.0, 2.0, 3.0});
+    model_type model(&buffer);
+    const_model_type const_model(&buffer);
+
+    SECTION("Ctor") {
+        REQUIRE(model.size() == 3);
+        REQUIRE(model.type() == buffer.type());
+        REQUIRE(const_model.size() == 3);
+    }
+
+    SECTION("at") {
+        REQUIRE(model.at(1) == TestType{2.0});
+        REQUIRE(const_model.at(2) == TestType{3.0});
+        REQUIRE_THROWS_AS(model.at(3), std::out_of_range);
+
+        model.at(0) = TestType{42.0};
+        REQUIRE(buffer.get_element(0) == TestType{42.0});
+        REQUIRE(std::as_const(model).at(0) == TestType{42.0});
+    }
+
+    SECTION("is_const") {
+        REQUIRE_FALSE(model.is_const());
+        REQUIRE(const_model.is_const());
+    }
+
+    SECTION("is_contiguous") { REQUIRE_FALSE(model.is_contiguous()); }
+
+    SECTION("clone/const_clone") {
+        REQUIRE(model.clone()->are_equal(model));
+        REQUIRE(model.const_clone()->are_equal(const_model));
+        REQUIRE(const_model.clone()->are_equal(const_model));
+    }
+
+    SECTION("are_equal") {
+        ContiguousModel<TestType> same(vector_type{1.0, 2.0, 3.0});
+        REQUIRE(model.are_equal(model_type(&same)));
+
+        ContiguousModel<TestType> diff(vector_type{1.0, 2.0, 4.0});
+        REQUIRE_FALSE(model.are_equal(model_type(&diff)));
+
+        ContiguousModel<TestType> shorter(vector_type{1.0, 2.0});
+        REQUIRE_FALSE(model.are_equal(model_type(&shorter)));
+    }
+}
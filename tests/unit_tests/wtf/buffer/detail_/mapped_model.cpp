@@ -0,0 +1,88 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../../../test_wtf.hpp"
+#include <fstream>
+#include <wtf/buffer/detail_/mapped_model.hpp>
+
+using namespace wtf::buffer::detail_;
+using wtf::io::MemoryMap;
+
+TEMPLATE_LIST_TEST_CASE("MappedModel", "[wtf]", test_wtf::default_fp_types) {
+    using model_type      = MappedModel<TestType>;
+    using contiguous_type = ContiguousModel<TestType>;
+
+    std::vector<TestType> values{1.0, 2.0, 3.0};
+    auto path   = test_wtf::scratch_file("mapped_model");
+    auto nbytes = values.size() * sizeof(TestType);
+    std::ofstream(path, std::ios::binary)
+      .write(reinterpret_cast<const char*>(values.data()), nbytes);
+
+    model_type model(MemoryMap(path, MemoryMap::Mode::read_write, 0, nbytes));
+
+    SECTION("Ctor") {
+        REQUIRE(model.size() == 3);
+        REQUIRE(model.get_element(0) == TestType{1.0});
+        REQUIRE(model.get_element(1) == TestType{2.0});
+        REQUIRE(model.get_element(2) == TestType{3.0});
+        auto pmapped = reinterpret_cast<TestType*>(model.memory_map().data());
+        REQUIRE(model.data() == pmapped);
+
+        SECTION("Throws if not a whole number of elements") {
+            MemoryMap map(path, MemoryMap::Mode::read_only, 0, nbytes - 1);
+            REQUIRE_THROWS_AS(model_type(std::move(map)),
+                              std::invalid_argument);
+        }
+    }
+
+    SECTION("Is a ContiguousModel") {
+        contiguous_type corr(values);
+        const contiguous_type& base = model;
+        REQUIRE(base == corr);
+        REQUIRE(model.are_equal(corr));
+    }
+
+    SECTION("Does not own its memory") {
+        REQUIRE(model.capacity() == 0);
+        REQUIRE_THROWS_AS(model.resize(1), std::logic_error);
+    }
+
+    SECTION("memory_map") {
+        REQUIRE(model.memory_map().size() == nbytes);
+        const auto& cmodel = model;
+        REQUIRE(cmodel.memory_map().mode() == MemoryMap::Mode::read_write);
+    }
+
+    SECTION("Writes go to the file") {
+        model.get_element(1) = TestType{42.0};
+        model.memory_map().flush();
+
+        std::vector<TestType> buffer(3);
+        std::ifstream(path, std::ios::binary)
+          .read(reinterpret_cast<char*>(buffer.data()), nbytes);
+        REQUIRE(buffer[1] == TestType{42.0});
+    }
+
+    SECTION("clone is an in-memory copy") {
+        auto pclone = model.clone();
+        REQUIRE(pclone->are_equal(model));
+        REQUIRE(dynamic_cast<MappedStorage*>(pclone.get()) == nullptr);
+        auto& clone = dynamic_cast<contiguous_type&>(*pclone);
+        REQUIRE(clone.data() != model.data());
+    }
+
+    std::filesystem::remove(path);
+}
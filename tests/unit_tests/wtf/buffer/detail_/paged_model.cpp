@@ -0,0 +1,60 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "../../../../test_wtf.hpp"
+#include <wtf/buffer/detail_/paged_model.hpp>
+
+using namespace wtf::buffer::detail_;
+
+TEMPLATE_LIST_TEST_CASE("PagedModel", "[wtf]", test_wtf::default_fp_types) {
+    using model_type      = PagedModel<TestType>;
+    using contiguous_type = ContiguousModel<TestType>;
+    using vector_type     = typename contiguous_type::vector_type;
+
+    model_type model(10, {});
+
+    SECTION("Ctor") {
+        REQUIRE(model.size() == 10);
+        const auto* p = model.page_allocation().data();
+        REQUIRE(static_cast<const void*>(model.data()) == p);
+        REQUIRE(model.page_allocation().size() == 10 * sizeof(TestType));
+    }
+
+    SECTION("Is a zero-filled ContiguousModel") {
+        contiguous_type corr(vector_type(10));
+        const contiguous_type& base = model;
+        REQUIRE(base == corr);
+        REQUIRE(model.are_equal(corr));
+    }
+
+    SECTION("Does not own a vector") {
+        REQUIRE(model.capacity() == 0);
+        REQUIRE_THROWS_AS(model.resize(1), std::logic_error);
+    }
+
+    SECTION("Can be found by cross-casting") {
+        wtf::buffer::detail_::BufferHolder& holder = model;
+        REQUIRE(dynamic_cast<PagedStorage*>(&holder) != nullptr);
+    }
+
+    SECTION("clone is an in-memory copy") {
+        model.data()[0] = TestType{1.0};
+        auto pclone     = model.clone();
+        REQUIRE(pclone->are_equal(model));
+        REQUIRE(dynamic_cast<PagedStorage*>(pclone.get()) == nullptr);
+    }
+}
@@ -0,0 +1,157 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "../../../test_wtf.hpp"
+#include <algorithm>
+#include <wtf/buffer/factories.hpp>
+#include <wtf/buffer/paged_buffer.hpp>
+#include <wtf/fp/half.hpp>
+
+using namespace wtf::buffer;
+using wtf::fp::Float;
+using wtf::rtti::wtf_typeid;
+
+TEMPLATE_LIST_TEST_CASE("Buffer factories", "[wtf]",
+                        test_wtf::default_fp_types) {
+    using tuple_type  = test_wtf::default_fp_types;
+    using vector_type = std::vector<TestType>;
+
+    const auto type    = wtf_typeid<TestType>();
+    const std::size_t big =
+      detail_::min_paged_factory_bytes / sizeof(TestType) + 3;
+
+    auto all_equal = [](const FloatBuffer& buffer, auto&& corr) {
+        auto values = buffer.value<TestType>();
+        for(std::size_t i = 0; i < values.size(); ++i)
+            if(values[i] != corr(i)) return false;
+        return true;
+    };
+
+    SECTION("zeros") {
+        FloatBuffer small = zeros<tuple_type>(type, 4);
+        REQUIRE(small == FloatBuffer(vector_type(4)));
+        REQUIRE_FALSE(is_paged(small));
+
+        FloatBuffer large = zeros<tuple_type>(Float(TestType{1.0}), big);
+        REQUIRE(large.size() == big);
+        REQUIRE(is_paged(large));
+        REQUIRE(all_equal(large, [](std::size_t) { return TestType{0}; }));
+
+        FloatBuffer empty = zeros<tuple_type>(type, 0);
+        REQUIRE(empty.size() == 0);
+    }
+
+    SECTION("uninitialized") {
+        FloatBuffer small = uninitialized<tuple_type>(type, 4);
+        REQUIRE(small.size() == 4);
+        REQUIRE_NOTHROW(small.value<TestType>());
+
+        FloatBuffer large = uninitialized<tuple_type>(Float(TestType{}), big);
+        REQUIRE(large.size() == big);
+        REQUIRE(is_paged(large));
+    }
+
+    SECTION("fill") {
+        Float value(TestType{2.5});
+        FloatBuffer small = fill<tuple_type>(value, 3);
+        REQUIRE(small == FloatBuffer(vector_type(3, TestType{2.5})));
+
+        FloatBuffer large = fill<tuple_type>(value, big);
+        REQUIRE(large.size() == big);
+        REQUIRE(all_equal(large, [](std::size_t) { return TestType{2.5}; }));
+    }
+
+    SECTION("iota") {
+        FloatBuffer small = iota<tuple_type>(Float(TestType{1.5}), 3);
+        REQUIRE(small == FloatBuffer(vector_type{1.5, 2.5, 3.5}));
+
+        FloatBuffer from_type = iota<tuple_type>(type, 3);
+        REQUIRE(from_type == FloatBuffer(vector_type{0.0, 1.0, 2.0}));
+
+        FloatBuffer large = iota<tuple_type>(type, big);
+        REQUIRE(large.size() == big);
+        REQUIRE(all_equal(large, [](std::size_t i) { return TestType(i); }));
+    }
+
+    SECTION("linspace") {
+        Float start(TestType{0.0});
+        Float stop(TestType{1.0});
+
+        FloatBuffer five = linspace<tuple_type>(start, stop, 5);
+        REQUIRE(five == FloatBuffer(vector_type{0.0, 0.25, 0.5, 0.75, 1.0}));
+
+        FloatBuffer one = linspace<tuple_type>(start, stop, 1);
+        REQUIRE(one == FloatBuffer(vector_type{0.0}));
+        REQUIRE(linspace<tuple_type>(start, stop, 0).size() == 0);
+
+        FloatBuffer large = linspace<tuple_type>(start, stop, big);
+        auto values       = large.value<TestType>();
+        REQUIRE(values.front() == TestType{0.0});
+        REQUIRE(values.back() == TestType{1.0});
+        REQUIRE(std::is_sorted(values.begin(), values.end()));
+
+        // The last element is stop even if start + (n - 1) * h rounds
+        Float tenth(TestType{0.1});
+        Float seven_tenths(TestType{0.7});
+        FloatBuffer seven = linspace<tuple_type>(tenth, seven_tenths, 7);
+        REQUIRE(seven.value<TestType>()[6] == TestType{0.7});
+
+        constexpr bool is_float = std::is_same_v<TestType, float>;
+        using other_t = std::conditional_t<is_float, double, float>;
+        Float other(other_t{1.0});
+        REQUIRE_THROWS_AS(linspace<tuple_type>(start, other, 3),
+                          std::invalid_argument);
+    }
+
+    SECTION("Throws if type is not in tuple") {
+        using other_tuple = std::tuple<std::complex<double>>;
+        REQUIRE_THROWS_AS(zeros<other_tuple>(type, 3), std::runtime_error);
+        REQUIRE_THROWS_AS(fill<other_tuple>(Float(TestType{}), 3),
+                          std::runtime_error);
+    }
+}
+
+TEST_CASE("Buffer factories for types without arithmetic") {
+    using test_wtf::MyCustomFloat;
+    using custom_tuple = std::tuple<MyCustomFloat>;
+    const auto type    = wtf_typeid<MyCustomFloat>();
+
+    SECTION("zeros value-initializes") {
+        FloatBuffer buffer = zeros<custom_tuple>(type, 3);
+        REQUIRE(buffer == FloatBuffer(std::vector<MyCustomFloat>(3)));
+    }
+
+    SECTION("fill") {
+        FloatBuffer buffer = fill<custom_tuple>(Float(MyCustomFloat{1.0}), 2);
+        REQUIRE(buffer == FloatBuffer(std::vector<MyCustomFloat>(2, 1.0)));
+    }
+
+    SECTION("iota/linspace throw") {
+        Float value(MyCustomFloat{1.0});
+        REQUIRE_THROWS_AS(iota<custom_tuple>(type, 3), std::runtime_error);
+        REQUIRE_THROWS_AS(linspace<custom_tuple>(value, value, 3),
+                          std::runtime_error);
+    }
+
+    SECTION("Storage types are computed in their promoted type") {
+        using wtf::fp::Half;
+        using half_tuple   = std::tuple<Half>;
+        FloatBuffer buffer = iota<half_tuple>(Float(Half(1.0)), 3);
+        std::vector<Half> corr{Half(1.0), Half(2.0), Half(3.0)};
+        REQUIRE(buffer == FloatBuffer(corr));
+    }
+}
@@ -52,6 +52,18 @@ TEMPLATE_LIST_TEST_CASE("FloatBuffer", "[wtf]", default_fp_types) {
             REQUIRE(buf_from_vector.at(2) == three);
         }
 
+        SECTION("By holder") {
+            using model_type = wtf::buffer::detail_::ContiguousModel<TestType>;
+            auto pmodel      = std::make_unique<model_type>(val);
+            auto pval        = pmodel->data();
+            FloatBuffer buf_from_holder(std::move(pmodel));
+            REQUIRE(buf_from_holder == buffer);
+            REQUIRE(buf_from_holder.template value<TestType>().data() == pval);
+
+            FloatBuffer null_holder(FloatBuffer::holder_pointer{});
+            REQUIRE(null_holder == defaulted);
+        }
+
         SECTION("By iterators") {
             FloatBuffer buf_from_iterators(val.begin(), val.end());
             REQUIRE(buf_from_iterators.size() == 3);
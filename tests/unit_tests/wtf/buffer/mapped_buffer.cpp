@@ -0,0 +1,139 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../../test_wtf.hpp"
+#include <fstream>
+#include <wtf/buffer/mapped_buffer.hpp>
+
+using namespace wtf::buffer;
+using namespace test_wtf;
+using mode_type   = wtf::io::MemoryMap::Mode;
+using advice_type = wtf::io::MemoryMap::Advice;
+
+TEMPLATE_LIST_TEST_CASE("mapped_buffer", "[wtf]", default_fp_types) {
+    using vector_type = std::vector<TestType>;
+    vector_type val{1.0, 2.0, 3.0, 4.0};
+    auto path = scratch_file("mapped_buffer");
+
+    // Creates a file holding val and then maps it
+    auto n              = val.size();
+    FloatBuffer created = create_mapped_float_buffer<TestType>(path, n);
+    std::copy(val.begin(), val.end(), created.value<TestType>().begin());
+    flush(created);
+
+    FloatBuffer in_memory(val);
+
+    SECTION("create_mapped_float_buffer") {
+        REQUIRE(is_mapped(created));
+        REQUIRE(created == in_memory);
+
+        auto empty = create_mapped_float_buffer<TestType>(path, 0);
+        REQUIRE(empty.size() == 0);
+    }
+
+    SECTION("map_float_buffer") {
+        SECTION("Whole file") {
+            FloatBuffer mapped = map_float_buffer<default_fp_types>(path);
+            REQUIRE(is_mapped(mapped));
+            REQUIRE(mapped == in_memory);
+        }
+
+        SECTION("Subset") {
+            FloatBuffer mapped = map_float_buffer<default_fp_types>(
+              path, mode_type::read_only, 1, 2);
+            REQUIRE(mapped == FloatBuffer(vector_type{2.0, 3.0}));
+
+            // count is clipped to the end of the file
+            FloatBuffer tail = map_float_buffer<default_fp_types>(
+              path, mode_type::read_only, 3, 100);
+            REQUIRE(tail == FloatBuffer(vector_type{4.0}));
+        }
+
+        SECTION("read_only writes are not persisted") {
+            FloatBuffer mapped = map_float_buffer<default_fp_types>(path);
+            mapped.value<TestType>()[0] = TestType{42.0};
+            flush(mapped);
+            REQUIRE(map_float_buffer<default_fp_types>(path) == in_memory);
+        }
+
+        SECTION("read_write writes are persisted") {
+            FloatBuffer mapped =
+              map_float_buffer<default_fp_types>(path, mode_type::read_write);
+            mapped.value<TestType>()[0] = TestType{42.0};
+            flush(mapped);
+            FloatBuffer reread = map_float_buffer<default_fp_types>(path);
+            REQUIRE(reread.value<TestType>()[0] == TestType{42.0});
+        }
+
+        SECTION("Works with visit_contiguous_buffer") {
+            FloatBuffer mapped = map_float_buffer<default_fp_types>(path);
+            auto lambda = [](auto&& span) { return span.size(); };
+            REQUIRE(visit_contiguous_buffer<default_fp_types>(lambda, mapped) ==
+                    n);
+        }
+
+        SECTION("Throws if type is not in tuple") {
+            constexpr bool is_float = std::is_same_v<TestType, float>;
+            using other_t     = std::conditional_t<is_float, double, float>;
+            using other_tuple = std::tuple<other_t>;
+            REQUIRE_THROWS_AS(map_float_buffer<other_tuple>(path),
+                              std::runtime_error);
+        }
+
+        SECTION("Throws if first is out of range") {
+            REQUIRE_THROWS_AS(map_float_buffer<default_fp_types>(
+                                path, mode_type::read_only, 5),
+                              std::out_of_range);
+        }
+
+        SECTION("Throws if the header's sizes overflow") {
+            // Corrupts the header's element count
+            std::fstream file(path, std::ios::in | std::ios::out |
+                                      std::ios::binary);
+            file.seekp(16);
+            const std::string huge(8, '\xff');
+            file.write(huge.data(), huge.size());
+            file.close();
+            REQUIRE_THROWS_AS(map_float_buffer<default_fp_types>(path),
+                              std::runtime_error);
+        }
+    }
+
+    SECTION("Copies are in memory") {
+        FloatBuffer copy(created);
+        REQUIRE_FALSE(is_mapped(copy));
+        REQUIRE(copy == created);
+    }
+
+    SECTION("is_mapped") {
+        REQUIRE_FALSE(is_mapped(in_memory));
+        REQUIRE_FALSE(is_mapped(FloatBuffer{}));
+    }
+
+    SECTION("flush") {
+        REQUIRE_NOTHROW(flush(created));
+        REQUIRE_THROWS_AS(flush(in_memory), std::runtime_error);
+    }
+
+    SECTION("advise") {
+        REQUIRE_NOTHROW(advise(created, advice_type::sequential));
+        REQUIRE_NOTHROW(advise(created, advice_type::will_need));
+        REQUIRE_THROWS_AS(advise(in_memory, advice_type::sequential),
+                          std::runtime_error);
+    }
+
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,117 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "../../../test_wtf.hpp"
+#include <algorithm>
+#include <wtf/buffer/page_allocation.hpp>
+
+using namespace wtf::buffer;
+using PageSize = PageAllocation::PageSize;
+
+namespace {
+
+/// Are all @p n bytes starting at @p p zero?
+bool all_zero(const std::byte* p, std::size_t n) {
+    return std::all_of(p, p + n, [](std::byte b) { return b == std::byte{0}; });
+}
+
+} // namespace
+
+TEST_CASE("PageAllocation") {
+    // Large enough for transparent huge pages to be tried
+    const std::size_t size = (std::size_t{3} << 20) + 5;
+
+    SECTION("Default ctor") {
+        PageAllocation pages;
+        REQUIRE(pages.data() == nullptr);
+        REQUIRE(pages.size() == 0);
+        REQUIRE(pages.page_size() == PageSize::normal);
+        REQUIRE_FALSE(pages.is_locked());
+    }
+
+    SECTION("Zero bytes") {
+        PageAllocation pages(0, {});
+        REQUIRE(pages.data() == nullptr);
+        REQUIRE(pages.size() == 0);
+    }
+
+    SECTION("Every page size falls back cleanly") {
+        for(auto want : {PageSize::normal, PageSize::transparent_huge,
+                         PageSize::huge_2mb, PageSize::huge_1gb}) {
+            PageAllocation pages(size, {.page_size = want});
+            REQUIRE(pages.data() != nullptr);
+            REQUIRE(pages.size() == size);
+            REQUIRE(pages.page_size() <= want);
+            REQUIRE(all_zero(pages.data(), size));
+            pages.data()[size - 1] = std::byte{1};
+            REQUIRE(pages.data()[size - 1] == std::byte{1});
+        }
+    }
+
+    SECTION("Transparent huge pages are 2 MiB aligned") {
+        PageAllocation pages(size, {.page_size = PageSize::transparent_huge});
+        if(pages.page_size() == PageSize::transparent_huge) {
+            auto address = reinterpret_cast<std::uintptr_t>(pages.data());
+            REQUIRE(address % (std::uintptr_t{1} << 21) == 0);
+        }
+    }
+
+    SECTION("Small sizes use normal pages") {
+        PageAllocation pages(100, {.page_size = PageSize::transparent_huge});
+        REQUIRE(pages.page_size() == PageSize::normal);
+        REQUIRE(all_zero(pages.data(), 100));
+    }
+
+    SECTION("populate and lock") {
+        PageAllocation populated(size, {.populate = true});
+        REQUIRE(all_zero(populated.data(), size));
+        REQUIRE_FALSE(populated.is_locked());
+
+        // Locking may fail (e.g., RLIMIT_MEMLOCK), but must not throw
+        PageAllocation locked(4096, {.lock = true});
+        REQUIRE(locked.data() != nullptr);
+
+        PageAllocation unlocked(4096, {});
+        const bool did_lock = unlocked.lock();
+        REQUIRE(did_lock == unlocked.is_locked());
+        REQUIRE_FALSE(PageAllocation{}.lock());
+    }
+
+    SECTION("interleave") {
+        // Interleaving may be unavailable, but must not throw
+        PageAllocation pages(size, {.populate = true, .interleave = true});
+        REQUIRE(all_zero(pages.data(), size));
+
+        PageAllocation plain(size, {});
+        REQUIRE_FALSE(plain.is_interleaved());
+    }
+
+    SECTION("Move ctor/assignment") {
+        PageAllocation pages(size, {});
+        auto* p = pages.data();
+
+        PageAllocation moved(std::move(pages));
+        REQUIRE(moved.data() == p);
+        REQUIRE(moved.size() == size);
+        REQUIRE(pages.data() == nullptr);
+
+        PageAllocation assigned(10, {});
+        assigned = std::move(moved);
+        REQUIRE(assigned.data() == p);
+        REQUIRE(moved.size() == 0);
+    }
+}
@@ -0,0 +1,70 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "../../../test_wtf.hpp"
+#include <wtf/buffer/paged_buffer.hpp>
+
+using namespace wtf::buffer;
+
+TEMPLATE_LIST_TEST_CASE("paged_buffer", "[wtf]", test_wtf::default_fp_types) {
+    using vector_type = std::vector<TestType>;
+    using PageSize    = PageAllocation::PageSize;
+
+    FloatBuffer buffer = make_paged_float_buffer<TestType>(100);
+
+    SECTION("make_paged_float_buffer") {
+        REQUIRE(buffer == FloatBuffer(vector_type(100)));
+        buffer.value<TestType>()[99] = TestType{2.0};
+        REQUIRE(buffer.value<TestType>()[99] == TestType{2.0});
+
+        PageAllocation::Options options{.page_size = PageSize::huge_2mb,
+                                        .populate  = true};
+        FloatBuffer huge = make_paged_float_buffer<TestType>(1000, options);
+        REQUIRE(huge.size() == 1000);
+        REQUIRE(page_allocation(huge).page_size() <= PageSize::huge_2mb);
+    }
+
+    SECTION("make_first_touch_float_buffer") {
+        const std::size_t n = 10000;
+        FloatBuffer touched =
+          make_first_touch_float_buffer<TestType>(n, 4, TestType{3.0});
+        REQUIRE(is_paged(touched));
+        REQUIRE(touched == FloatBuffer(vector_type(n, TestType{3.0})));
+
+        FloatBuffer zeros = make_first_touch_float_buffer<TestType>(
+          n, 3, TestType{}, {.interleave = true});
+        REQUIRE(zeros == FloatBuffer(vector_type(n)));
+    }
+
+    SECTION("is_paged") {
+        REQUIRE(is_paged(buffer));
+        REQUIRE_FALSE(is_paged(FloatBuffer(vector_type(100))));
+        REQUIRE_FALSE(is_paged(FloatBuffer{}));
+
+        // Copies are ordinary buffers
+        FloatBuffer copy(buffer);
+        REQUIRE_FALSE(is_paged(copy));
+        REQUIRE(copy == buffer);
+    }
+
+    SECTION("page_allocation") {
+        const auto& pages = page_allocation(buffer);
+        REQUIRE(pages.size() == 100 * sizeof(TestType));
+        REQUIRE_FALSE(pages.is_locked());
+        REQUIRE_THROWS_AS(page_allocation(FloatBuffer{}), std::runtime_error);
+    }
+}
@@ -0,0 +1,203 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "../../../test_wtf.hpp"
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <set>
+#include <thread>
+#include <vector>
+#include <wtf/buffer/parallel_visit.hpp>
+#include <wtf/parallel/thread_pool.hpp>
+
+using namespace wtf::buffer;
+
+namespace {
+
+/// Dispatch also instantiates visitors with read-only spans
+template<typename SpanType>
+constexpr bool is_mutable_v =
+  !std::is_const_v<typename SpanType::element_type>;
+
+} // namespace
+
+TEMPLATE_LIST_TEST_CASE("parallel_visit_contiguous_buffer", "[wtf]",
+                        test_wtf::default_fp_types) {
+    using tuple_type  = test_wtf::default_fp_types;
+    using vector_type = std::vector<TestType>;
+
+    const std::size_t n = 1000;
+    vector_type values(n);
+    std::iota(values.begin(), values.end(), TestType{0});
+    FloatBuffer buffer(values);
+    const ExecutionPolicy policy(3, 64);
+
+    auto sum = [](auto span) {
+        double rv = 0.0;
+        for(auto x : span) rv += static_cast<double>(x);
+        return rv;
+    };
+
+    SECTION("Returns the result of each chunk in order") {
+        auto partials =
+          parallel_visit_contiguous_buffer<tuple_type>(policy, sum, buffer);
+        REQUIRE(partials.size() == 16);
+        REQUIRE(partials[0] == 63.0 * 64.0 / 2.0);
+        auto total = std::accumulate(partials.begin(), partials.end(), 0.0);
+        REQUIRE(total == 999.0 * 1000.0 / 2.0);
+    }
+
+    SECTION("Visitor may take the chunk's offset") {
+        FloatBuffer out{vector_type(n)};
+        auto set_index = [](std::size_t offset, auto span) {
+            if constexpr(is_mutable_v<decltype(span)>) {
+                for(std::size_t i = 0; i < span.size(); ++i)
+                    span[i] = static_cast<double>(offset + i);
+            }
+        };
+        parallel_visit_contiguous_buffer<tuple_type>(policy, set_index, out);
+        REQUIRE(out == buffer);
+    }
+
+    SECTION("Several buffers") {
+        FloatBuffer out{vector_type(n)};
+        auto twice = [](auto in, auto out) {
+            if constexpr(is_mutable_v<decltype(out)>) {
+                for(std::size_t i = 0; i < in.size(); ++i)
+                    out[i] = in[i] + in[i];
+            }
+        };
+        parallel_visit_contiguous_buffer<tuple_type>(4, twice, buffer, out);
+        auto result = out.value<TestType>();
+        for(std::size_t i = 0; i < n; ++i)
+            REQUIRE(result[i] == TestType(2 * i));
+    }
+
+    SECTION("Policies") {
+        std::mutex mutex;
+        std::set<std::thread::id> ids;
+        auto record = [&](auto) {
+            std::scoped_lock lock(mutex);
+            ids.insert(std::this_thread::get_id());
+        };
+
+        SECTION("seq") {
+            parallel_visit_contiguous_buffer<tuple_type>(execution::seq,
+                                                         record, buffer);
+            REQUIRE(ids == std::set{std::this_thread::get_id()});
+        }
+
+        SECTION("Thread count") {
+            using wtf::parallel::ThreadPool;
+            test_wtf::UseExecutor guard(std::make_shared<ThreadPool>(
+              wtf::parallel::ThreadPoolOptions{.n_threads = 4}));
+            parallel_visit_contiguous_buffer<tuple_type>(policy, record,
+                                                         buffer);
+            REQUIRE(ids.size() <= 3);
+            REQUIRE(ids.count(std::this_thread::get_id()) == 1);
+        }
+
+        SECTION("par") {
+            auto partials = parallel_visit_contiguous_buffer<tuple_type>(
+              execution::par, sum, buffer);
+            REQUIRE(partials.size() == 1);
+        }
+    }
+
+    SECTION("Floating-point environment") {
+        using wtf::fp::FloatEnv;
+        using wtf::parallel::ThreadPool;
+        test_wtf::UseExecutor guard(std::make_shared<ThreadPool>(
+          wtf::parallel::ThreadPoolOptions{.n_threads = 2}));
+        const auto before = FloatEnv::current();
+        FloatEnv env{.rounding = wtf::fp::RoundingMode::upward};
+        if(wtf::fp::supports_flush_to_zero()) env = FloatEnv::flush_denormals();
+
+        std::mutex mutex;
+        std::vector<FloatEnv> envs;
+        auto record = [&](auto) {
+            std::scoped_lock lock(mutex);
+            envs.push_back(FloatEnv::current());
+        };
+        const ExecutionPolicy with_env(3, 64, env);
+        parallel_visit_contiguous_buffer<tuple_type>(with_env, record, buffer);
+        REQUIRE(envs.size() == 16);
+        for(const auto& x : envs) REQUIRE(x == env);
+        REQUIRE(FloatEnv::current() == before);
+    }
+
+    SECTION("Default chunks are aligned and cache-sized") {
+        using span_type = std::span<TestType>;
+        auto grain      = detail_::grain_size<span_type, span_type>({});
+        REQUIRE(grain % detail_::chunk_alignment == 0);
+        REQUIRE(grain * 2 * sizeof(TestType) <= detail_::default_chunk_bytes);
+        REQUIRE(detail_::grain_size<span_type>({1, 10}) == 10);
+    }
+
+    SECTION("parallel_visit_contiguous_buffer_async") {
+        auto future = parallel_visit_contiguous_buffer_async<tuple_type>(
+          policy, sum, buffer);
+        auto partials = wtf::parallel::get(std::move(future));
+        auto total = std::accumulate(partials.begin(), partials.end(), 0.0);
+        REQUIRE(total == 999.0 * 1000.0 / 2.0);
+
+        FloatBuffer other{vector_type(n + 1)};
+        auto noop = [](auto, auto) {};
+        auto error = parallel_visit_contiguous_buffer_async<tuple_type>(
+          policy, noop, buffer, other);
+        REQUIRE_THROWS_AS(error.get(), std::invalid_argument);
+    }
+
+    SECTION("Empty buffers") {
+        FloatBuffer empty(vector_type{});
+        auto partials =
+          parallel_visit_contiguous_buffer<tuple_type>(policy, sum, empty);
+        REQUIRE(partials.empty());
+    }
+
+    SECTION("Throws if sizes differ") {
+        FloatBuffer other{vector_type(n + 1)};
+        auto noop = [](auto, auto) {};
+        REQUIRE_THROWS_AS(parallel_visit_contiguous_buffer<tuple_type>(
+                            policy, noop, buffer, other),
+                          std::invalid_argument);
+    }
+
+    SECTION("Rethrows the visitor's exception") {
+        auto throws = [](std::size_t offset, auto) {
+            if(offset == 128) throw std::runtime_error("chunk 2");
+        };
+        REQUIRE_THROWS_AS(
+          parallel_visit_contiguous_buffer<tuple_type>(policy, throws, buffer),
+          std::runtime_error);
+    }
+}
+
+TEST_CASE("parallel_visit_contiguous_buffer_view") {
+    using tuple_type = std::tuple<float, double>;
+    std::vector<double> values(100, 1.0);
+    BufferView<wtf::fp::Float> view(values.data(), values.size());
+
+    auto scale = [](auto span) {
+        if constexpr(is_mutable_v<decltype(span)>) {
+            for(auto& x : span) x *= 2.0;
+        }
+    };
+    parallel_visit_contiguous_buffer_view<tuple_type>({2, 16}, scale, view);
+    REQUIRE(values == std::vector<double>(100, 2.0));
+}
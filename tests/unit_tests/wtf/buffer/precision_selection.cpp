@@ -0,0 +1,181 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../../test_wtf.hpp"
+#include <cmath>
+#include <complex>
+#include <limits>
+#include <vector>
+#include <wtf/buffer/precision_selection.hpp>
+
+using namespace wtf::buffer;
+using wtf::rtti::wtf_typeid;
+
+namespace {
+
+using tuple_type = wtf::type_traits::tuple_append_t<wtf::default_fp_types,
+                                                    wtf::narrow_fp_types>;
+
+/// Finds the candidate of type @p T in @p analysis
+template<typename T>
+const PrecisionCandidate& candidate(const PrecisionAnalysis& analysis) {
+    for(const auto& c : analysis.candidates)
+        if(c.type == wtf_typeid<T>()) return c;
+    throw std::runtime_error("candidate: type is not a candidate");
+}
+
+} // namespace
+
+TEST_CASE("PrecisionTolerance") {
+    PrecisionTolerance tolerance{.relative = 1.0e-3, .absolute = 1.0e-6};
+    REQUIRE(tolerance.accepts(0.0, 0.0));
+    REQUIRE(tolerance.accepts(1.0e-6, 0.0));
+    REQUIRE_FALSE(tolerance.accepts(2.0e-6, 0.0));
+    REQUIRE(tolerance.accepts(1.0e-3, 1.0));
+    REQUIRE_FALSE(tolerance.accepts(2.0e-3, 1.0));
+}
+
+TEST_CASE("analyze_precision") {
+    using wtf::fp::BFloat16;
+    using wtf::fp::Half;
+
+    SECTION("Small integers fit in 16 bits") {
+        std::vector<double> values(1000);
+        for(std::size_t i = 0; i < values.size(); ++i)
+            values[i] = static_cast<double>(i % 256) - 128.0;
+        FloatBuffer buffer(values);
+        auto rv = analyze_precision<tuple_type>(buffer, {}, 3);
+        REQUIRE(rv.min_magnitude == 1.0);
+        REQUIRE(rv.max_magnitude == 128.0);
+        REQUIRE(rv.candidates.size() == 5);
+        REQUIRE(candidate<Half>(rv).meets_tolerance);
+        REQUIRE(candidate<BFloat16>(rv).meets_tolerance);
+        REQUIRE(candidate<Half>(rv).element_size == 2);
+        REQUIRE(candidate<float>(rv).max_abs_error == 0.0);
+        // Both 16-bit types are exact, so the one listed first wins
+        REQUIRE(rv.selected == wtf_typeid<Half>());
+    }
+
+    SECTION("The tolerance picks the type") {
+        std::vector<double> values(1000);
+        for(std::size_t i = 0; i < values.size(); ++i)
+            values[i] = 1.5 + 0.5 * std::sin(static_cast<double>(i));
+        FloatBuffer buffer(values);
+
+        auto exact = analyze_precision<tuple_type>(buffer, {});
+        REQUIRE(exact.selected == wtf_typeid<double>());
+        REQUIRE_FALSE(candidate<float>(exact).meets_tolerance);
+
+        const auto eps_float = std::numeric_limits<float>::epsilon();
+        auto single = analyze_precision<tuple_type>(
+          buffer, {.relative = 0.5 * eps_float});
+        REQUIRE(single.selected == wtf_typeid<float>());
+        REQUIRE(candidate<float>(single).max_rel_error <= 0.5 * eps_float);
+        REQUIRE(candidate<float>(single).max_rel_error > 0.0);
+
+        // Half has 11 bits, BFloat16 8, so Half is the better 16-bit type
+        auto half = analyze_precision<tuple_type>(buffer, {.relative = 1.0e-3});
+        REQUIRE(half.selected == wtf_typeid<Half>());
+        auto either = analyze_precision<tuple_type>(buffer,
+                                                    {.relative = 1.0e-2});
+        REQUIRE(either.selected == wtf_typeid<Half>());
+        REQUIRE(candidate<BFloat16>(either).meets_tolerance);
+    }
+
+    SECTION("Range") {
+        // 1e6 overflows Half but not BFloat16, 1e-30 underflows Half
+        FloatBuffer big(std::vector<float>{1.0e6f, 1.0f});
+        auto rv = analyze_precision<tuple_type>(big, {.relative = 1.0e-2});
+        REQUIRE(rv.max_magnitude == 1.0e6);
+        REQUIRE(candidate<Half>(rv).max_abs_error ==
+                std::numeric_limits<double>::infinity());
+        REQUIRE(rv.selected == wtf_typeid<BFloat16>());
+
+        FloatBuffer tiny(std::vector<float>{1.0e-30f});
+        rv = analyze_precision<tuple_type>(tiny, {.relative = 1.0e-2});
+        REQUIRE(candidate<Half>(rv).max_rel_error == 1.0);
+        REQUIRE(rv.selected == wtf_typeid<BFloat16>());
+
+        // The absolute tolerance lets tiny values flush to zero
+        using no_bfloat16 = std::tuple<float, double, Half>;
+        rv = analyze_precision<no_bfloat16>(
+          tiny, {.relative = 1.0e-3, .absolute = 1.0e-20});
+        REQUIRE(rv.selected == wtf_typeid<Half>());
+    }
+
+    SECTION("Non-finite values survive") {
+        const auto inf = std::numeric_limits<double>::infinity();
+        const auto nan = std::numeric_limits<double>::quiet_NaN();
+        FloatBuffer buffer(std::vector<double>{inf, nan, -inf, 2.0, 0.0});
+        auto rv = analyze_precision<tuple_type>(buffer, {});
+        REQUIRE(rv.min_magnitude == 2.0);
+        REQUIRE(rv.max_magnitude == 2.0);
+        REQUIRE(rv.selected == wtf_typeid<Half>());
+    }
+
+    SECTION("Complex values") {
+        using complex_tuple = std::tuple<std::complex<float>,
+                                         std::complex<double>, double>;
+        FloatBuffer buffer(
+          std::vector<std::complex<double>>{{1.0, 0.5}, {3.0, -4.0}});
+        auto rv = analyze_precision<complex_tuple>(buffer, {});
+        REQUIRE(rv.candidates.size() == 2);
+        REQUIRE(rv.min_magnitude == std::abs(std::complex<double>{1.0, 0.5}));
+        REQUIRE(rv.max_magnitude == 5.0);
+        REQUIRE(rv.selected == wtf_typeid<std::complex<float>>());
+    }
+
+    SECTION("Throws if the type does not support arithmetic") {
+        using custom_tuple = test_wtf::all_fp_types;
+        FloatBuffer buffer(std::vector<test_wtf::MyCustomFloat>(3));
+        REQUIRE_THROWS_AS(analyze_precision<custom_tuple>(buffer, {}),
+                          std::runtime_error);
+    }
+}
+
+TEST_CASE("compact") {
+    using wtf::fp::Half;
+
+    std::vector<double> values(5000);
+    for(std::size_t i = 0; i < values.size(); ++i)
+        values[i] = static_cast<double>(i % 100) / 4.0;
+    FloatBuffer buffer(values);
+
+    SECTION("Converts to the selected type") {
+        auto type = compact<tuple_type>(buffer, {}, 3);
+        REQUIRE(type == wtf_typeid<Half>());
+        auto compacted = buffer.value<Half>();
+        REQUIRE(compacted.size() == values.size());
+        for(std::size_t i = 0; i < values.size(); ++i)
+            REQUIRE(static_cast<double>(compacted[i]) == values[i]);
+    }
+
+    SECTION("Element-wise conversions") {
+        using no_half = std::tuple<float, double>;
+        REQUIRE(compact<no_half>(buffer, {}, 3) == wtf_typeid<float>());
+        auto compacted = buffer.value<float>();
+        for(std::size_t i = 0; i < values.size(); ++i)
+            REQUIRE(compacted[i] == static_cast<float>(values[i]));
+    }
+
+    SECTION("Leaves the buffer alone if no type is narrower") {
+        values[7]  = 0.1;
+        FloatBuffer other(values);
+        auto* data = other.value<double>().data();
+        REQUIRE(compact<tuple_type>(other, {}) == wtf_typeid<double>());
+        REQUIRE(other.value<double>().data() == data);
+    }
+}
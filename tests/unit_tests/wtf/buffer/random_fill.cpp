@@ -0,0 +1,179 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "../../../test_wtf.hpp"
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <vector>
+#include <wtf/buffer/random_fill.hpp>
+
+using namespace wtf::buffer;
+
+namespace {
+
+/// The mean and standard deviation of @p values
+template<typename T>
+std::pair<double, double> moments(const std::vector<T>& values) {
+    double sum = 0.0, sum2 = 0.0;
+    for(const auto& x : values) {
+        const auto v = static_cast<double>(x);
+        sum += v;
+        sum2 += v * v;
+    }
+    const auto n    = static_cast<double>(values.size());
+    const auto mean = sum / n;
+    return {mean, std::sqrt(sum2 / n - mean * mean)};
+}
+
+} // namespace
+
+TEST_CASE("unit_float/unit_double") {
+    REQUIRE(detail_::unit_float<23>(0) == 0.0f);
+    REQUIRE(detail_::unit_float<23>(0x80000000u) == 0.5f);
+    REQUIRE(detail_::unit_float<23>(~0u) == 1.0f - 0x1.0p-23f);
+    REQUIRE(detail_::unit_float<7>(~0u) == 1.0f - 0x1.0p-7f);
+    REQUIRE(detail_::unit_double<52>(0, 0) == 0.0);
+    REQUIRE(detail_::unit_double<52>(0x40000000u, 0) == 0.25);
+    REQUIRE(detail_::unit_double<52>(~0u, ~0u) == 1.0 - 0x1.0p-52);
+}
+
+TEMPLATE_LIST_TEST_CASE("random_fill", "[wtf]", test_wtf::default_fp_types) {
+    using tuple_type    = test_wtf::default_fp_types;
+    using vector_type   = std::vector<TestType>;
+    const std::size_t n = 10007;
+    const UniformDistribution uniform{-1.0, 3.0};
+
+    vector_type corr(n);
+    random_fill<tuple_type>(BufferView(corr.data(), n), uniform, 42,
+                            execution::seq);
+
+    SECTION("Same values for any policy") {
+        for(std::size_t grain : {0, 1, 3, 64, 1001}) {
+            FloatBuffer buffer(vector_type(n, TestType{0}));
+            random_fill<tuple_type>(buffer, uniform, 42,
+                                    ExecutionPolicy(3, grain));
+            auto values = buffer.value<TestType>();
+            REQUIRE(std::equal(values.begin(), values.end(), corr.begin()));
+        }
+    }
+
+    SECTION("Views get the values of their own indices") {
+        vector_type values(n);
+        const std::size_t first = 5;
+        random_fill<tuple_type>(BufferView(values.data() + first, 7), uniform,
+                                42);
+        REQUIRE(std::equal(values.begin() + first, values.begin() + first + 7,
+                           corr.begin()));
+    }
+
+    SECTION("Different seeds give different values") {
+        vector_type values(n);
+        random_fill<tuple_type>(BufferView(values.data(), n), uniform, 43);
+        REQUIRE(values != corr);
+    }
+
+    SECTION("Uniform") {
+        REQUIRE(std::all_of(corr.begin(), corr.end(), [](auto x) {
+            return x >= TestType{-1} && x < TestType{3};
+        }));
+        auto [mean, stddev] = moments(corr);
+        REQUIRE(std::abs(mean - 1.0) < 0.05);
+        REQUIRE(std::abs(stddev - 4.0 / std::sqrt(12.0)) < 0.05);
+    }
+
+    SECTION("Normal") {
+        vector_type values(n);
+        random_fill<tuple_type>(BufferView(values.data(), n),
+                                NormalDistribution{2.0, 0.5}, 7);
+        REQUIRE(std::all_of(values.begin(), values.end(),
+                            [](auto x) { return std::isfinite(x); }));
+        auto [mean, stddev] = moments(values);
+        REQUIRE(std::abs(mean - 2.0) < 0.02);
+        REQUIRE(std::abs(stddev - 0.5) < 0.02);
+    }
+
+    SECTION("Empty buffers") {
+        FloatBuffer empty(vector_type{});
+        REQUIRE_NOTHROW(random_fill<tuple_type>(empty, uniform, 42));
+    }
+
+    SECTION("Complex parts are consecutive values") {
+        using complex_type = std::complex<TestType>;
+        std::vector<complex_type> values(n / 2);
+        random_fill<std::tuple<complex_type>>(
+          BufferView(values.data(), values.size()), uniform, 42);
+        for(std::size_t i = 0; i < values.size(); ++i) {
+            REQUIRE(values[i].real() == corr[2 * i]);
+            REQUIRE(values[i].imag() == corr[2 * i + 1]);
+        }
+    }
+
+    SECTION("Throws if the buffer does not hold a type in the tuple") {
+        using other_tuple = std::tuple<std::complex<float>>;
+        FloatBuffer buffer(vector_type(n, TestType{0}));
+        REQUIRE_THROWS_AS(random_fill<other_tuple>(buffer, uniform, 42),
+                          std::runtime_error);
+    }
+}
+
+TEST_CASE("random_fill (16-bit types)") {
+    using wtf::fp::BFloat16;
+    using wtf::fp::Half;
+    using tuple_type    = std::tuple<Half, BFloat16>;
+    const std::size_t n = 4099;
+
+    auto check = [&](auto zero) {
+        using value_type = decltype(zero);
+        std::vector<value_type> corr(n), values(n);
+        random_fill<tuple_type>(BufferView(corr.data(), n),
+                                UniformDistribution{}, 1, execution::seq);
+        random_fill<tuple_type>(BufferView(values.data(), n),
+                                UniformDistribution{}, 1,
+                                ExecutionPolicy(2, 7));
+        REQUIRE(values == corr);
+        for(auto x : corr) {
+            REQUIRE(static_cast<float>(x) >= 0.0f);
+            REQUIRE(static_cast<float>(x) < 1.0f);
+        }
+        auto [mean, stddev] = moments(corr);
+        REQUIRE(std::abs(mean - 0.5) < 0.03);
+
+        random_fill<tuple_type>(BufferView(values.data(), n),
+                                NormalDistribution{}, 1);
+        auto [nmean, nstddev] = moments(values);
+        REQUIRE(std::abs(nmean) < 0.05);
+        REQUIRE(std::abs(nstddev - 1.0) < 0.05);
+    };
+    check(Half{});
+    check(BFloat16{});
+}
+
+TEST_CASE("random_fill (custom types)") {
+    using test_wtf::MyCustomFloat;
+    using tuple_type    = std::tuple<double, MyCustomFloat>;
+    const std::size_t n = 100;
+
+    std::vector<double> corr(n);
+    std::vector<MyCustomFloat> values(n);
+    random_fill<tuple_type>(BufferView(corr.data(), n), UniformDistribution{},
+                            3);
+    random_fill<tuple_type>(BufferView(values.data(), n),
+                            UniformDistribution{}, 3);
+    for(std::size_t i = 0; i < n; ++i)
+        REQUIRE(values[i] == MyCustomFloat(corr[i]));
+}
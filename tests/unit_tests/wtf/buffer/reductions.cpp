@@ -0,0 +1,347 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../../test_wtf.hpp"
+#include <cmath>
+#include <complex>
+#include <limits>
+#include <memory>
+#include <vector>
+#include <wtf/buffer/reductions.hpp>
+#include <wtf/parallel/thread_pool.hpp>
+
+using namespace wtf::buffer;
+
+namespace {
+
+/// Values spanning many orders of magnitude, so the rounding depends on the
+/// order of the additions
+template<typename T>
+std::vector<T> ill_conditioned(std::size_t n) {
+    std::vector<T> values(n);
+    for(std::size_t i = 0; i < n; ++i) {
+        const auto x = static_cast<T>(i % 7 == 0 ? 1.0e6 : 1.0);
+        values[i]    = (i % 2 == 0 ? x : -x) * static_cast<T>(std::sin(i));
+    }
+    return values;
+}
+
+/// Blocks of reduction_lanes bigs, ones and -bigs, where big + 1 rounds to
+/// big. Every lane sees big, 1, -big, so naive sums lose all the ones.
+template<typename T>
+std::vector<T> cancelling(std::size_t n_blocks) {
+    constexpr auto k = detail_::reduction_lanes;
+    const auto big   = std::ldexp(T{1}, std::numeric_limits<T>::digits + 1);
+    std::vector<T> values;
+    for(std::size_t i = 0; i < n_blocks; ++i) {
+        values.insert(values.end(), k, big);
+        values.insert(values.end(), k, T{1});
+        values.insert(values.end(), k, -big);
+    }
+    return values;
+}
+
+/// All the accumulation modes
+constexpr Accumulation accumulations[] = {
+  Accumulation::naive, Accumulation::pairwise, Accumulation::neumaier,
+  Accumulation::double_double};
+
+} // namespace
+
+TEST_CASE("pairwise_sum") {
+    std::vector<double> none;
+    REQUIRE(detail_::pairwise_sum(std::span(none)) == 0.0);
+
+    std::vector<double> values{1.0, 2.0, 3.0, 4.0, 5.0};
+    REQUIRE(detail_::pairwise_sum(std::span(values)) == 15.0);
+
+    // ((a + b) + (c + d)): 1e16 + 1 rounds to 1e16, but -1e16 + 1e16 is 0
+    std::vector<double> order{1.0e16, 1.0, -1.0e16, 1.0};
+    REQUIRE(detail_::pairwise_sum(std::span(order)) == 0.0);
+}
+
+TEMPLATE_LIST_TEST_CASE("two_sum/Partial", "[wtf]",
+                        test_wtf::default_fp_types) {
+    constexpr auto digits = std::numeric_limits<TestType>::digits;
+    const auto big        = std::ldexp(TestType{1}, digits);
+    TestType s, e;
+    detail_::two_sum(TestType{1}, big, s, e);
+    REQUIRE(s == big);
+    REQUIRE(e == TestType{1});
+    detail_::fast_two_sum(big, TestType{1}, s, e);
+    REQUIRE(s == big);
+    REQUIRE(e == TestType{1});
+
+    detail_::Partial<TestType> lhs{big, TestType{1}}, rhs{-big, TestType{1}};
+    auto rv = lhs + rhs;
+    REQUIRE(rv.hi == TestType{2});
+    REQUIRE(rv.lo == TestType{0});
+    REQUIRE(lhs.value() == big);
+}
+
+TEMPLATE_LIST_TEST_CASE("LaneAccumulator", "[wtf]",
+                        test_wtf::default_fp_types) {
+    using detail_::LaneAccumulator;
+    constexpr auto digits = std::numeric_limits<TestType>::digits;
+    const auto big        = std::ldexp(TestType{1}, digits + 1);
+    auto add_all          = [&](auto& acc) {
+        acc.add(0, big);
+        acc.add(0, TestType{1});
+        acc.add(0, -big);
+        acc.add(1, TestType{2});
+        return acc.result().value();
+    };
+
+    LaneAccumulator<Accumulation::naive, TestType> naive;
+    REQUIRE(add_all(naive) == TestType{2});
+    LaneAccumulator<Accumulation::neumaier, TestType> neumaier;
+    REQUIRE(add_all(neumaier) == TestType{3});
+    LaneAccumulator<Accumulation::double_double, TestType> dd;
+    REQUIRE(add_all(dd) == TestType{3});
+
+    SECTION("add_product") {
+        // (1 + e)(1 - e) = 1 - e^2 rounds to 1
+        const auto eps = std::numeric_limits<TestType>::epsilon();
+        LaneAccumulator<Accumulation::double_double, TestType> exact;
+        exact.add_product(0, 1 + eps, 1 - eps);
+        exact.add(1, TestType{-1});
+        REQUIRE(exact.result().value() == -eps * eps);
+
+        LaneAccumulator<Accumulation::neumaier, TestType> rounded;
+        rounded.add_product(0, 1 + eps, 1 - eps);
+        rounded.add(1, TestType{-1});
+        REQUIRE(rounded.result().value() == TestType{0});
+    }
+}
+
+TEMPLATE_LIST_TEST_CASE("sum", "[wtf]", test_wtf::default_fp_types) {
+    using tuple_type = test_wtf::default_fp_types;
+    using wtf::fp::float_cast;
+
+    SECTION("Exact sums") {
+        std::vector<TestType> values(10000);
+        for(std::size_t i = 0; i < values.size(); ++i)
+            values[i] = TestType(i % 100);
+        FloatBuffer buffer(values);
+        const TestType corr(495000);
+        for(auto mode : {ReductionMode::fast, ReductionMode::reproducible}) {
+            auto rv = sum<tuple_type>(buffer, mode);
+            REQUIRE(float_cast<TestType>(rv) == corr);
+            rv = sum<tuple_type>(buffer, mode, execution::seq);
+            REQUIRE(float_cast<TestType>(rv) == corr);
+        }
+    }
+
+    SECTION("Reproducible sums do not depend on the thread count") {
+        FloatBuffer buffer(ill_conditioned<TestType>(100003));
+        for(auto acc : accumulations) {
+            const ReductionOptions opts(ReductionMode::reproducible, acc);
+            const auto corr = sum<tuple_type>(buffer, opts, execution::seq);
+            for(std::size_t n_threads : {2, 3, 8, 64})
+                REQUIRE(sum<tuple_type>(buffer, opts, n_threads) == corr);
+
+            using wtf::parallel::ThreadPool;
+            test_wtf::UseExecutor guard(std::make_shared<ThreadPool>(
+              wtf::parallel::ThreadPoolOptions{.n_threads = 3}));
+            REQUIRE(sum<tuple_type>(buffer, opts) == corr);
+            REQUIRE(sum<tuple_type>(buffer, opts, 5) == corr);
+        }
+    }
+
+    SECTION("Compensated sums are exact for cancelling values") {
+        FloatBuffer buffer(cancelling<TestType>(1000));
+        const TestType corr(8000);
+        for(auto mode : {ReductionMode::fast, ReductionMode::reproducible}) {
+            for(std::size_t n_threads : {1, 3}) {
+                auto naive = sum<tuple_type>(buffer, mode, n_threads);
+                REQUIRE(float_cast<TestType>(naive) != corr);
+                for(auto acc :
+                    {Accumulation::neumaier, Accumulation::double_double}) {
+                    const ReductionOptions opts(mode, acc);
+                    auto rv = sum<tuple_type>(buffer, opts, n_threads);
+                    REQUIRE(float_cast<TestType>(rv) == corr);
+                }
+            }
+        }
+    }
+
+    SECTION("Pairwise and compensated sums drift less than naive ones") {
+        // n is a power of 2, so n * x is exact
+        const std::size_t n = 1 << 20;
+        const TestType x(0.1);
+        const auto exact = static_cast<long double>(x) * n;
+        FloatBuffer buffer(std::vector<TestType>(n, x));
+        auto error = [&](Accumulation acc) {
+            auto rv = sum<tuple_type>(buffer, acc, execution::seq);
+            auto y  = static_cast<long double>(float_cast<TestType>(rv));
+            return std::abs(y - exact);
+        };
+        const auto pairwise = error(Accumulation::pairwise);
+        REQUIRE(pairwise < error(Accumulation::naive));
+        REQUIRE(error(Accumulation::neumaier) <= pairwise);
+        REQUIRE(error(Accumulation::double_double) <= pairwise);
+    }
+
+    SECTION("Fast sums are close to reproducible ones") {
+        auto values = ill_conditioned<TestType>(100003);
+        double l1   = 0.0;
+        for(auto x : values) l1 += std::abs(static_cast<double>(x));
+
+        FloatBuffer buffer(values);
+        auto exact = sum<tuple_type>(buffer, ReductionMode::reproducible);
+        auto corr  = static_cast<double>(float_cast<TestType>(exact));
+        for(std::size_t n_threads : {1, 3, 8}) {
+            auto rv = sum<tuple_type>(buffer, ReductionMode::fast, n_threads);
+            auto x  = static_cast<double>(float_cast<TestType>(rv));
+            REQUIRE(std::abs(x - corr) <= 1.0e-4 * l1);
+        }
+    }
+
+    SECTION("Empty buffers sum to zero") {
+        FloatBuffer buffer(std::vector<TestType>{});
+        auto rv = sum<tuple_type>(buffer, ReductionMode::reproducible);
+        REQUIRE(float_cast<TestType>(rv) == TestType{0});
+    }
+
+    SECTION("Throws if the buffer does not hold a type in the tuple") {
+        using other_tuple = std::tuple<std::complex<float>>;
+        FloatBuffer buffer(std::vector<TestType>(3));
+        REQUIRE_THROWS_AS(sum<other_tuple>(buffer), std::runtime_error);
+    }
+}
+
+TEST_CASE("sum of complex values") {
+    using value_type = std::complex<double>;
+    using tuple_type = std::tuple<value_type>;
+    std::vector<value_type> values(5000, value_type{1.0, -2.0});
+    FloatBuffer buffer(values);
+    auto rv = sum<tuple_type>(buffer, ReductionMode::reproducible);
+    REQUIRE(wtf::fp::float_cast<value_type>(rv) == value_type{5000, -10000});
+}
+
+TEST_CASE("compensated sum of complex values") {
+    using value_type = std::complex<double>;
+    using tuple_type = std::tuple<value_type>;
+    std::vector<value_type> values;
+    for(auto x : cancelling<double>(100)) values.emplace_back(x, -x);
+    FloatBuffer buffer(values);
+    const ReductionOptions opts(ReductionMode::fast, Accumulation::neumaier);
+    auto rv = sum<tuple_type>(buffer, opts, 3);
+    REQUIRE(wtf::fp::float_cast<value_type>(rv) == value_type{800, -800});
+}
+
+TEMPLATE_LIST_TEST_CASE("dot", "[wtf]", test_wtf::default_fp_types) {
+    using tuple_type = test_wtf::default_fp_types;
+    using wtf::fp::float_cast;
+
+    SECTION("Matches sum when multiplied by ones") {
+        auto values = cancelling<TestType>(100);
+        FloatBuffer lhs(values);
+        FloatBuffer ones(std::vector<TestType>(values.size(), TestType{1}));
+        for(auto acc : accumulations) {
+            for(auto mode :
+                {ReductionMode::fast, ReductionMode::reproducible}) {
+                const ReductionOptions opts(mode, acc);
+                REQUIRE(dot<tuple_type>(lhs, ones, opts, 3) ==
+                        sum<tuple_type>(lhs, opts, 3));
+            }
+        }
+    }
+
+    SECTION("double_double keeps the rounding error of the products") {
+        const auto eps = std::numeric_limits<TestType>::epsilon();
+        FloatBuffer lhs(std::vector<TestType>{1 + eps, 1});
+        FloatBuffer rhs(std::vector<TestType>{1 - eps, -1});
+        auto rv = dot<tuple_type>(lhs, rhs, Accumulation::double_double);
+        REQUIRE(float_cast<TestType>(rv) == -eps * eps);
+        rv = dot<tuple_type>(lhs, rhs, Accumulation::neumaier);
+        REQUIRE(float_cast<TestType>(rv) == TestType{0});
+    }
+
+    SECTION("Throws if the sizes differ") {
+        FloatBuffer lhs(std::vector<TestType>(3));
+        FloatBuffer rhs(std::vector<TestType>(2));
+        REQUIRE_THROWS_AS(dot<tuple_type>(lhs, rhs), std::invalid_argument);
+    }
+}
+
+TEMPLATE_LIST_TEST_CASE("norm", "[wtf]", test_wtf::default_fp_types) {
+    using tuple_type = test_wtf::default_fp_types;
+    using wtf::fp::float_cast;
+
+    FloatBuffer buffer(std::vector<TestType>{3, -4});
+    for(auto acc : accumulations) {
+        auto rv = norm<tuple_type>(buffer, acc);
+        REQUIRE(float_cast<TestType>(rv) == TestType{5});
+    }
+
+    FloatBuffer ones(std::vector<TestType>(10000, TestType{1}));
+    const ReductionOptions opts(ReductionMode::reproducible,
+                                Accumulation::double_double);
+    auto rv = norm<tuple_type>(ones, opts, 3);
+    REQUIRE(float_cast<TestType>(rv) == TestType{100});
+
+    SECTION("Complex values") {
+        using complex_type = std::complex<TestType>;
+        using complex_tuple = std::tuple<complex_type>;
+        FloatBuffer cmplx(std::vector<complex_type>{{3, 4}, {0, 0}});
+        auto crv = norm<complex_tuple>(cmplx, Accumulation::neumaier);
+        REQUIRE(float_cast<TestType>(crv) == TestType{5});
+    }
+}
+
+TEST_CASE("reductions with extended_fp_types") {
+    // Instantiates every accumulation mode for __float128 too (if available)
+    using tuple_type = wtf::extended_fp_types;
+    using wtf::fp::float_cast;
+
+    FloatBuffer buffer(std::vector<double>{3, -4});
+    for(auto acc : accumulations) {
+        auto rv = sum<tuple_type>(buffer, acc);
+        REQUIRE(float_cast<double>(rv) == -1.0);
+        rv = dot<tuple_type>(buffer, buffer, acc);
+        REQUIRE(float_cast<double>(rv) == 25.0);
+        rv = norm<tuple_type>(buffer, acc);
+        REQUIRE(float_cast<double>(rv) == 5.0);
+    }
+
+#ifdef WTF_HAS_FLOAT128
+    using wtf::fp::float128;
+    SECTION("__float128") {
+        // 2^-100 is lost when rounding to long double
+        const auto tiny = float128{1} / (float128{1ull << 50} *
+                                         float128{1ull << 50});
+        FloatBuffer values(std::vector<float128>{1, tiny, -1});
+        FloatBuffer squares(std::vector<float128>{3, -4});
+        for(auto acc : accumulations) {
+            auto rv = sum<tuple_type>(values, acc);
+            REQUIRE(float_cast<float128>(rv) == tiny);
+            rv = dot<tuple_type>(squares, squares, acc);
+            REQUIRE(float_cast<float128>(rv) == float128{25});
+            rv = norm<tuple_type>(squares, acc);
+            REQUIRE(float_cast<float128>(rv) == float128{5});
+        }
+
+        // The root of 2 is refined past long double precision
+        FloatBuffer two(std::vector<float128>{1, 1});
+        auto rv          = norm<tuple_type>(two);
+        const auto root  = float_cast<float128>(rv);
+        const auto error = root * root - float128{2};
+        REQUIRE(error < tiny);
+        REQUIRE(-error < tiny);
+    }
+#endif
+}
@@ -0,0 +1,225 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "../../../test_wtf.hpp"
+#include <cmath>
+#include <complex>
+#include <limits>
+#include <vector>
+#include <wtf/buffer/statistics.hpp>
+
+using namespace wtf::buffer;
+
+namespace {
+
+/// Is @p x within @p tol of @p corr, relative to the magnitude of @p corr?
+bool close(double x, double corr, double tol = 1e-12) {
+    return std::abs(x - corr) <= tol * std::max(1.0, std::abs(corr));
+}
+
+} // namespace
+
+TEST_CASE("Statistics") {
+    Statistics stats;
+    REQUIRE(stats.size() == 0);
+    REQUIRE(stats.variance() == 0.0);
+    REQUIRE(stats.sample_variance() == 0.0);
+
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    const double inf = std::numeric_limits<double>::infinity();
+    for(double x : {2.0, 4.0, nan, 4.0, -inf, 4.0, 5.0, 5.0, 7.0, 9.0})
+        stats.add(x);
+
+    SECTION("add") {
+        REQUIRE(stats.count == 8);
+        REQUIRE(stats.nan_count == 1);
+        REQUIRE(stats.inf_count == 1);
+        REQUIRE(stats.size() == 10);
+        REQUIRE(stats.mean == 5.0);
+        REQUIRE(stats.m2 == 32.0);
+        REQUIRE(stats.variance() == 4.0);
+        REQUIRE(stats.stddev() == 2.0);
+        REQUIRE(close(stats.sample_variance(), 32.0 / 7.0));
+        REQUIRE(stats.min == 2.0);
+        REQUIRE(stats.max == 9.0);
+    }
+
+    SECTION("merge") {
+        Statistics a, b;
+        for(double x : {2.0, 4.0, nan, 4.0}) a.add(x);
+        for(double x : {-inf, 4.0, 5.0, 5.0, 7.0, 9.0}) b.add(x);
+        REQUIRE(a.merge(b).count == 8);
+        REQUIRE(a.mean == stats.mean);
+        REQUIRE(close(a.m2, stats.m2));
+        REQUIRE(a.min == stats.min);
+        REQUIRE(a.max == stats.max);
+        REQUIRE(a.size() == stats.size());
+
+        Statistics empty;
+        auto copy = stats;
+        REQUIRE(copy.merge(empty) == stats);
+        REQUIRE(empty.merge(stats) == stats);
+    }
+}
+
+TEST_CASE("Histogram") {
+    Histogram histogram(0.0, 1.0, 4);
+    REQUIRE(histogram.lower() == 0.0);
+    REQUIRE(histogram.upper() == 1.0);
+    REQUIRE(histogram.n_bins() == 4);
+    REQUIRE(histogram.size() == 0);
+
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    const double inf = std::numeric_limits<double>::infinity();
+    const std::vector<double> values{0.0,  0.1, 0.25, 0.3, 0.99, 1.0, -0.01,
+                                     -inf, inf, nan,  0.5, 0.75, 0.74};
+
+    SECTION("add") {
+        histogram.add(values);
+        REQUIRE(std::vector(histogram.counts().begin(),
+                            histogram.counts().end()) ==
+                std::vector<std::size_t>{2, 2, 2, 2});
+        REQUIRE(histogram.underflow() == 2);
+        REQUIRE(histogram.overflow() == 2);
+        REQUIRE(histogram.nan_count() == 1);
+        REQUIRE(histogram.size() == values.size());
+
+        Histogram one_at_a_time(0.0, 1.0, 4);
+        for(auto x : values) one_at_a_time.add(x);
+        REQUIRE(one_at_a_time == histogram);
+    }
+
+    SECTION("merge") {
+        Histogram other(0.0, 1.0, 4);
+        histogram.add(std::span(values).first(5));
+        other.add(std::span(values).subspan(5));
+        Histogram corr(0.0, 1.0, 4);
+        corr.add(values);
+        REQUIRE(histogram.merge(other) == corr);
+
+        Histogram different(0.0, 2.0, 4);
+        REQUIRE_THROWS_AS(histogram.merge(different), std::invalid_argument);
+        REQUIRE(histogram == corr);
+    }
+
+    SECTION("Throws if the binning is bad") {
+        REQUIRE_THROWS_AS(Histogram(0.0, 1.0, 0), std::invalid_argument);
+        REQUIRE_THROWS_AS(Histogram(1.0, 1.0, 4), std::invalid_argument);
+        REQUIRE_THROWS_AS(Histogram(1.0, 0.0, 4), std::invalid_argument);
+        REQUIRE_THROWS_AS(Histogram(0.0, inf, 4), std::invalid_argument);
+        REQUIRE_THROWS_AS(Histogram(nan, 1.0, 4), std::invalid_argument);
+    }
+}
+
+TEMPLATE_LIST_TEST_CASE("statistics", "[wtf]", test_wtf::default_fp_types) {
+    using tuple_type = test_wtf::default_fp_types;
+    using limits     = std::numeric_limits<TestType>;
+
+    // Several blocks, and a partial one, per thread
+    const std::size_t n = 5003;
+    std::vector<TestType> values(n);
+    for(std::size_t i = 0; i < n; ++i)
+        values[i] = static_cast<TestType>((i * 37) % 1000) / TestType{8};
+    values[7]    = limits::quiet_NaN();
+    values[2000] = limits::infinity();
+    values[4321] = -limits::infinity();
+
+    Statistics corr;
+    for(auto x : values) corr.add(static_cast<double>(x));
+    FloatBuffer buffer(values);
+
+    auto check = [&](const Statistics& stats) {
+        REQUIRE(stats.count == corr.count);
+        REQUIRE(stats.nan_count == 1);
+        REQUIRE(stats.inf_count == 2);
+        REQUIRE(close(stats.mean, corr.mean));
+        REQUIRE(close(stats.m2, corr.m2));
+        REQUIRE(stats.min == corr.min);
+        REQUIRE(stats.max == corr.max);
+    };
+
+    SECTION("statistics") {
+        check(statistics<tuple_type>(buffer));
+        check(statistics<tuple_type>(buffer, execution::seq));
+        check(statistics<tuple_type>(buffer, ExecutionPolicy(3)));
+    }
+
+    SECTION("With a histogram") {
+        Histogram histogram(0.0, 100.0, 10);
+        check(statistics<tuple_type>(buffer, histogram, ExecutionPolicy(3)));
+        Histogram hist_corr(0.0, 100.0, 10);
+        for(auto x : values) hist_corr.add(static_cast<double>(x));
+        REQUIRE(histogram == hist_corr);
+
+        // Streams: histograms collect, statistics merge
+        auto stats = statistics<tuple_type>(buffer, histogram);
+        REQUIRE(histogram.size() == 2 * n);
+        REQUIRE(stats.merge(stats).count == 2 * corr.count);
+    }
+
+    SECTION("Streamed pieces") {
+        Statistics stats;
+        for(std::size_t i = 0; i < n; i += 1000) {
+            const auto size = std::min<std::size_t>(1000, n - i);
+            stats.merge(statistics<tuple_type>(
+              BufferView<const wtf::fp::Float>(values.data() + i, size)));
+        }
+        check(stats);
+    }
+
+    SECTION("Empty buffers") {
+        FloatBuffer empty(std::vector<TestType>{});
+        REQUIRE(statistics<tuple_type>(empty) == Statistics{});
+    }
+
+    SECTION("Throws if the elements are complex") {
+        using complex_type = std::complex<TestType>;
+        FloatBuffer complex_buffer(std::vector<complex_type>(3));
+        REQUIRE_THROWS_AS(
+          statistics<std::tuple<complex_type>>(complex_buffer),
+          std::invalid_argument);
+    }
+}
+
+TEST_CASE("statistics (16-bit types)") {
+    using wtf::fp::BFloat16;
+    using wtf::fp::Half;
+    using tuple_type = std::tuple<Half, BFloat16>;
+
+    std::vector<Half> values{Half(1.0f), Half(2.0f), Half::from_bits(0x7e00),
+                             Half(3.0f), Half::from_bits(0xfc00)};
+    auto stats = statistics<tuple_type>(FloatBuffer(values));
+    REQUIRE(stats.count == 3);
+    REQUIRE(stats.nan_count == 1);
+    REQUIRE(stats.inf_count == 1);
+    REQUIRE(stats.mean == 2.0);
+    REQUIRE(stats.m2 == 2.0);
+
+    std::vector<BFloat16> bvalues{BFloat16(-1.0f), BFloat16(1.0f)};
+    Histogram histogram(-1.0, 1.0, 2);
+    stats = statistics<tuple_type>(FloatBuffer(bvalues), histogram);
+    REQUIRE(stats.min == -1.0);
+    REQUIRE(stats.max == 1.0);
+    REQUIRE(histogram.counts()[0] == 1);
+    REQUIRE(histogram.overflow() == 1);
+}
+
+TEST_CASE("statistics (custom types)") {
+    using tuple_type = std::tuple<test_wtf::MyCustomFloat>;
+    FloatBuffer buffer(std::vector<test_wtf::MyCustomFloat>(3));
+    REQUIRE_THROWS_AS(statistics<tuple_type>(buffer), std::invalid_argument);
+}
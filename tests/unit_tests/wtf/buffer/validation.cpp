@@ -0,0 +1,183 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../../test_wtf.hpp"
+#include <complex>
+#include <limits>
+#include <vector>
+#include <wtf/buffer/validation.hpp>
+#include <wtf/parallel/thread_pool.hpp>
+
+using namespace wtf::buffer;
+
+TEMPLATE_LIST_TEST_CASE("is_nonfinite/is_subnormal", "[wtf]",
+                        test_wtf::default_fp_types) {
+    using limits   = std::numeric_limits<TestType>;
+    const auto inf = limits::infinity();
+    const auto nan = limits::quiet_NaN();
+    const auto min = limits::min();
+
+    for(auto x : {TestType{0}, TestType{1}, -limits::max(), min}) {
+        REQUIRE_FALSE(detail_::is_nonfinite(x));
+        REQUIRE_FALSE(detail_::is_subnormal(x));
+    }
+    for(auto x : {inf, -inf, nan}) {
+        REQUIRE(detail_::is_nonfinite(x));
+        REQUIRE_FALSE(detail_::is_subnormal(x));
+    }
+    for(auto x : {limits::denorm_min(), -min / 2}) {
+        REQUIRE_FALSE(detail_::is_nonfinite(x));
+        REQUIRE(detail_::is_subnormal(x));
+    }
+
+    using complex_type = std::complex<TestType>;
+    REQUIRE(detail_::is_nonfinite(complex_type{1, nan}));
+    REQUIRE_FALSE(detail_::is_nonfinite(complex_type{1, 2}));
+    REQUIRE(detail_::is_subnormal(complex_type{min / 2, 1}));
+}
+
+TEST_CASE("is_nonfinite/is_subnormal (16-bit types)") {
+    using wtf::fp::BFloat16;
+    using wtf::fp::Half;
+    REQUIRE(detail_::is_nonfinite(Half::from_bits(0x7c00)));
+    REQUIRE(detail_::is_nonfinite(Half::from_bits(0xfe00)));
+    REQUIRE_FALSE(detail_::is_nonfinite(Half::from_bits(0x7bff)));
+    REQUIRE(detail_::is_subnormal(Half::from_bits(0x8001)));
+    REQUIRE_FALSE(detail_::is_subnormal(Half::from_bits(0x8000)));
+
+    REQUIRE(detail_::is_nonfinite(BFloat16::from_bits(0x7f80)));
+    REQUIRE_FALSE(detail_::is_nonfinite(BFloat16::from_bits(0x3f80)));
+    REQUIRE(detail_::is_subnormal(BFloat16::from_bits(0x0040)));
+}
+
+#ifdef WTF_HAS_FLOAT128
+TEST_CASE("is_nonfinite/is_subnormal (__float128)") {
+    using wtf::fp::float128;
+    using tuple_type = wtf::extended_fp_types;
+
+    auto pow2 = [](int n) {
+        float128 rv{1};
+        for(; n > 0; --n) rv *= 2;
+        for(; n < 0; ++n) rv /= 2;
+        return rv;
+    };
+    // Normal values span 2^-16382 to just below 2^16384
+    const auto min  = pow2(-16382);
+    const auto tiny = pow2(-16440);
+    const auto inf  = pow2(16384);
+    const auto nan  = inf - inf;
+
+    for(auto x : {float128{0}, float128{1}, min, -min}) {
+        REQUIRE_FALSE(detail_::is_nonfinite(x));
+        REQUIRE_FALSE(detail_::is_subnormal(x));
+    }
+    for(auto x : {inf, -inf, nan}) {
+        REQUIRE(detail_::is_nonfinite(x));
+        REQUIRE_FALSE(detail_::is_subnormal(x));
+    }
+    for(auto x : {tiny, -tiny, min / 2, pow2(-16494)}) {
+        REQUIRE_FALSE(detail_::is_nonfinite(x));
+        REQUIRE(detail_::is_subnormal(x));
+    }
+
+    FloatBuffer buffer(std::vector<float128>{1, tiny, inf, -tiny, 2});
+    REQUIRE(find_first_nonfinite<tuple_type>(buffer) == 2);
+    REQUIRE(count_nonfinite<tuple_type>(buffer) == 1);
+    REQUIRE(count_subnormal<tuple_type>(buffer) == 2);
+}
+#endif
+
+TEMPLATE_LIST_TEST_CASE("Validation", "[wtf]", test_wtf::default_fp_types) {
+    using tuple_type = test_wtf::default_fp_types;
+    using limits     = std::numeric_limits<TestType>;
+
+    // Several chunks of 64 elements and scan blocks of 1024
+    const std::size_t n = 5000;
+    std::vector<TestType> values(n, TestType{1});
+    values[1500] = limits::quiet_NaN();
+    values[70]   = limits::denorm_min();
+    values[4000] = -limits::infinity();
+    values[4999] = limits::min() / 4;
+    FloatBuffer buffer(values);
+    FloatBuffer clean(std::vector<TestType>(n, TestType{2}));
+    const ExecutionPolicy policy(3, 64);
+
+    SECTION("has_nonfinite") {
+        REQUIRE(has_nonfinite<tuple_type>(buffer));
+        REQUIRE(has_nonfinite<tuple_type>(buffer, policy));
+        REQUIRE_FALSE(has_nonfinite<tuple_type>(clean, policy));
+    }
+
+    SECTION("count_nonfinite") {
+        REQUIRE(count_nonfinite<tuple_type>(buffer) == 2);
+        REQUIRE(count_nonfinite<tuple_type>(buffer, policy) == 2);
+        REQUIRE(count_nonfinite<tuple_type>(clean) == 0);
+    }
+
+    SECTION("find_first_nonfinite") {
+        REQUIRE(find_first_nonfinite<tuple_type>(buffer) == 1500);
+        REQUIRE(find_first_nonfinite<tuple_type>(clean) == std::nullopt);
+
+        using wtf::parallel::ThreadPool;
+        test_wtf::UseExecutor guard(std::make_shared<ThreadPool>(
+          wtf::parallel::ThreadPoolOptions{.n_threads = 3}));
+        for(std::size_t n_threads : {1, 2, 3, 8}) {
+            const ExecutionPolicy p(n_threads, 64);
+            REQUIRE(find_first_nonfinite<tuple_type>(buffer, p) == 1500);
+        }
+    }
+
+    SECTION("count_subnormal") {
+        REQUIRE(count_subnormal<tuple_type>(buffer) == 2);
+        REQUIRE(count_subnormal<tuple_type>(buffer, policy) == 2);
+        REQUIRE(count_subnormal<tuple_type>(clean) == 0);
+    }
+
+    SECTION("BufferView") {
+        BufferView<const wtf::fp::Float> view(values.data() + 2000, 2001);
+        REQUIRE(find_first_nonfinite<tuple_type>(view) == 2000);
+        REQUIRE(count_subnormal<tuple_type>(view) == 0);
+    }
+
+    SECTION("Empty buffers") {
+        FloatBuffer empty(std::vector<TestType>{});
+        REQUIRE_FALSE(has_nonfinite<tuple_type>(empty));
+        REQUIRE(count_nonfinite<tuple_type>(empty) == 0);
+        REQUIRE(find_first_nonfinite<tuple_type>(empty) == std::nullopt);
+    }
+
+    SECTION("Throws if the buffer does not hold a type in the tuple") {
+        using other_tuple = std::tuple<std::complex<float>>;
+        REQUIRE_THROWS_AS(has_nonfinite<other_tuple>(buffer),
+                          std::runtime_error);
+    }
+}
+
+TEST_CASE("Validation of complex values") {
+    using value_type = std::complex<double>;
+    using tuple_type = std::tuple<value_type>;
+    const auto inf   = std::numeric_limits<double>::infinity();
+    const auto tiny  = std::numeric_limits<double>::denorm_min();
+    std::vector<value_type> values(100, value_type{1, 1});
+    values[10] = value_type{1, inf};
+    values[20] = value_type{inf, inf};
+    values[30] = value_type{tiny, tiny};
+    FloatBuffer buffer(values);
+
+    REQUIRE(find_first_nonfinite<tuple_type>(buffer) == 10);
+    REQUIRE(count_nonfinite<tuple_type>(buffer) == 2);
+    REQUIRE(count_subnormal<tuple_type>(buffer) == 1);
+}
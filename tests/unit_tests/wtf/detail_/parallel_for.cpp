@@ -0,0 +1,114 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "../../../test_wtf.hpp"
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+#include <wtf/detail_/parallel_for.hpp>
+#include <wtf/parallel/thread_pool.hpp>
+
+using namespace wtf::detail_;
+
+namespace {
+
+/// Runs tasks immediately, recording the hint each was submitted with
+class HintRecorder : public wtf::parallel::Executor {
+public:
+    std::vector<size_type> hints;
+
+protected:
+    void submit_(task_type task) override { task(); }
+    void submit_to_(task_type task, size_type hint) override {
+        hints.push_back(hint);
+        task();
+    }
+    size_type concurrency_() const noexcept override { return 4; }
+};
+
+} // namespace
+
+TEST_CASE("static_chunk_size") {
+    REQUIRE(static_chunk_size(10, 1) == 10);
+    REQUIRE(static_chunk_size(10, 4) == 3);
+    REQUIRE(static_chunk_size(10, 0) == 10);
+    REQUIRE(static_chunk_size(3, 8) == 1);
+    REQUIRE(static_chunk_size(0, 4) == 1);
+}
+
+TEST_CASE("parallel_for") {
+    using range_type = std::pair<std::size_t, std::size_t>;
+    std::mutex mutex;
+    std::set<range_type> ranges;
+    std::set<std::thread::id> ids;
+    auto fxn = [&](std::size_t begin, std::size_t end) {
+        std::scoped_lock lock(mutex);
+        ranges.emplace(begin, end);
+        ids.insert(std::this_thread::get_id());
+    };
+
+    SECTION("One thread") {
+        parallel_for(10, 1, fxn);
+        REQUIRE(ranges == std::set<range_type>{{0, 10}});
+        REQUIRE(ids == std::set{std::this_thread::get_id()});
+    }
+
+    SECTION("Several threads") {
+        using wtf::parallel::ThreadPool;
+        test_wtf::UseExecutor guard(std::make_shared<ThreadPool>(
+          wtf::parallel::ThreadPoolOptions{.n_threads = 3}));
+        parallel_for(10, 4, fxn);
+        std::set<range_type> corr{{0, 3}, {3, 6}, {6, 9}, {9, 10}};
+        REQUIRE(ranges == corr);
+        REQUIRE(ids.size() <= 4);
+        REQUIRE(ids.count(std::this_thread::get_id()) == 1);
+    }
+
+    SECTION("Chunk i is submitted with hint i - 1") {
+        auto precorder = std::make_shared<HintRecorder>();
+        test_wtf::UseExecutor guard(precorder);
+        parallel_for(10, 4, fxn);
+        REQUIRE(precorder->hints == std::vector<std::size_t>{0, 1, 2});
+        REQUIRE(ids == std::set{std::this_thread::get_id()});
+    }
+
+    SECTION("Nested calls do not deadlock") {
+        using wtf::parallel::ThreadPool;
+        test_wtf::UseExecutor guard(std::make_shared<ThreadPool>(
+          wtf::parallel::ThreadPoolOptions{.n_threads = 2}));
+        std::atomic<std::size_t> count = 0;
+        parallel_for(8, 8, [&](std::size_t, std::size_t) {
+            parallel_for(8, 8, [&](std::size_t begin, std::size_t end) {
+                count += end - begin;
+            });
+        });
+        REQUIRE(count == 64);
+    }
+
+    SECTION("More threads than elements") {
+        parallel_for(2, 8, fxn);
+        REQUIRE(ranges == std::set<range_type>{{0, 1}, {1, 2}});
+    }
+
+    SECTION("No elements") {
+        parallel_for(0, 4, fxn);
+        REQUIRE(ranges == std::set<range_type>{{0, 0}});
+    }
+}
@@ -0,0 +1,67 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../../test_wtf.hpp"
+#include <set>
+#include <wtf/detail_/philox.hpp>
+
+using namespace wtf::detail_;
+
+TEST_CASE("philox2x32") {
+    SECTION("Known answers") {
+        // Test vectors from the Random123 distribution
+        REQUIRE(philox2x32(0, 0) == philox2x32_type{0xff1dae59, 0x6cd10df2});
+        REQUIRE(philox2x32(~std::uint64_t{0}, ~std::uint32_t{0}) ==
+                philox2x32_type{0x2c3f628b, 0xab4fd7ad});
+        REQUIRE(philox2x32(0x85a308d3243f6a88ull, 0x13198a2e) ==
+                philox2x32_type{0xdd7ce038, 0xf62a4c12});
+    }
+
+    SECTION("philox2x32_key") {
+        REQUIRE(philox2x32_key(0) == philox2x32(0, 0)[0]);
+        // Seeds differing only in their high words give different keys
+        std::set<std::uint32_t> keys;
+        for(std::uint64_t i = 0; i < 16; ++i)
+            keys.insert(philox2x32_key(i << 32));
+        REQUIRE(keys.size() == 16);
+    }
+}
+
+TEST_CASE("philox4x32") {
+    SECTION("Known answers") {
+        // Test vectors from the Random123 distribution
+        REQUIRE(philox4x32(philox4x32_type{}, philox4x32_key_type{}) ==
+                philox4x32_type{0x6627e8d5, 0xe169c58d, 0xbc57ac4c,
+                                0x9b00dbd8});
+        const auto ones = ~std::uint32_t{0};
+        REQUIRE(philox4x32(philox4x32_type{ones, ones, ones, ones},
+                           philox4x32_key_type{ones, ones}) ==
+                philox4x32_type{0x408f276d, 0x41c83b0e, 0xa20bc7c6,
+                                0x6d5451fd});
+        REQUIRE(philox4x32(philox4x32_type{0x243f6a88, 0x85a308d3,
+                                           0x13198a2e, 0x03707344},
+                           philox4x32_key_type{0xa4093822, 0x299f31d0}) ==
+                philox4x32_type{0xd16cfe09, 0x94fdcceb, 0x5001e420,
+                                0x24126ea1});
+    }
+
+    SECTION("64-bit counter and seed") {
+        const philox4x32_type counter{0x9abcdef0, 0x12345678, 0, 0};
+        const philox4x32_key_type key{0x76543210, 0xfedcba98};
+        REQUIRE(philox4x32(0x123456789abcdef0ull, 0xfedcba9876543210ull) ==
+                philox4x32(counter, key));
+    }
+}
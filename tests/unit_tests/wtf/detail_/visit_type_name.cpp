@@ -0,0 +1,45 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../../test_wtf.hpp"
+#include <wtf/detail_/visit_type_name.hpp>
+
+using namespace wtf::detail_;
+
+TEMPLATE_LIST_TEST_CASE("visit_type_name", "[wtf]", test_wtf::all_fp_types) {
+    using tuple_type = test_wtf::all_fp_types;
+    auto name        = wtf::type_traits::type_name_v<TestType>;
+
+    SECTION("Finds the type") {
+        auto lambda = [](auto type_id) {
+            using type = typename decltype(type_id)::type;
+            return std::is_same_v<type, TestType>;
+        };
+        REQUIRE(visit_type_name<tuple_type>(name, lambda));
+    }
+
+    SECTION("Returns void") {
+        bool called = false;
+        visit_type_name<tuple_type>(name, [&](auto) { called = true; });
+        REQUIRE(called);
+    }
+
+    SECTION("Throws if the type is not in the tuple") {
+        auto lambda = [](auto) { return 0; };
+        REQUIRE_THROWS_AS(visit_type_name<tuple_type>("not a type", lambda),
+                          std::runtime_error);
+    }
+}
@@ -0,0 +1,50 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../../../test_wtf.hpp"
+#include <functional>
+#include <wtf/expr/detail_/bound_expression.hpp>
+
+using namespace wtf::expr::detail_;
+
+TEMPLATE_LIST_TEST_CASE("bound_expression", "[expr]",
+                        test_wtf::default_fp_types) {
+    const TestType data[] = {1.0, 2.0, 3.0};
+    BoundBuffer<TestType> buffer{data};
+    BoundScalar<TestType> scalar{TestType{2.0}};
+
+    SECTION("BoundBuffer") {
+        REQUIRE(buffer[0] == TestType{1.0});
+        REQUIRE(buffer[2] == TestType{3.0});
+    }
+
+    SECTION("BoundScalar") {
+        REQUIRE(scalar[0] == TestType{2.0});
+        REQUIRE(scalar[99] == TestType{2.0});
+    }
+
+    SECTION("BoundBinary") {
+        using product_type = BoundBinary<std::multiplies<>, decltype(scalar),
+                                         decltype(buffer)>;
+        product_type product{scalar, buffer};
+        REQUIRE(product[1] == TestType{4.0});
+    }
+
+    SECTION("BoundUnary") {
+        BoundUnary<std::negate<>, decltype(buffer)> negated{buffer};
+        REQUIRE(negated[2] == TestType{-3.0});
+    }
+}
@@ -0,0 +1,136 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "../../../../test_wtf.hpp"
+#include <wtf/expr/detail_/graph_plan.hpp>
+
+using namespace wtf::expr::detail_;
+
+namespace {
+
+/// Makes a vector of output indices
+std::vector<std::size_t> outs(std::initializer_list<std::size_t> il) {
+    return std::vector<std::size_t>(il);
+}
+
+} // namespace
+
+TEST_CASE("make_plan") {
+    using enum OpCode;
+    // 0: x, 1: z, 2: 2.0, 3: 2.0 * x, 4: 2.0 * x + z, 5: -(2.0 * x + z)
+    std::vector<GraphNode> nodes{{input, 0},       {input, 1},  {scalar, 0},
+                                 {multiply, 2, 0}, {add, 3, 1}, {negate, 4}};
+
+    SECTION("Chains are fused into one kernel") {
+        auto plan = make_plan(nodes, outs({5}));
+        REQUIRE(plan.kernels.size() == 1);
+        const auto& kernel = plan.kernels[0];
+        REQUIRE(kernel.instructions.size() == 3);
+        REQUIRE(kernel.instructions[0].lhs.kind == Argument::Kind::scalar);
+        REQUIRE(kernel.instructions[0].rhs.kind == Argument::Kind::input);
+        // Each instruction's result reuses its operand's temporary
+        REQUIRE(kernel.n_temps == 1);
+        REQUIRE(plan.max_temps == 1);
+        REQUIRE(plan.levels == std::vector<std::vector<std::size_t>>{{0}});
+        REQUIRE(plan.n_slots == 1);
+        REQUIRE(plan.output_slots == outs({0}));
+    }
+
+    SECTION("Shared nodes are kernels") {
+        nodes.push_back({multiply, 5, 5});
+        auto plan = make_plan(nodes, outs({6}));
+        REQUIRE(plan.kernels.size() == 2);
+        REQUIRE(plan.kernels[1].instructions.size() == 1);
+        REQUIRE(plan.kernels[1].instructions[0].lhs.kind ==
+                Argument::Kind::slot);
+        REQUIRE(plan.levels == std::vector<std::vector<std::size_t>>{{0}, {1}});
+        REQUIRE(plan.n_slots == 2);
+        REQUIRE(plan.output_slots == outs({1}));
+    }
+
+    SECTION("Independent outputs share a level") {
+        nodes.push_back({subtract, 1, 0});
+        auto plan = make_plan(nodes, outs({5, 6}));
+        REQUIRE(plan.kernels.size() == 2);
+        REQUIRE(plan.levels == std::vector<std::vector<std::size_t>>{{0, 1}});
+        REQUIRE(plan.output_slots == outs({0, 1}));
+    }
+
+    SECTION("Unneeded nodes are skipped") {
+        auto plan = make_plan(nodes, outs({3}));
+        REQUIRE(plan.kernels.size() == 1);
+        REQUIRE(plan.kernels[0].instructions.size() == 1);
+    }
+
+    SECTION("Leaves can be requested") {
+        auto plan = make_plan(nodes, outs({0}));
+        REQUIRE(plan.kernels.size() == 1);
+        REQUIRE(plan.kernels[0].instructions[0].op == input);
+        REQUIRE(plan.kernels[0].n_temps == 0);
+    }
+
+    SECTION("Slots of dead intermediates are reused") {
+        // 6: 5 * 5, 7: 6 * 6, 8: 7 * 7
+        nodes.push_back({multiply, 5, 5});
+        nodes.push_back({multiply, 6, 6});
+        nodes.push_back({multiply, 7, 7});
+        auto plan = make_plan(nodes, outs({8}));
+        REQUIRE(plan.kernels.size() == 4);
+        REQUIRE(plan.levels.size() == 4);
+        // Node 7 reuses node 5's slot, node 8 is an output so gets its own
+        REQUIRE(plan.kernels[2].slot == plan.kernels[0].slot);
+        REQUIRE(plan.n_slots == 3);
+    }
+
+    SECTION("Throws if an output does not exist") {
+        REQUIRE_THROWS_AS(make_plan(nodes, outs({6})), std::out_of_range);
+    }
+}
+
+TEST_CASE("run_plan") {
+    using enum OpCode;
+    std::vector<GraphNode> nodes{{input, 0},       {input, 1},  {scalar, 0},
+                                 {multiply, 2, 0}, {add, 3, 1}, {negate, 4},
+                                 {multiply, 5, 5}, {divide, 1, 2}};
+    auto plan = make_plan(nodes, outs({6, 7, 2}));
+
+    const std::size_t n = 1000;
+    std::vector<double> x(n), z(n);
+    for(std::size_t i = 0; i < n; ++i) {
+        x[i] = static_cast<double>(i);
+        z[i] = 1.0;
+    }
+    std::vector<const double*> inputs{x.data(), z.data()};
+    std::vector<double> scalars{2.0};
+    std::vector<std::vector<double>> slots(plan.n_slots,
+                                           std::vector<double>(n));
+    std::vector<double*> pslots;
+    for(auto& slot : slots) pslots.push_back(slot.data());
+
+    for(std::size_t n_threads : {1, 3}) {
+        run_plan<double>(plan, inputs, scalars, pslots, n, n_threads);
+        const auto& w = slots[plan.output_slots[0]];
+        const auto& v = slots[plan.output_slots[1]];
+        const auto& s = slots[plan.output_slots[2]];
+        for(std::size_t i = 0; i < n; ++i) {
+            const double corr = 2.0 * x[i] + 1.0;
+            REQUIRE(w[i] == corr * corr);
+            REQUIRE(v[i] == 0.5);
+            REQUIRE(s[i] == 2.0);
+        }
+    }
+}
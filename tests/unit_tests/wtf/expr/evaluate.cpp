@@ -0,0 +1,81 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../../test_wtf.hpp"
+#include <wtf/expr/evaluate.hpp>
+
+using namespace wtf::expr;
+using wtf::buffer::BufferView;
+using wtf::buffer::FloatBuffer;
+using wtf::fp::Float;
+
+TEMPLATE_LIST_TEST_CASE("evaluate", "[expr]", test_wtf::default_fp_types) {
+    using tuple_type  = test_wtf::default_fp_types;
+    using vector_type = std::vector<TestType>;
+
+    const std::size_t n = 1000;
+    vector_type xs(n), zs(n), corr(n);
+    for(std::size_t i = 0; i < n; ++i) {
+        xs[i]   = static_cast<TestType>(i);
+        zs[i]   = static_cast<TestType>(n - i);
+        corr[i] = TestType{2} * xs[i] + TestType{0.5} * zs[i];
+    }
+    FloatBuffer x(xs), z(zs), y{vector_type(n)};
+    Float a(TestType{2.0});
+
+    SECTION("FloatBuffer output") {
+        auto* py = y.value<TestType>().data();
+        evaluate<tuple_type>(y, a * lazy(x) + 0.5 * lazy(z));
+        REQUIRE(y == FloatBuffer(corr));
+        // Evaluated in place, i.e., no temporary was swapped in
+        REQUIRE(y.value<TestType>().data() == py);
+    }
+
+    SECTION("BufferView output") {
+        vector_type ys(n);
+        BufferView<Float> view(ys.data(), n);
+        evaluate<tuple_type>(view, a * lazy(x) + 0.5 * lazy(z));
+        REQUIRE(ys == corr);
+    }
+
+    SECTION("Output may alias an input") {
+        evaluate<tuple_type>(x, a * lazy(x) + 0.5 * lazy(z));
+        REQUIRE(x == FloatBuffer(corr));
+    }
+
+    SECTION("Parallel") {
+        evaluate<tuple_type>(y, a * lazy(x) + 0.5 * lazy(z), 4);
+        REQUIRE(y == FloatBuffer(corr));
+
+        FloatBuffer small(vector_type{1.0});
+        evaluate<tuple_type>(small, lazy(small) + 1, 8);
+        REQUIRE(small == FloatBuffer(vector_type{2.0}));
+    }
+
+    SECTION("Throws if buffers hold different types") {
+        using other_t = std::conditional_t<std::is_same_v<TestType, float>,
+                                           double, float>;
+        FloatBuffer other{std::vector<other_t>(n)};
+        REQUIRE_THROWS_AS(evaluate<tuple_type>(y, lazy(x) + other),
+                          std::runtime_error);
+    }
+
+    SECTION("Throws if sizes differ") {
+        FloatBuffer shorter{vector_type(n - 1)};
+        REQUIRE_THROWS_AS(evaluate<tuple_type>(y, lazy(x) + shorter),
+                          std::invalid_argument);
+    }
+}
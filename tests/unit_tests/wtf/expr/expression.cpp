@@ -0,0 +1,113 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../../test_wtf.hpp"
+#include <wtf/expr/expression.hpp>
+
+using namespace wtf::expr;
+using wtf::buffer::FloatBuffer;
+using wtf::fp::Float;
+
+namespace {
+
+template<typename T>
+concept can_lazy = requires(T&& value) { lazy(std::forward<T>(value)); };
+
+template<typename L, typename R>
+concept can_add = requires(L&& lhs, R&& rhs) {
+    std::forward<L>(lhs) + std::forward<R>(rhs);
+};
+
+} // namespace
+
+TEMPLATE_LIST_TEST_CASE("expression", "[expr]", test_wtf::default_fp_types) {
+    using tuple_type  = test_wtf::default_fp_types;
+    using vector_type = std::vector<TestType>;
+
+    FloatBuffer x(vector_type{1.0, 2.0, 3.0});
+    Float a(TestType{2.0});
+
+    SECTION("lazy") {
+        auto bx = lazy(x).template bind<TestType, tuple_type>(3);
+        REQUIRE(bx[1] == TestType{2.0});
+
+        auto view = wtf::buffer::BufferView<const Float>(x);
+        auto bv   = lazy(view).template bind<TestType, tuple_type>(3);
+        REQUIRE(bv.m_data == bx.m_data);
+
+        auto ba = lazy(a).template bind<TestType, tuple_type>(3);
+        REQUIRE(ba[0] == TestType{2.0});
+
+        SECTION("Throws if size is wrong") {
+            auto bind = [&]() {
+                return lazy(x).template bind<TestType, tuple_type>(2);
+            };
+            REQUIRE_THROWS_AS(bind(), std::invalid_argument);
+        }
+
+        SECTION("Throws if type is wrong") {
+            constexpr bool is_float = std::is_same_v<TestType, float>;
+            using other_t = std::conditional_t<is_float, double, float>;
+            auto bind     = [&]() {
+                return lazy(x).template bind<other_t, tuple_type>(3);
+            };
+            REQUIRE_THROWS_AS(bind(), std::runtime_error);
+        }
+    }
+
+    SECTION("Scalars are converted") {
+        Float f(1.5f);
+        auto bf = lazy(f).template bind<TestType, tuple_type>(3);
+        REQUIRE(bf[0] == TestType{1.5});
+
+        auto bc = ConstantTerminal<int>(3).template bind<TestType, tuple_type>(
+          3);
+        REQUIRE(bc[0] == TestType{3.0});
+    }
+
+    SECTION("Operators") {
+        auto expr  = -(a * lazy(x) + 1) / x - lazy(x);
+        auto bound = expr.template bind<TestType, tuple_type>(3);
+        // -(2 * 2 + 1) / 2 - 2
+        REQUIRE(bound[1] == TestType{-4.5});
+
+        STATIC_REQUIRE(Expression<decltype(expr)>);
+        STATIC_REQUIRE_FALSE(Expression<FloatBuffer>);
+        STATIC_REQUIRE(Operand<FloatBuffer>);
+        STATIC_REQUIRE(Operand<double>);
+        STATIC_REQUIRE_FALSE(Operand<std::string>);
+    }
+
+    SECTION("Temporaries are rejected") {
+        using view_type = wtf::buffer::BufferView<Float>;
+        using lazy_type = decltype(lazy(x));
+
+        STATIC_REQUIRE(can_lazy<FloatBuffer&>);
+        STATIC_REQUIRE(can_lazy<const FloatBuffer&>);
+        STATIC_REQUIRE_FALSE(can_lazy<FloatBuffer>);
+        STATIC_REQUIRE(can_lazy<view_type&>);
+        STATIC_REQUIRE_FALSE(can_lazy<view_type>);
+        STATIC_REQUIRE(can_lazy<Float&>);
+        STATIC_REQUIRE_FALSE(can_lazy<Float>);
+
+        STATIC_REQUIRE(can_add<lazy_type, FloatBuffer&>);
+        STATIC_REQUIRE(can_add<lazy_type, lazy_type>);
+        STATIC_REQUIRE(can_add<double, lazy_type>);
+        STATIC_REQUIRE_FALSE(can_add<lazy_type, FloatBuffer>);
+        STATIC_REQUIRE_FALSE(can_add<view_type, lazy_type>);
+        STATIC_REQUIRE_FALSE(can_add<lazy_type, Float>);
+    }
+}
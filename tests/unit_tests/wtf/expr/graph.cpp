@@ -0,0 +1,133 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "../../../test_wtf.hpp"
+#include <wtf/expr/graph.hpp>
+
+using namespace wtf::expr;
+using wtf::buffer::FloatBuffer;
+using wtf::fp::Float;
+
+namespace {
+
+template<typename T>
+concept can_input = requires(Graph& g, T&& buffer) {
+    g.input(std::forward<T>(buffer));
+};
+
+} // namespace
+
+TEMPLATE_LIST_TEST_CASE("Graph", "[expr]", test_wtf::default_fp_types) {
+    using tuple_type  = test_wtf::default_fp_types;
+    using vector_type = std::vector<TestType>;
+
+    const std::size_t n = 1000;
+    vector_type xs(n), zs(n), corr(n);
+    for(std::size_t i = 0; i < n; ++i) {
+        xs[i]   = static_cast<TestType>(i);
+        zs[i]   = static_cast<TestType>(n - i);
+        corr[i] = TestType{2} * xs[i] + TestType{0.5} * zs[i];
+    }
+    FloatBuffer bx(xs), bz(zs);
+    Float a(TestType{2.0});
+
+    Graph g;
+    auto x = g.input(bx);
+    auto z = g.input(bz);
+
+    SECTION("Operations are recorded, not run") {
+        auto y = a * x + 0.5 * z;
+        // x, z, a, a * x, 0.5, 0.5 * z, and the sum
+        REQUIRE(g.size() == 7);
+        REQUIRE(&y.graph() == &g);
+        REQUIRE(y.node() == 6);
+        REQUIRE(y.template evaluate<tuple_type>() == FloatBuffer(corr));
+    }
+
+    SECTION("Several outputs") {
+        auto y = a * x + 0.5 * z;
+        auto u = y * y;
+        auto v = -(y - 1) / 2;
+        auto rv = g.evaluate<tuple_type>({u, y, v}, 4);
+        REQUIRE(rv.size() == 3);
+        REQUIRE(rv[1] == FloatBuffer(corr));
+        auto pu = rv[0].template value<TestType>();
+        auto pv = rv[2].template value<TestType>();
+        for(std::size_t i = 0; i < n; ++i) {
+            REQUIRE(pu[i] == corr[i] * corr[i]);
+            REQUIRE(pv[i] == -(corr[i] - TestType{1}) / TestType{2});
+        }
+    }
+
+    SECTION("Inputs and repeated outputs") {
+        auto rv = g.evaluate<tuple_type>({x, x});
+        REQUIRE(rv[0] == bx);
+        REQUIRE(rv[1] == bx);
+        // Results are copies, not aliases of the inputs
+        REQUIRE(rv[0].template value<TestType>().data() != xs.data());
+    }
+
+    SECTION("Empty inputs") {
+        FloatBuffer empty{vector_type{}};
+        Graph g2;
+        auto e = g2.input(empty);
+        REQUIRE((e + 1).template evaluate<tuple_type>().size() == 0);
+    }
+
+    SECTION("Throws if inputs hold different types") {
+        using other_t = std::conditional_t<std::is_same_v<TestType, float>,
+                                           double, float>;
+        FloatBuffer other{std::vector<other_t>(n)};
+        auto y = x + g.input(other);
+        REQUIRE_THROWS_AS(y.template evaluate<tuple_type>(),
+                          std::runtime_error);
+    }
+
+    SECTION("Throws if sizes differ") {
+        FloatBuffer shorter{vector_type(n - 1)};
+        auto y = x + g.input(shorter);
+        REQUIRE_THROWS_AS(y.template evaluate<tuple_type>(),
+                          std::invalid_argument);
+    }
+
+    SECTION("Throws if nodes are from different graphs") {
+        Graph g2;
+        auto x2 = g2.input(bx);
+        REQUIRE_THROWS_AS(x + x2, std::invalid_argument);
+        REQUIRE_THROWS_AS(g.evaluate<tuple_type>({x2}),
+                          std::invalid_argument);
+    }
+
+    SECTION("Throws if there are no inputs") {
+        Graph g2;
+        auto s = g2.scalar(a);
+        REQUIRE_THROWS_AS(s.template evaluate<tuple_type>(),
+                          std::invalid_argument);
+    }
+
+    SECTION("Throws if apply is given a leaf op") {
+        REQUIRE_THROWS_AS(g.apply(detail_::OpCode::input, x, x),
+                          std::invalid_argument);
+    }
+
+    SECTION("Temporaries are rejected as inputs") {
+        STATIC_REQUIRE(can_input<FloatBuffer&>);
+        STATIC_REQUIRE(can_input<const FloatBuffer&>);
+        STATIC_REQUIRE_FALSE(can_input<FloatBuffer>);
+        STATIC_REQUIRE_FALSE(can_input<const FloatBuffer>);
+    }
+}
@@ -0,0 +1,80 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../../test_wtf.hpp"
+#include <cmath>
+#include <sstream>
+#include <wtf/buffer/float_buffer.hpp>
+#include <wtf/fp/float.hpp>
+#include <wtf/fp/bfloat16.hpp>
+
+using wtf::fp::BFloat16;
+
+TEST_CASE("BFloat16") {
+    BFloat16 one(1.0f);
+
+    SECTION("Ctors") {
+        REQUIRE(BFloat16{}.bits() == 0);
+        REQUIRE(one.bits() == 0x3F80);
+        REQUIRE(BFloat16(1.0).bits() == 0x3F80);
+        REQUIRE(BFloat16::from_bits(0x3F80).bits() == 0x3F80);
+
+        // Double is rounded once, not once to float and then again
+        const auto above_tie = 1.0 + std::ldexp(1.0, -8) +
+                               std::ldexp(1.0, -40);
+        REQUIRE(BFloat16(above_tie).bits() == 0x3F81);
+        REQUIRE(BFloat16(static_cast<float>(above_tie)).bits() == 0x3F80);
+    }
+
+    SECTION("Conversions") {
+        float f = one;
+        REQUIRE(f == 1.0f);
+        REQUIRE(static_cast<double>(one) == 1.0);
+        REQUIRE(one + one == 2.0f);
+        REQUIRE(one == BFloat16(1.0f));
+        REQUIRE(one != BFloat16(2.0f));
+        REQUIRE(one < BFloat16(2.0f));
+        REQUIRE(BFloat16(0.0f) == BFloat16(-0.0f));
+    }
+
+    SECTION("Printing") {
+        std::stringstream ss;
+        ss << BFloat16(1.5f);
+        REQUIRE(ss.str() == "1.5");
+    }
+
+    SECTION("Type traits") {
+        using namespace wtf::type_traits;
+        STATIC_REQUIRE(is_floating_point_v<BFloat16>);
+        REQUIRE(type_name_v<BFloat16> == std::string("bfloat16"));
+        STATIC_REQUIRE(precision_v<BFloat16> == 2);
+        STATIC_REQUIRE(is_convertible_v<BFloat16, float>);
+        STATIC_REQUIRE(is_convertible_v<BFloat16, double>);
+        STATIC_REQUIRE(is_convertible_v<BFloat16, long double>);
+        STATIC_REQUIRE_FALSE(is_convertible_v<float, BFloat16>);
+        STATIC_REQUIRE_FALSE(is_convertible_v<double, BFloat16>);
+    }
+
+    SECTION("Works with Float and FloatBuffer") {
+        wtf::fp::Float value(one);
+        REQUIRE(value.to_string() == "1");
+        REQUIRE(value == wtf::fp::Float(BFloat16(1.0f)));
+
+        wtf::buffer::FloatBuffer buffer(std::vector<BFloat16>{one, one});
+        REQUIRE(buffer.size() == 2);
+        REQUIRE(buffer.value<BFloat16>()[1] == one);
+    }
+}
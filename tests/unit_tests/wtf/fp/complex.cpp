@@ -0,0 +1,56 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../../test_wtf.hpp"
+#include <wtf/buffer/float_buffer.hpp>
+#include <wtf/fp/complex.hpp>
+#include <wtf/fp/float.hpp>
+
+using namespace wtf::type_traits;
+
+TEMPLATE_LIST_TEST_CASE("complex", "[wtf]", test_wtf::default_fp_types) {
+    using complex_type = std::complex<TestType>;
+
+    SECTION("Type traits") {
+        STATIC_REQUIRE(is_floating_point_v<complex_type>);
+        const auto corr = "std::complex<" +
+                          std::string(type_name_v<TestType>) + ">";
+        REQUIRE(type_name_v<complex_type> == corr);
+        STATIC_REQUIRE(precision_v<complex_type> == precision_v<TestType>);
+        STATIC_REQUIRE(word_size_v<complex_type> == sizeof(TestType));
+        STATIC_REQUIRE(is_convertible_v<TestType, complex_type>);
+        STATIC_REQUIRE_FALSE(is_convertible_v<complex_type, TestType>);
+        STATIC_REQUIRE(is_convertible_v<std::complex<float>, complex_type>);
+    }
+
+    SECTION("Float") {
+        wtf::fp::Float value(complex_type{1.0, 2.0});
+        REQUIRE(value == wtf::fp::Float(complex_type{1.0, 2.0}));
+        REQUIRE(value != wtf::fp::Float(complex_type{1.0, -2.0}));
+        REQUIRE(value.to_string() == "(1,2)");
+    }
+
+    SECTION("FloatBuffer storage is interleaved") {
+        std::vector<complex_type> values{{1.0, 2.0}, {3.0, 4.0}};
+        wtf::buffer::FloatBuffer buffer(std::move(values));
+        auto data = buffer.value<complex_type>();
+        auto* p   = reinterpret_cast<const TestType*>(data.data());
+        REQUIRE(p[0] == TestType{1.0});
+        REQUIRE(p[1] == TestType{2.0});
+        REQUIRE(p[2] == TestType{3.0});
+        REQUIRE(p[3] == TestType{4.0});
+    }
+}
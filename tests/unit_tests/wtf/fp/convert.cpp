@@ -0,0 +1,224 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../../test_wtf.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <wtf/fp/convert.hpp>
+
+using namespace wtf::fp;
+
+TEMPLATE_LIST_TEST_CASE("convert", "[wtf]", wtf::narrow_fp_types) {
+    using narrow_type = TestType;
+
+    std::vector<float> floats(1000);
+    std::vector<double> doubles(floats.size());
+    for(std::size_t i = 0; i < floats.size(); ++i) {
+        floats[i]  = std::ldexp(static_cast<float>(i) - 500.0f, -3);
+        doubles[i] = floats[i];
+    }
+
+    SECTION("float") {
+        std::vector<narrow_type> narrow(floats.size());
+        convert(floats, narrow);
+        for(std::size_t i = 0; i < floats.size(); ++i)
+            REQUIRE(narrow[i].bits() == narrow_type(floats[i]).bits());
+
+        std::vector<float> wide(floats.size());
+        convert(narrow, wide);
+        for(std::size_t i = 0; i < floats.size(); ++i)
+            REQUIRE(wide[i] == static_cast<float>(narrow[i]));
+    }
+
+    SECTION("double") {
+        std::vector<narrow_type> narrow(doubles.size());
+        convert(doubles, narrow);
+        for(std::size_t i = 0; i < doubles.size(); ++i)
+            REQUIRE(narrow[i].bits() == narrow_type(doubles[i]).bits());
+
+        std::vector<double> wide(doubles.size());
+        convert(narrow, wide);
+        for(std::size_t i = 0; i < doubles.size(); ++i)
+            REQUIRE(wide[i] == static_cast<double>(narrow[i]));
+    }
+
+    SECTION("In parallel") {
+        test_wtf::ForceCopyEngine force;
+        std::vector<narrow_type> narrow(doubles.size());
+        convert(doubles, narrow);
+        for(std::size_t i = 0; i < doubles.size(); ++i)
+            REQUIRE(narrow[i].bits() == narrow_type(doubles[i]).bits());
+    }
+
+    SECTION("convert_async") {
+        std::vector<narrow_type> narrow(doubles.size());
+        std::span<const double> in(doubles);
+        auto done = convert_async(in, std::span<narrow_type>(narrow));
+        done.get();
+        for(std::size_t i = 0; i < doubles.size(); ++i)
+            REQUIRE(narrow[i].bits() == narrow_type(doubles[i]).bits());
+
+        std::vector<float> wide(4);
+        std::span<const narrow_type> short_in(narrow.data(), 3);
+        auto error = convert_async(short_in, std::span<float>(wide));
+        REQUIRE_THROWS_AS(error.get(), std::invalid_argument);
+    }
+
+    SECTION("Empty") {
+        std::vector<narrow_type> narrow;
+        std::vector<float> wide;
+        convert(narrow, wide);
+        REQUIRE(wide.empty());
+    }
+
+    SECTION("Throws if sizes differ") {
+        std::vector<narrow_type> narrow(3);
+        std::vector<float> wide(4);
+        REQUIRE_THROWS_AS(convert(narrow, wide), std::invalid_argument);
+        REQUIRE_THROWS_AS(convert(wide, narrow), std::invalid_argument);
+    }
+}
+
+TEMPLATE_LIST_TEST_CASE("convert with ConvertOptions", "[wtf]",
+                        wtf::narrow_fp_types) {
+    using narrow_type  = TestType;
+    constexpr auto inf = std::numeric_limits<double>::infinity();
+
+    // Values which are not representable in any of the narrow types
+    std::vector<double> doubles(1000);
+    for(std::size_t i = 0; i < doubles.size(); ++i)
+        doubles[i] = std::sin(static_cast<double>(i)) * (1.0 + i);
+    std::vector<float> floats(doubles.begin(), doubles.end());
+
+    /// Converts @p in to narrow_type with @p options
+    auto to_narrow = [](const auto& in, const ConvertOptions& options) {
+        std::vector<narrow_type> rv(in.size());
+        convert(std::span(in), std::span(rv), options);
+        return rv;
+    };
+    auto bits = [](const std::vector<narrow_type>& values) {
+        std::vector<std::uint16_t> rv;
+        for(auto x : values) rv.push_back(x.bits());
+        return rv;
+    };
+
+    SECTION("Default options round to nearest") {
+        std::vector<narrow_type> corr(doubles.size());
+        convert(doubles, corr);
+        REQUIRE(bits(to_narrow(doubles, {})) == bits(corr));
+        convert(floats, corr);
+        REQUIRE(bits(to_narrow(floats, {})) == bits(corr));
+    }
+
+    SECTION("Stochastic rounding") {
+        ConvertOptions options{.stochastic = true, .seed = 42};
+        auto rounded = to_narrow(doubles, options);
+
+        // Each value goes to one of its two neighbours
+        for(std::size_t i = 0; i < doubles.size(); ++i) {
+            const auto x       = doubles[i];
+            const auto nearest = narrow_type(x);
+            const auto y       = static_cast<double>(rounded[i]);
+            const auto near    = static_cast<double>(nearest);
+            const int step     = rounded[i].bits() - nearest.bits();
+            REQUIRE(std::abs(step) <= 1);
+            REQUIRE((y == near || (y - x) * (near - x) < 0.0));
+        }
+
+        // Same seed, same result; another seed, another result
+        REQUIRE(bits(to_narrow(doubles, options)) == bits(rounded));
+        ConvertOptions other_seed{.stochastic = true, .seed = 43};
+        REQUIRE(bits(to_narrow(doubles, other_seed)) != bits(rounded));
+
+        // Independent of how the conversion is split
+        {
+            test_wtf::ForceCopyEngine force;
+            REQUIRE(bits(to_narrow(doubles, options)) == bits(rounded));
+        }
+        std::vector<double> tail(doubles.begin() + 300, doubles.end());
+        options.offset = 300;
+        auto tail_bits = bits(to_narrow(tail, options));
+        auto all_bits  = bits(rounded);
+        REQUIRE(std::equal(tail_bits.begin(), tail_bits.end(),
+                           all_bits.begin() + 300));
+
+        // From float too
+        ConvertOptions from_float{.stochastic = true};
+        auto float_rounded = to_narrow(floats, from_float);
+        REQUIRE(bits(to_narrow(floats, from_float)) == bits(float_rounded));
+    }
+
+    SECTION("Stochastic rounding is unbiased") {
+        // Rounding one value many times averages out to the value
+        const double x = 1.0 + 1.0 / 3.0 * std::ldexp(1.0, -7);
+        std::vector<double> in(100000, x);
+        auto rounded = to_narrow(in, {.stochastic = true, .seed = 7});
+        double sum   = 0.0;
+        for(auto y : rounded) sum += static_cast<double>(y);
+        const auto ulp = std::ldexp(1.0, -7);
+        REQUIRE(std::fabs(sum / in.size() - x) < 0.01 * ulp);
+    }
+
+    SECTION("Saturation") {
+        std::vector<double> in{1e300, -1e300, inf, -inf, 1.0};
+        const auto max = static_cast<double>(
+          narrow_type::from_bits(std::is_same_v<narrow_type, Half> ? 0x7BFF :
+                                                                     0x7F7F));
+        std::vector<double> corr{max, -max, max, -max, 1.0};
+        for(bool stochastic : {false, true}) {
+            auto rounded = to_narrow(in, {.stochastic = stochastic,
+                                          .saturate   = true});
+            for(std::size_t i = 0; i < in.size(); ++i)
+                REQUIRE(static_cast<double>(rounded[i]) == corr[i]);
+        }
+
+        std::vector<float> nan{std::numeric_limits<float>::quiet_NaN()};
+        const auto saturated_nan = to_narrow(nan, {.saturate = true})[0];
+        REQUIRE(std::isnan(static_cast<double>(saturated_nan)));
+
+        // Without saturation overflow gives infinity
+        REQUIRE(static_cast<double>(to_narrow(in, {})[0]) == inf);
+    }
+
+    SECTION("Throws if sizes differ") {
+        std::vector<narrow_type> narrow(3);
+        REQUIRE_THROWS_AS(convert(std::span<const double>(doubles),
+                                  std::span(narrow), ConvertOptions{}),
+                          std::invalid_argument);
+    }
+}
+
+TEST_CASE("convert double to float with ConvertOptions") {
+    constexpr auto inf  = std::numeric_limits<float>::infinity();
+    constexpr auto fmax = std::numeric_limits<float>::max();
+
+    std::vector<double> in{1.0 / 3.0, -1e300, inf, 1e-50, 2.0};
+    std::vector<float> out(in.size());
+
+    convert(std::span<const double>(in), std::span(out), ConvertOptions{});
+    REQUIRE(out == std::vector<float>{1.0f / 3.0f, -inf, inf, 0.0f, 2.0f});
+
+    convert(std::span<const double>(in), std::span(out),
+            ConvertOptions{.stochastic = true, .saturate = true, .seed = 1});
+    const auto third = static_cast<float>(1.0 / 3.0);
+    REQUIRE((out[0] == third || out[0] == std::nextafter(third, 0.0f)));
+    REQUIRE(out[1] == -fmax);
+    REQUIRE(out[2] == fmax);
+    REQUIRE(out[3] == 0.0f);
+    REQUIRE(out[4] == 2.0f);
+}
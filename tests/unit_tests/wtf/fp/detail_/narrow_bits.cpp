@@ -0,0 +1,112 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../../../test_wtf.hpp"
+#include <cmath>
+#include <limits>
+#include <wtf/fp/detail_/narrow_bits.hpp>
+
+using namespace wtf::fp::detail_;
+
+TEST_CASE("narrow_bits") {
+    constexpr auto inf = std::numeric_limits<float>::infinity();
+    constexpr auto nan = std::numeric_limits<float>::quiet_NaN();
+
+    SECTION("round_to_odd") {
+        REQUIRE(round_to_odd(1.0) == 1.0f);
+        REQUIRE(round_to_odd(-0.5) == -0.5f);
+        // Inexact results are truncated and then made odd
+        const auto above = round_to_odd(1.0 + std::ldexp(1.0, -40));
+        REQUIRE(above == std::nextafter(1.0f, 2.0f));
+        const auto below = round_to_odd(1.0 - std::ldexp(1.0, -40));
+        REQUIRE(below == std::nextafter(1.0f, 0.0f));
+        REQUIRE(round_to_odd(1e300) == std::numeric_limits<float>::max());
+        REQUIRE(round_to_odd(double(inf)) == inf);
+        REQUIRE(std::isnan(round_to_odd(double(nan))));
+    }
+
+    SECTION("float_to_half_bits") {
+        REQUIRE(float_to_half_bits(0.0f) == 0x0000);
+        REQUIRE(float_to_half_bits(-0.0f) == 0x8000);
+        REQUIRE(float_to_half_bits(1.0f) == 0x3C00);
+        REQUIRE(float_to_half_bits(-2.0f) == 0xC000);
+        REQUIRE(float_to_half_bits(65504.0f) == 0x7BFF);
+        REQUIRE(float_to_half_bits(65519.0f) == 0x7BFF);
+        REQUIRE(float_to_half_bits(65520.0f) == 0x7C00);
+        REQUIRE(float_to_half_bits(inf) == 0x7C00);
+        REQUIRE(float_to_half_bits(-inf) == 0xFC00);
+        REQUIRE(float_to_half_bits(nan) == 0x7E00);
+
+        // Ties go to even
+        REQUIRE(float_to_half_bits(1.0f + std::ldexp(1.0f, -11)) == 0x3C00);
+        REQUIRE(float_to_half_bits(1.0f + std::ldexp(3.0f, -11)) == 0x3C02);
+
+        // Subnormals
+        REQUIRE(float_to_half_bits(std::ldexp(1.0f, -14)) == 0x0400);
+        REQUIRE(float_to_half_bits(std::ldexp(1.0f, -24)) == 0x0001);
+        REQUIRE(float_to_half_bits(std::ldexp(1.0f, -25)) == 0x0000);
+        REQUIRE(float_to_half_bits(std::ldexp(3.0f, -26)) == 0x0001);
+        REQUIRE(float_to_half_bits(std::ldexp(-1.0f, -24)) == 0x8001);
+    }
+
+    SECTION("half_bits_to_float") {
+        REQUIRE(half_bits_to_float(0x3C00) == 1.0f);
+        REQUIRE(half_bits_to_float(0xC000) == -2.0f);
+        REQUIRE(half_bits_to_float(0x7BFF) == 65504.0f);
+        REQUIRE(half_bits_to_float(0x0001) == std::ldexp(1.0f, -24));
+        REQUIRE(half_bits_to_float(0x03FF) == std::ldexp(1023.0f, -24));
+        REQUIRE(half_bits_to_float(0x7C00) == inf);
+        REQUIRE(std::isnan(half_bits_to_float(0x7E00)));
+        REQUIRE(std::signbit(half_bits_to_float(0x8000)));
+
+        // Every non-NaN pattern round trips
+        for(std::uint32_t i = 0; i <= 0xFFFF; ++i) {
+            const auto bits  = static_cast<bits16_type>(i);
+            const auto value = half_bits_to_float(bits);
+            if(std::isnan(value)) continue;
+            REQUIRE(float_to_half_bits(value) == bits);
+        }
+    }
+
+    SECTION("float_to_bfloat16_bits") {
+        REQUIRE(float_to_bfloat16_bits(1.0f) == 0x3F80);
+        REQUIRE(float_to_bfloat16_bits(-2.0f) == 0xC000);
+        REQUIRE(float_to_bfloat16_bits(inf) == 0x7F80);
+        REQUIRE(float_to_bfloat16_bits(nan) == 0x7FC0);
+        const auto max = std::numeric_limits<float>::max();
+        REQUIRE(float_to_bfloat16_bits(max) == 0x7F80);
+
+        // Ties go to even
+        REQUIRE(float_to_bfloat16_bits(1.0f + std::ldexp(1.0f, -8)) == 0x3F80);
+        REQUIRE(float_to_bfloat16_bits(1.0f + std::ldexp(3.0f, -8)) == 0x3F82);
+
+        // Signaling NaNs stay NaNs
+        const auto snan = std::bit_cast<float>(0x7F800001u);
+        REQUIRE(float_to_bfloat16_bits(snan) == 0x7FC0);
+    }
+
+    SECTION("bfloat16_bits_to_float") {
+        REQUIRE(bfloat16_bits_to_float(0x3F80) == 1.0f);
+        REQUIRE(bfloat16_bits_to_float(0xFF80) == -inf);
+
+        for(std::uint32_t i = 0; i <= 0xFFFF; ++i) {
+            const auto bits  = static_cast<bits16_type>(i);
+            const auto value = bfloat16_bits_to_float(bits);
+            if(std::isnan(value)) continue;
+            REQUIRE(float_to_bfloat16_bits(value) == bits);
+        }
+    }
+}
@@ -0,0 +1,95 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../../../test_wtf.hpp"
+#include <cmath>
+#include <limits>
+#include <wtf/fp/detail_/narrow_rounding.hpp>
+
+using namespace wtf::fp::detail_;
+
+TEST_CASE("narrow_rounding") {
+    constexpr auto inf     = std::numeric_limits<double>::infinity();
+    constexpr auto nan     = std::numeric_limits<double>::quiet_NaN();
+    constexpr auto all_set = ~std::uint32_t{0};
+
+    SECTION("stochastic_round") {
+        // Representable values never move
+        for(std::uint32_t r : {0u, 0x80000000u, all_set}) {
+            REQUIRE(stochastic_round<binary32_format>(1.5, r) == 1.5);
+            REQUIRE(stochastic_round<binary16_format>(-0.25, r) == -0.25);
+            REQUIRE(stochastic_round<bfloat16_format>(0.0, r) == 0.0);
+        }
+
+        // 1 + ulp / 4 goes up only for the top quarter of random numbers
+        const auto ulp = std::ldexp(1.0, -10);
+        const auto x   = 1.0 + ulp / 4;
+        REQUIRE(stochastic_round<binary16_format>(x, 0u) == 1.0);
+        REQUIRE(stochastic_round<binary16_format>(x, 0xBFFFFFFFu) == 1.0);
+        REQUIRE(stochastic_round<binary16_format>(x, 0xC0000000u) == 1 + ulp);
+        REQUIRE(stochastic_round<binary16_format>(-x, all_set) == -1 - ulp);
+
+        // Same in the subnormal range, whose ulp is 2^-24 for binary16
+        const auto sub = std::ldexp(1.0, -24);
+        const auto y   = sub * 2.25;
+        REQUIRE(stochastic_round<binary16_format>(y, 0u) == 2 * sub);
+        REQUIRE(stochastic_round<binary16_format>(y, 0xBFFFFFFFu) == 2 * sub);
+        REQUIRE(stochastic_round<binary16_format>(y, 0xC0000000u) == 3 * sub);
+        const auto tiny = std::ldexp(1.0, -40);
+        REQUIRE(stochastic_round<binary16_format>(tiny, 0u) == 0.0);
+        REQUIRE(stochastic_round<binary16_format>(tiny, all_set) == sub);
+
+        // Double's subnormals are far below float's and round to zero
+        const auto denorm = std::numeric_limits<double>::denorm_min();
+        REQUIRE(stochastic_round<binary32_format>(denorm, 0u) == 0.0);
+        REQUIRE(stochastic_round<binary32_format>(-denorm, all_set) == 0.0);
+        const auto float_denorm = std::numeric_limits<float>::denorm_min();
+        const auto half_denorm  = 0.5 * float_denorm;
+        REQUIRE(stochastic_round<binary32_format>(half_denorm, all_set) ==
+                float_denorm);
+
+        REQUIRE(stochastic_round<binary32_format>(inf, all_set) == inf);
+        REQUIRE(stochastic_round<binary32_format>(-inf, all_set) == -inf);
+        REQUIRE(std::isnan(stochastic_round<binary16_format>(nan, all_set)));
+    }
+
+    SECTION("stochastic_round is unbiased") {
+        // Sweeps the random numbers evenly, so the mean is x up to rounding
+        const auto x = 1.0 / 3.0;
+        double sum   = 0.0;
+        const std::uint32_t n = 1u << 16;
+        for(std::uint32_t i = 0; i < n; ++i)
+            sum += stochastic_round<bfloat16_format>(x, i << 16);
+        REQUIRE(std::fabs(sum / n - x) < 1e-6);
+    }
+
+    SECTION("saturate") {
+        REQUIRE(saturate<binary16_format>(1.0) == 1.0);
+        REQUIRE(saturate<binary16_format>(65504.0) == 65504.0);
+        REQUIRE(saturate<binary16_format>(65505.0) == 65504.0);
+        REQUIRE(saturate<binary16_format>(-1e10) == -65504.0);
+        REQUIRE(saturate<binary16_format>(inf) == 65504.0);
+        REQUIRE(saturate<binary16_format>(-inf) == -65504.0);
+
+        constexpr auto float_max = std::numeric_limits<float>::max();
+        REQUIRE(saturate<binary32_format>(float_max) == float_max);
+        const auto above = std::nextafter(double(float_max), inf);
+        REQUIRE(saturate<binary32_format>(above) == float_max);
+        REQUIRE(saturate<binary32_format>(-1e300) == -float_max);
+        REQUIRE(saturate<bfloat16_format>(1e300) == 0x1.fep127);
+        REQUIRE(std::isnan(saturate<binary32_format>(nan)));
+    }
+}
@@ -0,0 +1,74 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../../test_wtf.hpp"
+#include <wtf/buffer/float_buffer.hpp>
+#include <wtf/fp/float.hpp>
+#include <wtf/fp/float128.hpp>
+
+#ifdef WTF_HAS_FLOAT128
+
+using wtf::fp::float128;
+
+TEST_CASE("float128") {
+    using tuple_type = wtf::extended_fp_types;
+
+    SECTION("Type traits") {
+        using namespace wtf::type_traits;
+        STATIC_REQUIRE(is_floating_point_v<float128>);
+        REQUIRE(type_name_v<float128> == std::string("__float128"));
+        STATIC_REQUIRE(precision_v<float128> == 33);
+        STATIC_REQUIRE(precision_v<float128> > precision_v<long double>);
+        STATIC_REQUIRE(is_convertible_v<float128, long double>);
+        STATIC_REQUIRE(is_convertible_v<double, float128>);
+        STATIC_REQUIRE(std::tuple_size_v<tuple_type> == 4);
+    }
+
+    SECTION("Float") {
+        wtf::fp::Float value(float128{1.5});
+        REQUIRE(value == wtf::fp::Float(float128{1.5}));
+        REQUIRE(value != wtf::fp::Float(1.5L));
+        REQUIRE(wtf::fp::float_cast<float128>(value) == float128{1.5});
+    }
+
+    SECTION("FloatBuffer") {
+        // 1 + 2^-100 is not representable as a long double
+        const float128 tiny = float128{1} / (float128{1ull << 50} *
+                                             float128{1ull << 50});
+        wtf::buffer::FloatBuffer buffer(
+          std::vector<float128>{1.0, tiny, -1.0});
+
+        auto sum = [](auto&& span) {
+            using value_type = std::decay_t<decltype(span[0])>;
+            value_type rv{0};
+            for(const auto& x : span) rv += x;
+            return static_cast<float128>(rv);
+        };
+        REQUIRE(wtf::buffer::visit_contiguous_buffer<tuple_type>(
+                  sum, buffer) == tiny);
+
+        auto scale = [](auto&& span) {
+            if constexpr(!std::is_const_v<
+                           std::remove_reference_t<decltype(span[0])>>) {
+                for(auto& x : span) x *= 2;
+            }
+        };
+        wtf::buffer::visit_contiguous_buffer<tuple_type>(scale, buffer);
+        REQUIRE(buffer.value<float128>()[1] == 2 * tiny);
+    }
+}
+
+#endif
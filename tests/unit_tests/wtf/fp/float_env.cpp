@@ -0,0 +1,89 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../../test_wtf.hpp"
+#include <limits>
+#include <wtf/fp/float_env.hpp>
+
+using namespace wtf::fp;
+
+TEST_CASE("FloatEnv") {
+    const auto defaults = FloatEnv::current();
+    REQUIRE(defaults == FloatEnv{});
+
+    SECTION("flush_denormals") {
+        constexpr auto env = FloatEnv::flush_denormals();
+        REQUIRE(env.flush_to_zero);
+        REQUIRE(env.denormals_are_zero);
+        REQUIRE(env.rounding == RoundingMode::to_nearest);
+    }
+
+    SECTION("set_float_env") {
+        const FloatEnv env{.rounding = RoundingMode::toward_zero};
+        set_float_env(env);
+        REQUIRE(FloatEnv::current() == env);
+        set_float_env(defaults);
+        REQUIRE(FloatEnv::current() == defaults);
+    }
+}
+
+TEST_CASE("FloatEnvGuard") {
+    const auto defaults = FloatEnv::current();
+    volatile double one = 1.0, three = 3.0;
+
+    SECTION("Rounding") {
+        double down, up;
+        {
+            FloatEnvGuard guard(FloatEnv{.rounding = RoundingMode::downward});
+            REQUIRE(FloatEnv::current().rounding == RoundingMode::downward);
+            down = one / three;
+            {
+                FloatEnvGuard inner(FloatEnv{.rounding = RoundingMode::upward});
+                up = one / three;
+            }
+            REQUIRE(FloatEnv::current().rounding == RoundingMode::downward);
+        }
+        REQUIRE(down < up);
+        REQUIRE(FloatEnv::current() == defaults);
+    }
+
+    SECTION("Flushing denormals") {
+        if(!supports_flush_to_zero()) return;
+        const auto tiny        = std::numeric_limits<double>::min();
+        volatile double half   = 0.5;
+        volatile double normal = tiny;
+        volatile double denorm = tiny * half;
+        REQUIRE(denorm * 1.0 != 0.0);
+        {
+            FloatEnvGuard guard(FloatEnv::flush_denormals());
+            REQUIRE(FloatEnv::current() == FloatEnv::flush_denormals());
+            REQUIRE(normal * half == 0.0);
+            REQUIRE(denorm + 0.0 == 0.0);
+        }
+        REQUIRE(normal * half == denorm);
+        REQUIRE(FloatEnv::current() == defaults);
+    }
+
+    SECTION("Empty optional does nothing") {
+        {
+            FloatEnvGuard guard(std::optional<FloatEnv>{});
+            REQUIRE(FloatEnv::current() == defaults);
+            set_float_env(FloatEnv{.rounding = RoundingMode::upward});
+        }
+        REQUIRE(FloatEnv::current().rounding == RoundingMode::upward);
+        set_float_env(defaults);
+    }
+}
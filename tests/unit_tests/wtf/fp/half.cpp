@@ -0,0 +1,80 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../../test_wtf.hpp"
+#include <cmath>
+#include <sstream>
+#include <wtf/buffer/float_buffer.hpp>
+#include <wtf/fp/float.hpp>
+#include <wtf/fp/half.hpp>
+
+using wtf::fp::Half;
+
+TEST_CASE("Half") {
+    Half one(1.0f);
+
+    SECTION("Ctors") {
+        REQUIRE(Half{}.bits() == 0);
+        REQUIRE(one.bits() == 0x3C00);
+        REQUIRE(Half(1.0).bits() == 0x3C00);
+        REQUIRE(Half::from_bits(0x3C00).bits() == 0x3C00);
+
+        // Double is rounded once, not once to float and then again
+        const auto above_tie = 1.0 + std::ldexp(1.0, -11) +
+                               std::ldexp(1.0, -40);
+        REQUIRE(Half(above_tie).bits() == 0x3C01);
+        REQUIRE(Half(static_cast<float>(above_tie)).bits() == 0x3C00);
+    }
+
+    SECTION("Conversions") {
+        float f = one;
+        REQUIRE(f == 1.0f);
+        REQUIRE(static_cast<double>(one) == 1.0);
+        REQUIRE(one + one == 2.0f);
+        REQUIRE(one == Half(1.0f));
+        REQUIRE(one != Half(2.0f));
+        REQUIRE(one < Half(2.0f));
+        REQUIRE(Half(0.0f) == Half(-0.0f));
+    }
+
+    SECTION("Printing") {
+        std::stringstream ss;
+        ss << Half(1.5f);
+        REQUIRE(ss.str() == "1.5");
+    }
+
+    SECTION("Type traits") {
+        using namespace wtf::type_traits;
+        STATIC_REQUIRE(is_floating_point_v<Half>);
+        REQUIRE(type_name_v<Half> == std::string("half"));
+        STATIC_REQUIRE(precision_v<Half> == 3);
+        STATIC_REQUIRE(is_convertible_v<Half, float>);
+        STATIC_REQUIRE(is_convertible_v<Half, double>);
+        STATIC_REQUIRE(is_convertible_v<Half, long double>);
+        STATIC_REQUIRE_FALSE(is_convertible_v<float, Half>);
+        STATIC_REQUIRE_FALSE(is_convertible_v<double, Half>);
+    }
+
+    SECTION("Works with Float and FloatBuffer") {
+        wtf::fp::Float value(one);
+        REQUIRE(value.to_string() == "1");
+        REQUIRE(value == wtf::fp::Float(Half(1.0f)));
+
+        wtf::buffer::FloatBuffer buffer(std::vector<Half>{one, one});
+        REQUIRE(buffer.size() == 2);
+        REQUIRE(buffer.value<Half>()[1] == one);
+    }
+}
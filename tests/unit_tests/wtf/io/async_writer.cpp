@@ -0,0 +1,205 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../../test_wtf.hpp"
+#include <cstdint>
+#include <fcntl.h>
+#include <unistd.h>
+#include <wtf/io/async_writer.hpp>
+#include <wtf/io/serialization.hpp>
+
+using namespace wtf::io;
+using wtf::buffer::BufferView;
+using wtf::buffer::FloatBuffer;
+using wtf::fp::Float;
+
+namespace {
+
+using tuple_type = test_wtf::default_fp_types;
+
+/// Reads @p n records back from the file at @p path
+std::vector<FloatBuffer> read_file(const std::filesystem::path& path,
+                                   std::size_t n) {
+    std::vector<FloatBuffer> buffers;
+    int fd = ::open(path.c_str(), O_RDONLY);
+    for(std::size_t i = 0; i < n; ++i)
+        buffers.push_back(read_float_buffer<tuple_type>(fd));
+    const auto offset = static_cast<std::uintmax_t>(::lseek(fd, 0, SEEK_CUR));
+    REQUIRE(offset == std::filesystem::file_size(path));
+    ::close(fd);
+    return buffers;
+}
+
+} // namespace
+
+TEMPLATE_LIST_TEST_CASE("AsyncWriter", "[wtf]", test_wtf::default_fp_types) {
+    using vector_type = std::vector<TestType>;
+    vector_type values{1.0, 2.0, 3.0};
+    FloatBuffer buffer(values);
+    FloatBuffer other(vector_type{4.0, 5.0});
+    auto path = test_wtf::scratch_file("async_writer");
+
+    SECTION("Records are written in order") {
+        AsyncWriter writer(path);
+        REQUIRE_FALSE(writer.is_direct());
+        auto h0 = writer.write<tuple_type>(BufferView<const Float>(buffer));
+        auto h1 = writer.write<tuple_type>(FloatBuffer(other));
+        auto h2 = writer.write<tuple_type>(FloatBuffer{});
+        h0.get();
+        h1.get();
+        h2.get();
+        writer.close();
+
+        auto buffers = read_file(path, 3);
+        REQUIRE(buffers[0] == buffer);
+        REQUIRE(buffers[1] == other);
+        REQUIRE(buffers[2] == FloatBuffer{});
+    }
+
+    SECTION("Views are copied") {
+        AsyncWriter writer(path);
+        auto handle = writer.write<tuple_type>(
+          BufferView<const Float>(values.data(), values.size()));
+        values[0] = TestType{42.0};
+        handle.get();
+        writer.close();
+        REQUIRE(read_file(path, 1)[0] == buffer);
+    }
+
+    SECTION("Checksums") {
+        AsyncWriteOptions options;
+        options.record_options.checksum_block_size = 8;
+        AsyncWriter writer(path, options);
+        writer.write<tuple_type>(FloatBuffer(buffer));
+        writer.close();
+        REQUIRE(read_file(path, 1)[0] == buffer);
+    }
+
+    SECTION("direct_io") {
+        AsyncWriteOptions options;
+        options.direct_io    = true;
+        options.staging_size = 2 * options.alignment;
+        AsyncWriter writer(path, options);
+
+        // Enough records to fill the staging buffer more than once
+        FloatBuffer big(vector_type(options.staging_size / sizeof(TestType)));
+        std::vector<std::future<void>> handles;
+        for(std::size_t i = 0; i < 3; ++i) {
+            handles.push_back(writer.write<tuple_type>(FloatBuffer(buffer)));
+            handles.push_back(writer.write<tuple_type>(FloatBuffer(big)));
+        }
+        writer.close();
+        for(auto& handle : handles) REQUIRE_NOTHROW(handle.get());
+
+        auto buffers = read_file(path, 6);
+        for(std::size_t i = 0; i < 6; i += 2) {
+            REQUIRE(buffers[i] == buffer);
+            REQUIRE(buffers[i + 1] == big);
+        }
+
+        SECTION("Throws if staging size is not aligned") {
+            options.staging_size = options.alignment + 1;
+            REQUIRE_THROWS_AS(AsyncWriter(path, options),
+                              std::invalid_argument);
+        }
+    }
+
+    SECTION("In-flight budget") {
+        AsyncWriteOptions options;
+        options.max_in_flight_bytes = sizeof(TestType);
+        AsyncWriter writer(path, options);
+
+        // Each buffer exceeds the budget, so writes are serialized
+        std::vector<std::future<void>> handles;
+        for(std::size_t i = 0; i < 10; ++i) {
+            handles.push_back(writer.write<tuple_type>(FloatBuffer(buffer)));
+            REQUIRE(writer.in_flight_bytes() <= 3 * sizeof(TestType));
+        }
+        writer.wait();
+        REQUIRE(writer.in_flight_bytes() == 0);
+        for(auto& handle : handles) {
+            REQUIRE(handle.wait_for(std::chrono::seconds(0)) ==
+                    std::future_status::ready);
+        }
+        writer.close();
+        for(const auto& x : read_file(path, 10)) REQUIRE(x == buffer);
+    }
+
+    SECTION("close") {
+        AsyncWriter writer(path);
+        writer.write<tuple_type>(FloatBuffer(buffer));
+        writer.close();
+        REQUIRE_NOTHROW(writer.close());
+        REQUIRE_THROWS_AS(writer.write<tuple_type>(FloatBuffer(buffer)),
+                          std::runtime_error);
+
+        // The buffer is not consumed if it could not be queued
+        FloatBuffer kept(buffer);
+        REQUIRE_THROWS_AS(writer.write<tuple_type>(std::move(kept)),
+                          std::runtime_error);
+        REQUIRE(kept == buffer);
+    }
+
+    SECTION("Move") {
+        AsyncWriter writer(path);
+        writer.write<tuple_type>(FloatBuffer(buffer));
+        AsyncWriter moved(std::move(writer));
+        moved.write<tuple_type>(FloatBuffer(other));
+        moved.close();
+        REQUIRE(read_file(path, 2)[1] == other);
+    }
+
+    SECTION("Dtor writes everything") {
+        {
+            AsyncWriter writer(path);
+            writer.write<tuple_type>(FloatBuffer(buffer));
+        }
+        REQUIRE(read_file(path, 1)[0] == buffer);
+    }
+
+    SECTION("Throws if type is not in tuple") {
+        constexpr bool is_float = std::is_same_v<TestType, float>;
+        using other_t     = std::conditional_t<is_float, double, float>;
+        using other_tuple = std::tuple<other_t>;
+        AsyncWriter writer(path);
+        REQUIRE_THROWS_AS(writer.write<other_tuple>(FloatBuffer(buffer)),
+                          std::runtime_error);
+        REQUIRE(writer.in_flight_bytes() == 0);
+    }
+
+    SECTION("Throws if file can not be opened") {
+        auto bad = test_wtf::scratch_file("no_such_dir") / "file";
+        REQUIRE_THROWS_AS(AsyncWriter(bad), std::system_error);
+    }
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("AsyncWriter (write errors)", "[wtf]") {
+    // MyCustomFloat has no Serializer, so writing it fails on the thread
+    using custom_tuple = std::tuple<test_wtf::MyCustomFloat>;
+    auto path          = test_wtf::scratch_file("async_writer_errors");
+    FloatBuffer custom(std::vector<test_wtf::MyCustomFloat>(2));
+    FloatBuffer values(std::vector<float>{1.0f});
+
+    AsyncWriter writer(path);
+    auto h0 = writer.write<custom_tuple>(FloatBuffer(custom));
+    auto h1 = writer.write<std::tuple<float>>(FloatBuffer(values));
+    REQUIRE_THROWS_AS(h0.get(), std::runtime_error);
+    REQUIRE_THROWS_AS(h1.get(), std::runtime_error);
+    REQUIRE_THROWS_AS(writer.close(), std::runtime_error);
+    std::filesystem::remove(path);
+}
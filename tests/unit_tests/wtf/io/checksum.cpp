@@ -0,0 +1,51 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../../test_wtf.hpp"
+#include <vector>
+#include <wtf/io/checksum.hpp>
+
+using namespace wtf::io;
+
+TEST_CASE("checksum") {
+    std::vector<std::byte> bytes(100);
+    for(std::size_t i = 0; i < bytes.size(); ++i)
+        bytes[i] = static_cast<std::byte>(i);
+
+    const auto value = checksum(bytes);
+
+    SECTION("Deterministic") { REQUIRE(checksum(bytes) == value); }
+
+    SECTION("Empty") {
+        std::span<const std::byte> empty;
+        REQUIRE(checksum(empty) == checksum(empty));
+        REQUIRE(checksum(empty) != value);
+    }
+
+    SECTION("Detects flipped bits") {
+        // Exercise the 32 byte loop, the 8 byte loop, and the tail loop
+        for(std::size_t i : {0, 40, 99}) {
+            auto copy = bytes;
+            copy[i] ^= std::byte{1};
+            REQUIRE(checksum(copy) != value);
+        }
+    }
+
+    SECTION("Depends on length") {
+        std::span<const std::byte> prefix(bytes.data(), 99);
+        REQUIRE(checksum(prefix) != value);
+    }
+}
@@ -0,0 +1,228 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../../test_wtf.hpp"
+#include <fstream>
+#include <limits>
+#include <wtf/io/chunked_reader.hpp>
+#include <wtf/io/serialization.hpp>
+
+using namespace wtf::io;
+using wtf::buffer::FloatBuffer;
+using wtf::buffer::contiguous_buffer_cast;
+
+namespace {
+
+using tuple_type = test_wtf::default_fp_types;
+
+/// Writes @p buffer to the file at @p path
+void write_file(const std::filesystem::path& path, const FloatBuffer& buffer,
+                WriteOptions options = {}) {
+    std::ofstream os(path, std::ios::binary);
+    write_float_buffer<tuple_type>(os, buffer, options);
+}
+
+} // namespace
+
+TEMPLATE_LIST_TEST_CASE("ChunkedReader", "[wtf]", test_wtf::default_fp_types) {
+    using vector_type = std::vector<TestType>;
+    vector_type values{1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0};
+    auto path = test_wtf::scratch_file("chunked_reader");
+    write_file(path, FloatBuffer(values));
+
+    // Reads every chunk, checking they tile values in order
+    auto read_all = [&](ChunkedReader& reader) {
+        vector_type seen;
+        while(auto chunk = reader.next()) {
+            auto span = contiguous_buffer_cast<const TestType>(*chunk);
+            REQUIRE(span.size() <= reader.chunk_size());
+            seen.insert(seen.end(), span.begin(), span.end());
+        }
+        return seen;
+    };
+
+    SECTION("open_chunked_reader") {
+        auto reader = open_chunked_reader<tuple_type>(path, 3);
+        REQUIRE(reader.size() == 7);
+        REQUIRE(reader.chunk_size() == 3);
+        REQUIRE(reader.n_chunks() == 3);
+        REQUIRE(reader.header() == FileHeader::make<TestType>(7));
+
+        SECTION("Throws if type is not in tuple") {
+            constexpr bool is_float = std::is_same_v<TestType, float>;
+            using other_t     = std::conditional_t<is_float, double, float>;
+            using other_tuple = std::tuple<other_t>;
+            REQUIRE_THROWS_AS(open_chunked_reader<other_tuple>(path, 3),
+                              std::runtime_error);
+        }
+
+        SECTION("Throws if chunk size is 0") {
+            REQUIRE_THROWS_AS(open_chunked_reader<tuple_type>(path, 0),
+                              std::invalid_argument);
+        }
+
+        SECTION("Throws if a chunk's byte count overflows") {
+            const auto huge = std::numeric_limits<std::size_t>::max() / 2;
+            REQUIRE_THROWS_AS(open_chunked_reader<tuple_type>(path, huge),
+                              std::invalid_argument);
+        }
+
+        SECTION("Throws if file does not exist") {
+            auto bad = test_wtf::scratch_file("not_a_file");
+            REQUIRE_THROWS_AS(open_chunked_reader<tuple_type>(bad, 3),
+                              std::system_error);
+        }
+    }
+
+    SECTION("next") {
+        auto reader = open_chunked_reader<tuple_type>(path, 3);
+        auto first  = reader.next();
+        REQUIRE(first.has_value());
+        auto span = contiguous_buffer_cast<const TestType>(*first);
+        REQUIRE(vector_type(span.begin(), span.end()) ==
+                vector_type{1.0, 2.0, 3.0});
+
+        auto second = reader.next();
+        auto third  = reader.next();
+        auto tail   = contiguous_buffer_cast<const TestType>(*third);
+        REQUIRE(vector_type(tail.begin(), tail.end()) == vector_type{7.0});
+        REQUIRE_FALSE(reader.next().has_value());
+        REQUIRE_FALSE(reader.next().has_value());
+
+        // Chunks alternate between two reused buffers
+        auto p1 = contiguous_buffer_cast<const TestType>(*second).data();
+        REQUIRE(tail.data() == span.data());
+        REQUIRE(p1 != span.data());
+    }
+
+    SECTION("Chunk size larger than the file") {
+        auto reader = open_chunked_reader<tuple_type>(path, 100);
+        REQUIRE(reader.n_chunks() == 1);
+        REQUIRE(read_all(reader) == values);
+    }
+
+    SECTION("Chunk size of 1") {
+        auto reader = open_chunked_reader<tuple_type>(path, 1);
+        REQUIRE(read_all(reader) == values);
+    }
+
+    SECTION("rewind") {
+        auto reader = open_chunked_reader<tuple_type>(path, 2);
+        reader.next();
+        reader.rewind();
+        REQUIRE(read_all(reader) == values);
+        reader.rewind();
+        REQUIRE(read_all(reader) == values);
+    }
+
+    SECTION("Move") {
+        auto reader = open_chunked_reader<tuple_type>(path, 2);
+        reader.next();
+        ChunkedReader moved(std::move(reader));
+        auto chunk = moved.next();
+        auto span  = contiguous_buffer_cast<const TestType>(*chunk);
+        REQUIRE(span[0] == TestType{3.0});
+
+        // The moved-from reader acts like an empty file
+        REQUIRE_FALSE(reader.next().has_value());
+        REQUIRE_NOTHROW(reader.rewind());
+        REQUIRE(reader.size() == 0);
+        REQUIRE(reader.chunk_size() == 0);
+        REQUIRE(reader.n_chunks() == 0);
+
+        reader = std::move(moved);
+        REQUIRE(reader.n_chunks() == 4);
+        REQUIRE(moved.n_chunks() == 0);
+    }
+
+    SECTION("Empty file") {
+        write_file(path, FloatBuffer{});
+        auto reader = open_chunked_reader<tuple_type>(path, 2);
+        REQUIRE(reader.n_chunks() == 0);
+        REQUIRE_FALSE(reader.next().has_value());
+    }
+
+    SECTION("Checksums") {
+        WriteOptions options{.checksum_block_size = 2 * sizeof(TestType)};
+        write_file(path, FloatBuffer(values), options);
+
+        SECTION("Verified per chunk") {
+            auto reader = open_chunked_reader<tuple_type>(path, 4);
+            REQUIRE(read_all(reader) == values);
+        }
+
+        SECTION("Throws if chunks split blocks") {
+            REQUIRE_THROWS_AS(open_chunked_reader<tuple_type>(path, 3),
+                              std::invalid_argument);
+        }
+
+        SECTION("Throws if corrupt") {
+            const auto offset = FileHeader::read(path).data_offset();
+            {
+                std::fstream fs(path, std::ios::in | std::ios::out |
+                                        std::ios::binary);
+                fs.seekp(offset + 5 * sizeof(TestType));
+                fs.put('\x7f');
+            }
+            auto reader = open_chunked_reader<tuple_type>(path, 4);
+            REQUIRE(reader.next().has_value());
+            REQUIRE_THROWS_AS(reader.next(), std::runtime_error);
+            REQUIRE_FALSE(reader.next().has_value());
+        }
+    }
+
+    SECTION("Other byte order is swapped") {
+        const auto header = FileHeader::read(path);
+        {
+            std::fstream fs(path,
+                            std::ios::in | std::ios::out | std::ios::binary);
+            auto bytes = std::as_writable_bytes(std::span(values));
+            wtf::io::detail_::byte_swap(bytes, sizeof(TestType));
+            fs.seekp(6);
+            const bool little =
+              header.endianness == FileHeader::Endianness::little;
+            fs.put(little ? 2 : 1);
+            fs.seekp(header.data_offset());
+            fs.write(reinterpret_cast<const char*>(values.data()),
+                     values.size() * sizeof(TestType));
+            wtf::io::detail_::byte_swap(bytes, sizeof(TestType));
+        }
+        auto reader = open_chunked_reader<tuple_type>(path, 3);
+        REQUIRE(read_all(reader) == values);
+    }
+
+    SECTION("Throws if truncated") {
+        std::filesystem::resize_file(path, std::filesystem::file_size(path) -
+                                             1);
+        auto reader = open_chunked_reader<tuple_type>(path, 3);
+        reader.next();
+        reader.next();
+        REQUIRE_THROWS_AS(reader.next(), std::runtime_error);
+    }
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("ChunkedReader (custom serializer)", "[wtf]") {
+    using custom_type = test_wtf::MyCustomFloat;
+    auto path         = test_wtf::scratch_file("chunked_reader_custom");
+    auto header       = FileHeader::make<custom_type>(1);
+    header.element_size = 0;
+    header.create_file(path);
+    REQUIRE_THROWS_AS(open_chunked_reader<std::tuple<custom_type>>(path, 1),
+                      std::invalid_argument);
+    std::filesystem::remove(path);
+}
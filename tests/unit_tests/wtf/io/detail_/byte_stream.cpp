@@ -0,0 +1,128 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../../../test_wtf.hpp"
+#include <array>
+#include <fcntl.h>
+#include <sstream>
+#include <system_error>
+#include <unistd.h>
+#include <vector>
+#include <wtf/io/detail_/byte_stream.hpp>
+
+using namespace wtf::io::detail_;
+
+namespace {
+
+std::vector<std::byte> make_bytes(std::size_t n, int first) {
+    std::vector<std::byte> bytes(n);
+    for(std::size_t i = 0; i < n; ++i)
+        bytes[i] = static_cast<std::byte>(first + i);
+    return bytes;
+}
+
+} // namespace
+
+TEST_CASE("ByteSink/ByteSource") {
+    auto a = make_bytes(3, 0);
+    auto b = make_bytes(5, 10);
+    std::vector<std::byte> none;
+    const std::array<ByteSink::piece_type, 3> pieces{a, none, b};
+
+    std::vector<std::byte> corr(a);
+    corr.insert(corr.end(), b.begin(), b.end());
+
+    SECTION("Streams") {
+        std::stringstream ss;
+        StreamSink sink(ss);
+        sink.write(pieces);
+
+        StreamSource source(ss);
+        REQUIRE(source.remaining() == corr.size());
+        std::vector<std::byte> buffer(corr.size());
+        source.read(buffer);
+        REQUIRE(source.remaining() == 0);
+        REQUIRE(buffer == corr);
+        REQUIRE_THROWS_AS(source.read(buffer), std::runtime_error);
+    }
+
+    SECTION("File descriptors") {
+        auto path = test_wtf::scratch_file("byte_stream");
+        int fd    = ::open(path.c_str(), O_CREAT | O_TRUNC | O_RDWR, 0600);
+        REQUIRE(fd >= 0);
+        FileDescriptorSink sink(fd);
+        sink.write(pieces);
+        ::lseek(fd, 0, SEEK_SET);
+
+        FileDescriptorSource source(fd);
+        REQUIRE(source.remaining() == corr.size());
+        std::vector<std::byte> buffer(corr.size());
+        source.read(buffer);
+        REQUIRE(buffer == corr);
+        REQUIRE(source.remaining() == 0);
+        REQUIRE_THROWS_AS(source.read(buffer), std::runtime_error);
+        ::close(fd);
+        std::filesystem::remove(path);
+
+        SECTION("Pipes have no known length") {
+            int fds[2];
+            REQUIRE(::pipe(fds) == 0);
+            REQUIRE_FALSE(FileDescriptorSource(fds[0]).remaining());
+            ::close(fds[0]);
+            ::close(fds[1]);
+        }
+
+        SECTION("Throws if fd is bad") {
+            FileDescriptorSink bad_sink(-1);
+            REQUIRE_THROWS_AS(bad_sink.write(pieces), std::system_error);
+            FileDescriptorSource bad_source(-1);
+            REQUIRE_THROWS_AS(bad_source.read(buffer), std::system_error);
+        }
+    }
+    SECTION("Aligned file descriptors") {
+        auto path = test_wtf::scratch_file("aligned_byte_stream");
+        int fd    = ::open(path.c_str(), O_CREAT | O_TRUNC | O_RDWR, 0600);
+        REQUIRE(fd >= 0);
+        AlignedFileSink sink(fd, 2, 4);
+        sink.write(pieces);
+        REQUIRE(sink.size() == corr.size());
+        sink.write(pieces);
+        sink.finish();
+        REQUIRE(std::filesystem::file_size(path) == 2 * corr.size());
+        ::lseek(fd, 0, SEEK_SET);
+
+        FileDescriptorSource source(fd);
+        std::vector<std::byte> buffer(corr.size());
+        source.read(buffer);
+        REQUIRE(buffer == corr);
+        source.read(buffer);
+        REQUIRE(buffer == corr);
+        ::close(fd);
+        std::filesystem::remove(path);
+
+        SECTION("Throws if alignment is not a power of 2") {
+            REQUIRE_THROWS_AS(AlignedFileSink(-1, 3, 6),
+                              std::invalid_argument);
+        }
+
+        SECTION("Throws if capacity is not a multiple of alignment") {
+            REQUIRE_THROWS_AS(AlignedFileSink(-1, 4, 6),
+                              std::invalid_argument);
+            REQUIRE_THROWS_AS(AlignedFileSink(-1, 4, 0),
+                              std::invalid_argument);
+        }
+    }
+}
@@ -0,0 +1,87 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../../../test_wtf.hpp"
+#include <sstream>
+#include <wtf/io/detail_/record.hpp>
+
+using namespace wtf::io;
+using namespace wtf::io::detail_;
+
+TEST_CASE("record") {
+    std::vector<double> values{1.0, 2.0, 3.0};
+    auto payload = std::as_bytes(std::span(values));
+    auto header  = FileHeader::make<double>(values.size());
+
+    SECTION("write_record/read_header/read_payload") {
+        for(std::size_t block : {0, 7, 8, 1000}) {
+            header.checksum_block_size = block;
+            std::stringstream ss;
+            StreamSink sink(ss);
+            write_record(sink, header, payload);
+
+            StreamSource source(ss);
+            REQUIRE(read_header(source) == header);
+            std::vector<double> buffer(values.size());
+            auto out = std::as_writable_bytes(std::span(buffer));
+            read_payload(source, header, out);
+            REQUIRE(buffer == values);
+            REQUIRE(ss.peek() == std::char_traits<char>::eof());
+        }
+    }
+
+    SECTION("read_payload throws on a checksum mismatch") {
+        header.checksum_block_size = 8;
+        std::stringstream ss;
+        StreamSink sink(ss);
+        write_record(sink, header, payload);
+        auto bytes = ss.str();
+        bytes[header.data_offset() + 9] ^= 0x01;
+
+        std::istringstream is(bytes);
+        StreamSource source(is);
+        read_header(source);
+        std::vector<double> buffer(values.size());
+        auto out = std::as_writable_bytes(std::span(buffer));
+        REQUIRE_THROWS_AS(read_payload(source, header, out),
+                          std::runtime_error);
+    }
+
+    SECTION("make_custom_payload/read_custom_payload") {
+        header.element_size        = 0;
+        header.checksum_block_size = 4;
+        std::string blob           = "hello world";
+        std::stringstream ss;
+        StreamSink sink(ss);
+        write_record(sink, header, make_custom_payload(blob));
+
+        StreamSource source(ss);
+        REQUIRE(read_header(source) == header);
+        REQUIRE(read_custom_payload(source, header) == blob);
+    }
+
+    SECTION("byte_swap") {
+        std::vector<std::byte> bytes{std::byte{1}, std::byte{2}, std::byte{3},
+                                     std::byte{4}};
+        byte_swap(bytes, 2);
+        std::vector<std::byte> corr{std::byte{2}, std::byte{1}, std::byte{4},
+                                    std::byte{3}};
+        REQUIRE(bytes == corr);
+
+        byte_swap(bytes, 1);
+        REQUIRE(bytes == corr);
+    }
+}
@@ -0,0 +1,109 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../../test_wtf.hpp"
+#include <system_error>
+#include <wtf/io/file_header.hpp>
+
+using namespace wtf::io;
+
+TEMPLATE_LIST_TEST_CASE("FileHeader", "[wtf]", test_wtf::all_fp_types) {
+    using type_name = wtf::type_traits::TypeName<TestType>;
+
+    auto header = FileHeader::make<TestType>(10);
+
+    SECTION("make") {
+        REQUIRE(header.type_name == type_name::value);
+        REQUIRE(header.element_size == sizeof(TestType));
+        REQUIRE(header.size == 10);
+        REQUIRE(header.endianness == FileHeader::native_endianness());
+        REQUIRE(header.version == FileHeader::current_version);
+        REQUIRE(header.checksum_block_size == 0);
+    }
+
+    SECTION("data_offset") {
+        auto offset = header.data_offset();
+        REQUIRE(offset % FileHeader::data_alignment == 0);
+        REQUIRE(offset >= FileHeader::fixed_size + header.type_name.size());
+    }
+
+    SECTION("data_size") {
+        REQUIRE(header.data_size() == 10 * sizeof(TestType));
+    }
+
+    SECTION("to_bytes/from_bytes") {
+        auto bytes = header.to_bytes();
+        REQUIRE(bytes.size() == header.data_offset());
+        REQUIRE(std::to_integer<char>(bytes[0]) == 'W');
+        REQUIRE(FileHeader::from_bytes(bytes) == header);
+
+        SECTION("With checksums") {
+            header.checksum_block_size = 4096;
+            REQUIRE(FileHeader::from_bytes(header.to_bytes()) == header);
+        }
+
+        SECTION("Throws if too short") {
+            std::span<const std::byte> short_bytes(bytes.data(), 10);
+            REQUIRE_THROWS_AS(FileHeader::from_bytes(short_bytes),
+                              std::runtime_error);
+        }
+
+        SECTION("Throws if bad magic") {
+            bytes[0] = std::byte{'X'};
+            REQUIRE_THROWS_AS(FileHeader::from_bytes(bytes),
+                              std::runtime_error);
+        }
+
+        SECTION("Throws if bad version") {
+            bytes[4] = std::byte{99};
+            REQUIRE_THROWS_AS(FileHeader::from_bytes(bytes),
+                              std::runtime_error);
+        }
+
+        SECTION("Throws if unknown flags") {
+            bytes[7] = std::byte{2};
+            REQUIRE_THROWS_AS(FileHeader::from_bytes(bytes),
+                              std::runtime_error);
+        }
+
+        SECTION("Throws if bad endianness") {
+            bytes[6] = std::byte{3};
+            REQUIRE_THROWS_AS(FileHeader::from_bytes(bytes),
+                              std::runtime_error);
+        }
+    }
+
+    SECTION("total_size") {
+        auto bytes = header.to_bytes();
+        std::span<const std::byte> prefix(bytes.data(), FileHeader::fixed_size);
+        REQUIRE(FileHeader::total_size(prefix) == header.data_offset());
+
+        bytes[0] = std::byte{'X'};
+        REQUIRE_THROWS_AS(FileHeader::total_size(bytes), std::runtime_error);
+    }
+
+    SECTION("create_file/read") {
+        auto path = test_wtf::scratch_file("file_header");
+        header.create_file(path);
+        auto file_size = header.data_offset() + header.data_size();
+        REQUIRE(std::filesystem::file_size(path) == file_size);
+        REQUIRE(FileHeader::read(path) == header);
+        std::filesystem::remove(path);
+
+        auto bad = test_wtf::scratch_file("not_a_file");
+        REQUIRE_THROWS_AS(FileHeader::read(bad), std::system_error);
+    }
+}
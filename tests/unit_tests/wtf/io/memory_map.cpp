@@ -0,0 +1,129 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../../test_wtf.hpp"
+#include <fstream>
+#include <string>
+#include <system_error>
+#include <wtf/io/memory_map.hpp>
+
+using namespace wtf::io;
+
+namespace {
+
+std::string read_file(const std::filesystem::path& path) {
+    std::ifstream file(path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(file), {});
+}
+
+} // namespace
+
+TEST_CASE("MemoryMap") {
+    using mode_type   = MemoryMap::Mode;
+    using advice_type = MemoryMap::Advice;
+
+    // Long enough that offsets past the first page get tested
+    std::string contents(10000, 'a');
+    contents[5000] = 'b';
+    auto path      = test_wtf::scratch_file("memory_map");
+    std::ofstream(path, std::ios::binary) << contents;
+
+    MemoryMap defaulted;
+    MemoryMap ro(path, mode_type::read_only, 0, contents.size());
+    MemoryMap rw(path, mode_type::read_write, 4999, 3);
+
+    SECTION("Ctors") {
+        SECTION("Default") {
+            REQUIRE(defaulted.data() == nullptr);
+            REQUIRE(defaulted.size() == 0);
+        }
+
+        SECTION("Region") {
+            REQUIRE(ro.size() == contents.size());
+            REQUIRE(ro.mode() == mode_type::read_only);
+            REQUIRE(std::to_integer<char>(ro.data()[5000]) == 'b');
+
+            // Offset need not be page aligned
+            REQUIRE(rw.size() == 3);
+            REQUIRE(rw.mode() == mode_type::read_write);
+            REQUIRE(std::to_integer<char>(rw.data()[0]) == 'a');
+            REQUIRE(std::to_integer<char>(rw.data()[1]) == 'b');
+        }
+
+        SECTION("Empty region") {
+            MemoryMap empty(path, mode_type::read_only, 10, 0);
+            REQUIRE(empty.data() == nullptr);
+            REQUIRE(empty.size() == 0);
+        }
+
+        SECTION("Throws if region is not in file") {
+            auto n = contents.size();
+            REQUIRE_THROWS_AS(MemoryMap(path, mode_type::read_only, 0, n + 1),
+                              std::out_of_range);
+            REQUIRE_THROWS_AS(MemoryMap(path, mode_type::read_only, n + 1, 0),
+                              std::out_of_range);
+        }
+
+        SECTION("Throws if file does not exist") {
+            auto bad = test_wtf::scratch_file("not_a_file");
+            REQUIRE_THROWS_AS(MemoryMap(bad, mode_type::read_only, 0, 0),
+                              std::system_error);
+        }
+
+        SECTION("Move") {
+            auto pdata = ro.data();
+            MemoryMap moved(std::move(ro));
+            REQUIRE(moved.data() == pdata);
+            REQUIRE(moved.size() == contents.size());
+            REQUIRE(ro.data() == nullptr);
+        }
+
+        SECTION("Move assignment") {
+            auto pdata = ro.data();
+            auto prv   = &(defaulted = std::move(ro));
+            REQUIRE(prv == &defaulted);
+            REQUIRE(defaulted.data() == pdata);
+            REQUIRE(ro.data() == nullptr);
+        }
+    }
+
+    SECTION("advise") {
+        REQUIRE_NOTHROW(ro.advise(advice_type::sequential));
+        REQUIRE_NOTHROW(ro.advise(advice_type::will_need, 4097, 100));
+        REQUIRE_NOTHROW(defaulted.advise(advice_type::random));
+        REQUIRE_THROWS_AS(rw.advise(advice_type::normal, 2, 2),
+                          std::out_of_range);
+    }
+
+    SECTION("flush") {
+        SECTION("read_only does not modify file") {
+            ro.data()[0] = std::byte{'z'};
+            ro.flush();
+            REQUIRE(read_file(path) == contents);
+        }
+
+        SECTION("read_write modifies file") {
+            rw.data()[1] = std::byte{'z'};
+            rw.flush();
+            contents[5000] = 'z';
+            REQUIRE(read_file(path) == contents);
+        }
+
+        SECTION("Nothing mapped") { REQUIRE_NOTHROW(defaulted.flush()); }
+    }
+
+    std::filesystem::remove(path);
+}
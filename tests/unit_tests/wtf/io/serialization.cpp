@@ -0,0 +1,281 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../../test_wtf.hpp"
+#include <fcntl.h>
+#include <sstream>
+#include <unistd.h>
+#include <wtf/buffer/mapped_buffer.hpp>
+#include <wtf/io/serialization.hpp>
+
+namespace test_io {
+
+/// A floating-point type which is not trivially copyable
+class StringFloat {
+public:
+    StringFloat() = default;
+    StringFloat(double v) : m_value(std::to_string(v)) {}
+    bool operator==(const StringFloat&) const = default;
+    std::string m_value;
+};
+
+inline void write_string_float(std::ostream& os, const StringFloat& f) {
+    auto n = f.m_value.size();
+    os.write(reinterpret_cast<const char*>(&n), sizeof(n));
+    os.write(f.m_value.data(), n);
+}
+
+inline void read_string_float(std::istream& is, StringFloat& f) {
+    std::size_t n = 0;
+    is.read(reinterpret_cast<char*>(&n), sizeof(n));
+    f.m_value.resize(n);
+    is.read(f.m_value.data(), n);
+}
+
+} // namespace test_io
+
+WTF_REGISTER_FP_TYPE(test_io::StringFloat);
+WTF_REGISTER_FP_SERIALIZER(test_io::StringFloat, test_io::write_string_float,
+                           test_io::read_string_float);
+
+using namespace wtf::io;
+using wtf::buffer::FloatBuffer;
+using wtf::fp::Float;
+
+namespace {
+
+using custom_types = std::tuple<test_io::StringFloat, test_wtf::MyCustomFloat>;
+using tuple_type =
+  wtf::type_traits::tuple_append_t<test_wtf::default_fp_types, custom_types>;
+
+/// Serializes @p buffer into a string
+std::string to_string(const FloatBuffer& buffer, WriteOptions options = {}) {
+    std::ostringstream os;
+    write_float_buffer<tuple_type>(os, buffer, options);
+    return os.str();
+}
+
+/// Deserializes a FloatBuffer from @p bytes
+FloatBuffer from_string(const std::string& bytes) {
+    std::istringstream is(bytes);
+    return read_float_buffer<tuple_type>(is);
+}
+
+} // namespace
+
+TEMPLATE_LIST_TEST_CASE("Serialization", "[wtf]", test_wtf::default_fp_types) {
+    using vector_type = std::vector<TestType>;
+    FloatBuffer buffer(vector_type{1.0, 2.0, 3.0});
+    WriteOptions checksummed{.checksum_block_size = 8};
+
+    SECTION("write_float_buffer/read_float_buffer (stream)") {
+        auto bytes  = to_string(buffer);
+        auto header = FileHeader::from_bytes(
+          std::as_bytes(std::span(bytes.data(), bytes.size())));
+        REQUIRE(header == FileHeader::make<TestType>(3));
+        REQUIRE(bytes.size() == header.data_offset() + header.data_size());
+        REQUIRE(from_string(bytes) == buffer);
+
+        SECTION("Checksums") {
+            auto summed = to_string(buffer, checksummed);
+            REQUIRE(from_string(summed) == buffer);
+        }
+
+        SECTION("Empty buffer") {
+            REQUIRE(from_string(to_string(FloatBuffer{})) == FloatBuffer{});
+            FloatBuffer empty(vector_type{});
+            REQUIRE(from_string(to_string(empty)) == FloatBuffer{});
+        }
+
+        SECTION("Records can be concatenated") {
+            FloatBuffer other(vector_type{4.0});
+            std::istringstream is(to_string(buffer) + to_string(other));
+            REQUIRE(read_float_buffer<tuple_type>(is) == buffer);
+            REQUIRE(read_float_buffer<tuple_type>(is) == other);
+        }
+
+        SECTION("Other byte order is swapped") {
+            auto offset = header.data_offset();
+            bytes[6]    = header.endianness == FileHeader::Endianness::little ?
+                            2 :
+                            1;
+            for(std::size_t i = 0; i < 3; ++i) {
+                auto begin = bytes.begin() + offset + i * sizeof(TestType);
+                std::reverse(begin, begin + sizeof(TestType));
+            }
+            REQUIRE(from_string(bytes) == buffer);
+        }
+
+        SECTION("Throws if corrupt") {
+            auto summed = to_string(buffer, checksummed);
+            summed[header.data_offset() + 1] ^= 0x10;
+            REQUIRE_THROWS_AS(from_string(summed), std::runtime_error);
+        }
+
+        SECTION("Throws if truncated") {
+            bytes.pop_back();
+            REQUIRE_THROWS_AS(from_string(bytes), std::runtime_error);
+        }
+
+        SECTION("Throws if the header is truncated") {
+            bytes.resize(FileHeader::fixed_size + 2);
+            REQUIRE_THROWS_AS(from_string(bytes), std::runtime_error);
+        }
+
+        SECTION("Throws if the header claims too many elements") {
+            // The element count is stored at bytes 16 to 23
+            for(auto n : {std::uint64_t{1} << 40, ~std::uint64_t{0}}) {
+                for(std::size_t i = 0; i < 8; ++i)
+                    bytes[16 + i] = static_cast<char>((n >> (8 * i)) & 0xFF);
+                REQUIRE_THROWS_AS(from_string(bytes), std::runtime_error);
+            }
+        }
+
+        SECTION("Throws if type is not in tuple") {
+            constexpr bool is_float = std::is_same_v<TestType, float>;
+            using other_t     = std::conditional_t<is_float, double, float>;
+            using other_tuple = std::tuple<other_t>;
+            std::istringstream is(bytes);
+            REQUIRE_THROWS_AS(read_float_buffer<other_tuple>(is),
+                              std::runtime_error);
+        }
+    }
+
+    SECTION("read_float_buffer into existing buffer") {
+        vector_type values(3);
+        auto pvalues = values.data();
+        FloatBuffer dest(std::move(values));
+
+        std::istringstream is(to_string(buffer, checksummed));
+        read_float_buffer<tuple_type>(is, dest);
+        REQUIRE(dest == buffer);
+        REQUIRE(dest.value<TestType>().data() == pvalues);
+
+        SECTION("Throws if size is wrong") {
+            FloatBuffer wrong_size(vector_type(2));
+            std::istringstream is2(to_string(buffer));
+            REQUIRE_THROWS_AS(read_float_buffer<tuple_type>(is2, wrong_size),
+                              std::runtime_error);
+        }
+
+        SECTION("Throws if type is wrong") {
+            constexpr bool is_float = std::is_same_v<TestType, float>;
+            using other_t = std::conditional_t<is_float, double, float>;
+            FloatBuffer wrong_type(std::vector<other_t>(3));
+            std::istringstream is2(to_string(buffer));
+            REQUIRE_THROWS_AS(read_float_buffer<tuple_type>(is2, wrong_type),
+                              std::runtime_error);
+        }
+    }
+
+    SECTION("File descriptors") {
+        auto path = test_wtf::scratch_file("serialization");
+        int fd    = ::open(path.c_str(), O_CREAT | O_TRUNC | O_RDWR, 0600);
+        REQUIRE(fd >= 0);
+        write_float_buffer<tuple_type>(fd, buffer, checksummed);
+        write_float_buffer<tuple_type>(fd, buffer);
+        ::lseek(fd, 0, SEEK_SET);
+
+        REQUIRE(read_float_buffer<tuple_type>(fd) == buffer);
+        FloatBuffer dest(vector_type(3));
+        read_float_buffer<tuple_type>(fd, dest);
+        REQUIRE(dest == buffer);
+        REQUIRE_THROWS_AS(read_float_buffer<tuple_type>(fd),
+                          std::runtime_error);
+        ::close(fd);
+
+        SECTION("Files can be memory mapped") {
+            auto mapped = wtf::buffer::map_float_buffer<tuple_type>(path);
+            REQUIRE(mapped == buffer);
+        }
+        std::filesystem::remove(path);
+    }
+
+    SECTION("write_float/read_float") {
+        Float value(TestType{3.14});
+        std::stringstream ss;
+        write_float<tuple_type>(ss, value);
+        REQUIRE(read_float<tuple_type>(ss) == value);
+
+        std::istringstream is(to_string(buffer));
+        REQUIRE_THROWS_AS(read_float<tuple_type>(is), std::runtime_error);
+    }
+}
+
+TEST_CASE("Serialization of complex types") {
+    using complex_type  = std::complex<double>;
+    using complex_tuple = std::tuple<complex_type>;
+    FloatBuffer buffer(std::vector<complex_type>{{1.0, 2.0}, {3.0, 4.0}});
+
+    std::ostringstream os;
+    write_float_buffer<complex_tuple>(os, buffer);
+    auto bytes  = os.str();
+    auto header = FileHeader::from_bytes(
+      std::as_bytes(std::span(bytes.data(), bytes.size())));
+
+    SECTION("Other byte order swaps the parts independently") {
+        bytes[6] = header.endianness == FileHeader::Endianness::little ? 2 : 1;
+        for(std::size_t i = 0; i < 4; ++i) {
+            auto begin = bytes.begin() + header.data_offset() +
+                         i * sizeof(double);
+            std::reverse(begin, begin + sizeof(double));
+        }
+        std::istringstream is(bytes);
+        REQUIRE(read_float_buffer<complex_tuple>(is) == buffer);
+    }
+}
+
+TEST_CASE("Serialization of custom types") {
+    using test_io::StringFloat;
+    FloatBuffer buffer(std::vector<StringFloat>{1.0, 2.0, 3.0});
+
+    SECTION("Custom Serializer") {
+        auto bytes  = to_string(buffer);
+        auto header = FileHeader::from_bytes(
+          std::as_bytes(std::span(bytes.data(), bytes.size())));
+        REQUIRE(header.element_size == 0);
+        REQUIRE(from_string(bytes) == buffer);
+
+        SECTION("Throws if the byte count is too big") {
+            // The byte count is the first word of the payload
+            for(auto n : {std::uint64_t{1} << 40, ~std::uint64_t{0}}) {
+                for(std::size_t i = 0; i < 8; ++i) {
+                    bytes[header.data_offset() + i] =
+                      static_cast<char>((n >> (8 * i)) & 0xFF);
+                }
+                REQUIRE_THROWS_AS(from_string(bytes), std::runtime_error);
+            }
+        }
+
+        WriteOptions checksummed{.checksum_block_size = 16};
+        auto summed = to_string(buffer, checksummed);
+        REQUIRE(from_string(summed) == buffer);
+        summed[header.data_offset() + 12] ^= 0x01;
+        REQUIRE_THROWS_AS(from_string(summed), std::runtime_error);
+    }
+
+    SECTION("Float") {
+        Float value(StringFloat{2.0});
+        std::stringstream ss;
+        write_float<tuple_type>(ss, value);
+        REQUIRE(read_float<tuple_type>(ss) == value);
+    }
+
+    SECTION("Throws if type has no Serializer") {
+        FloatBuffer no_serializer(std::vector<test_wtf::MyCustomFloat>(2));
+        REQUIRE_THROWS_AS(to_string(no_serializer), std::runtime_error);
+    }
+}
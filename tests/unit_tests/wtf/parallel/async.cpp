@@ -0,0 +1,97 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "../../../test_wtf.hpp"
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+#include <wtf/parallel/async.hpp>
+#include <wtf/parallel/thread_pool.hpp>
+
+using namespace wtf::parallel;
+
+TEST_CASE("async") {
+    SECTION("On the current executor") {
+        auto future = async([]() { return 42; });
+        REQUIRE(future.get() == 42);
+    }
+
+    SECTION("On a given executor") {
+        InlineExecutor executor;
+        auto future = async(executor, []() { return 1.5; });
+        REQUIRE(future.wait_for(std::chrono::seconds(0)) ==
+                std::future_status::ready);
+        REQUIRE(future.get() == 1.5);
+    }
+
+    SECTION("Move-only callables") {
+        auto p      = std::make_unique<int>(3);
+        auto future = async([p = std::move(p)]() { return *p; });
+        REQUIRE(future.get() == 3);
+    }
+
+    SECTION("Exceptions are stored in the future") {
+        auto future = async([]() -> int { throw std::runtime_error("oops"); });
+        REQUIRE_THROWS_AS(future.get(), std::runtime_error);
+    }
+}
+
+TEST_CASE("get") {
+    // One worker, so tasks waiting on tasks would deadlock without helping
+    test_wtf::UseExecutor guard(
+      std::make_shared<ThreadPool>(ThreadPoolOptions{.n_threads = 1}));
+
+    auto outer = async([]() {
+        std::vector<std::future<int>> inner;
+        for(int i = 0; i < 4; ++i) inner.push_back(async([i]() { return i; }));
+        int total = 0;
+        for(auto& future : inner) total += get(std::move(future));
+        return total;
+    });
+    REQUIRE(get(std::move(outer)) == 6);
+
+    auto error = async([]() { throw std::runtime_error("oops"); });
+    REQUIRE_THROWS_AS(get(std::move(error)), std::runtime_error);
+}
+
+TEST_CASE("then") {
+    SECTION("Non-void") {
+        auto future = then(async([]() { return 2; }),
+                           [](int x) { return x * 3.0; });
+        REQUIRE(future.get() == 6.0);
+    }
+
+    SECTION("Void") {
+        int value   = 0;
+        auto future = then(async([&]() { value = 1; }),
+                           [&]() { return value + 1; });
+        REQUIRE(future.get() == 2);
+    }
+
+    SECTION("Exceptions skip the continuation") {
+        bool called = false;
+        auto future =
+          then(async([]() -> int { throw std::runtime_error("oops"); }),
+               [&](int x) {
+                   called = true;
+                   return x;
+               });
+        REQUIRE_THROWS_AS(future.get(), std::runtime_error);
+        REQUIRE_FALSE(called);
+    }
+}
@@ -0,0 +1,53 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "../../../test_wtf.hpp"
+#include <memory>
+#include <wtf/parallel/executor.hpp>
+#include <wtf/parallel/thread_pool.hpp>
+
+using namespace wtf::parallel;
+
+TEST_CASE("InlineExecutor") {
+    InlineExecutor executor;
+    int count = 0;
+    executor.submit([&]() { ++count; });
+    REQUIRE(count == 1);
+    executor.submit([&]() { ++count; }, 5);
+    REQUIRE(count == 2);
+    REQUIRE(executor.concurrency() == 1);
+    REQUIRE_FALSE(executor.run_pending_task());
+}
+
+TEST_CASE("executor/set_executor/max_threads") {
+    SECTION("Defaults to the default thread pool") {
+        auto pexecutor = executor();
+        REQUIRE(pexecutor == default_thread_pool());
+        auto n_threads = default_thread_pool_options().resolved_n_threads();
+        REQUIRE(max_threads() == n_threads);
+    }
+
+    SECTION("Installed executor") {
+        auto pinline = std::make_shared<InlineExecutor>();
+        set_executor(pinline);
+        REQUIRE(executor() == pinline);
+        REQUIRE(max_threads() == 1);
+
+        set_executor(nullptr);
+        REQUIRE(executor() == default_thread_pool());
+    }
+}
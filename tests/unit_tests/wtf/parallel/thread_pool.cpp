@@ -0,0 +1,130 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "../../../test_wtf.hpp"
+#include <atomic>
+#include <future>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+#include <wtf/parallel/thread_pool.hpp>
+
+using namespace wtf::parallel;
+
+TEST_CASE("ThreadPoolOptions") {
+    ThreadPoolOptions defaulted;
+    REQUIRE(defaulted.n_threads == 0);
+    REQUIRE_FALSE(defaulted.pin_threads);
+    REQUIRE(defaulted.resolved_n_threads() >= 1);
+
+    ThreadPoolOptions three{.n_threads = 3};
+    REQUIRE(three.resolved_n_threads() == 3);
+    REQUIRE(three != defaulted);
+}
+
+TEST_CASE("ThreadPool") {
+    ThreadPool pool(ThreadPoolOptions{.n_threads = 3});
+
+    SECTION("Ctor") {
+        REQUIRE(pool.size() == 3);
+        REQUIRE(pool.concurrency() == 3);
+        REQUIRE(pool.options().n_threads == 3);
+        REQUIRE_FALSE(pool.is_pinned());
+        REQUIRE_FALSE(pool.is_worker());
+    }
+
+    SECTION("submit") {
+        std::atomic<int> count = 0;
+        std::promise<bool> is_worker;
+        pool.submit([&]() { is_worker.set_value(pool.is_worker()); });
+        REQUIRE(is_worker.get_future().get());
+
+        std::promise<void> done;
+        for(int i = 0; i < 100; ++i) {
+            pool.submit([&]() {
+                if(++count == 100) done.set_value();
+            });
+        }
+        done.get_future().wait();
+        REQUIRE(count == 100);
+    }
+
+    SECTION("submit with a hint/run_pending_task") {
+        // Block every worker, so the submitted tasks stay queued
+        std::promise<void> go;
+        std::shared_future<void> ready(go.get_future());
+        std::atomic<int> n_blocked = 0;
+        for(int i = 0; i < 3; ++i) {
+            pool.submit([&]() {
+                ++n_blocked;
+                ready.wait();
+            });
+        }
+        while(n_blocked < 3) std::this_thread::yield();
+
+        std::vector<std::size_t> order;
+        for(std::size_t i = 0; i < 6; ++i)
+            pool.submit([&, i]() { order.push_back(i); }, i);
+
+        // A non-worker steals the oldest task of each queue in turn
+        while(pool.run_pending_task()) {}
+        REQUIRE(order == std::vector<std::size_t>{0, 3, 1, 4, 2, 5});
+        go.set_value();
+    }
+
+    SECTION("pin_threads") {
+        ThreadPool pinned(ThreadPoolOptions{.n_threads = 2,
+                                            .pin_threads = true});
+        REQUIRE(pinned.size() == 2);
+        REQUIRE(pinned.options().pin_threads);
+        std::promise<void> done;
+        pinned.submit([&]() { done.set_value(); });
+        done.get_future().wait();
+    }
+
+    SECTION("Dtor runs the queued tasks") {
+        std::atomic<int> count = 0;
+        {
+            ThreadPool temp(ThreadPoolOptions{.n_threads = 1});
+            for(int i = 0; i < 50; ++i) temp.submit([&]() { ++count; });
+        }
+        REQUIRE(count == 50);
+    }
+}
+
+TEST_CASE("default_thread_pool") {
+    auto old_options = default_thread_pool_options();
+    auto ppool       = default_thread_pool();
+    REQUIRE(ppool == default_thread_pool());
+    REQUIRE(ppool->options() == old_options);
+
+    SECTION("Same options keep the pool") {
+        set_default_thread_pool_options(old_options);
+        REQUIRE(default_thread_pool() == ppool);
+    }
+
+    SECTION("New options make a new pool") {
+        ThreadPoolOptions options{.n_threads = 2};
+        set_default_thread_pool_options(options);
+        REQUIRE(default_thread_pool_options() == options);
+        auto pnew = default_thread_pool();
+        REQUIRE(pnew != ppool);
+        REQUIRE(pnew->size() == 2);
+        set_default_thread_pool_options(old_options);
+    }
+}
@@ -0,0 +1,37 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../../test_wtf.hpp"
+#include <wtf/type_traits/is_complex.hpp>
+
+using namespace wtf::type_traits;
+
+TEMPLATE_LIST_TEST_CASE("IsComplex", "[type_traits]",
+                        test_wtf::default_fp_types) {
+    using complex_type = std::complex<TestType>;
+
+    SECTION("IsComplex") {
+        STATIC_REQUIRE_FALSE(IsComplex<TestType>::value);
+        STATIC_REQUIRE_FALSE(is_complex_v<TestType>);
+        STATIC_REQUIRE(IsComplex<complex_type>::value);
+        STATIC_REQUIRE(is_complex_v<complex_type>);
+    }
+
+    SECTION("RealType") {
+        STATIC_REQUIRE(std::is_same_v<real_type_t<TestType>, TestType>);
+        STATIC_REQUIRE(std::is_same_v<real_type_t<complex_type>, TestType>);
+    }
+}
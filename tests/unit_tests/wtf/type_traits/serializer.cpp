@@ -0,0 +1,52 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../../test_wtf.hpp"
+#include <wtf/type_traits/serializer.hpp>
+
+using namespace wtf::type_traits;
+
+namespace {
+
+struct HasSerializer {
+    std::string value;
+};
+
+} // namespace
+
+template<>
+struct wtf::type_traits::Serializer<HasSerializer> {
+    static constexpr bool is_bitwise = false;
+    static void write(std::ostream&, const HasSerializer&) {}
+    static void read(std::istream&, HasSerializer&) {}
+};
+
+TEMPLATE_LIST_TEST_CASE("Serializer", "[wtf]", test_wtf::default_fp_types) {
+    STATIC_REQUIRE(Serializer<TestType>::is_bitwise);
+    STATIC_REQUIRE_FALSE(has_custom_serializer_v<TestType>);
+    STATIC_REQUIRE(is_serializable_v<TestType>);
+}
+
+TEST_CASE("Serializer (custom types)") {
+    using test_wtf::MyCustomFloat;
+    STATIC_REQUIRE_FALSE(Serializer<MyCustomFloat>::is_bitwise);
+    STATIC_REQUIRE_FALSE(has_custom_serializer_v<MyCustomFloat>);
+    STATIC_REQUIRE_FALSE(is_serializable_v<MyCustomFloat>);
+
+    STATIC_REQUIRE_FALSE(Serializer<HasSerializer>::is_bitwise);
+    STATIC_REQUIRE(has_custom_serializer_v<HasSerializer>);
+    STATIC_REQUIRE(is_serializable_v<HasSerializer>);
+}